@@ -60,8 +60,11 @@ int main(int argc, char **argv){
   occaCopyPtrToMem(o_a, a, entries*sizeof(float), 0);
   occaCopyPtrToMem(o_b, b, occaAutoSize, occaNoOffset);
 
+  // Scalars by value aren't allocated, occaInt(entries) also works
+  occaScalar entriesArg = occaIntScalar(entries);
+
   occaKernelRun(addVectors,
-               occaInt(entries), o_a, o_b, o_ab);
+               &entriesArg, o_a, o_b, o_ab);
 
   occaCopyMemToPtr(ab, o_ab, occaAutoSize, occaNoOffset);
 
@@ -0,0 +1,92 @@
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "occa.hpp"
+
+void timeAtomics(const std::string &deviceInfo);
+
+int main(int argc, char **argv){
+  // Pass a device string to only time one backend
+  if(1 < argc){
+    timeAtomics(argv[1]);
+    return 0;
+  }
+
+  timeAtomics("mode = Serial");
+  timeAtomics("mode = OpenMP");
+  timeAtomics("mode = Pthreads, threadCount = 4, schedule = compact");
+
+  return 0;
+}
+
+template <class TM>
+void checkAtomic(occa::device &device, occa::kernel &kernel,
+                 const std::string &name,
+                 const int entries, const int bins,
+                 const TM init, const bool isMax){
+  std::vector<TM> hist(bins, init), trueHist(bins, init);
+
+  for(int i = 0; i < entries; ++i){
+    TM &h = trueHist[(i * 31) % bins];
+
+    if(isMax)
+      h = ((h < (TM) i) ? (TM) i : h);
+    else
+      h += 1;
+  }
+
+  occa::memory o_hist = device.malloc(bins * sizeof(TM), &(hist[0]));
+
+  // Warm-up launch compiles and faults in the pages
+  kernel(entries, bins, o_hist);
+  o_hist.copyFrom(&(hist[0]));
+  device.finish();
+
+  const double startTime = occa::currentTime();
+
+  kernel(entries, bins, o_hist);
+  device.finish();
+
+  const double elapsed = occa::currentTime() - startTime;
+
+  o_hist.copyTo(&(hist[0]));
+
+  for(int b = 0; b < bins; ++b){
+    if(hist[b] != trueHist[b]){
+      std::cout << name << " with [" << bins << "] bins failed at bin [" << b << "]: "
+                << hist[b] << " != " << trueHist[b] << '\n';
+      throw 1;
+    }
+  }
+
+  std::cout << "  " << name << ", " << bins << " bins: "
+            << (entries / elapsed / 1.0e6) << " M updates/s\n";
+
+  o_hist.free();
+}
+
+void timeAtomics(const std::string &deviceInfo){
+  const int entries = (1 << 22);
+  const int bins[3] = {1, 64, 4096};
+
+  occa::device device(deviceInfo);
+
+  std::cout << "[" << device.mode() << "]\n";
+
+  occa::kernel intAdd   = device.buildKernelFromSource("atomics.okl", "intAdd");
+  occa::kernel floatAdd = device.buildKernelFromSource("atomics.okl", "floatAdd");
+  occa::kernel intMax   = device.buildKernelFromSource("atomics.okl", "intMax");
+
+  for(int i = 0; i < 3; ++i){
+    checkAtomic<int>  (device, intAdd  , "atomicAdd(int)  ", entries, bins[i], 0, false);
+    checkAtomic<float>(device, floatAdd, "atomicAdd(float)", entries, bins[i], 0, false);
+    checkAtomic<int>  (device, intMax  , "atomicMax(int)  ", entries, bins[i], -1, true);
+  }
+
+  intAdd.free();
+  floatAdd.free();
+  intMax.free();
+
+  device.free();
+}
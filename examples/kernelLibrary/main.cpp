@@ -0,0 +1,83 @@
+#include <iostream>
+#include <cstring>
+
+#include "occa.hpp"
+
+// Usage:
+//   ./main save [device info]   Builds the kernels and writes [kernels.occalib]
+//   ./main [device info]        Runs them from [kernels.occalib] without the
+//                               OKL parser or a compiler
+void saveLibrary(occa::device &device);
+void loadLibrary(occa::device &device);
+
+int main(int argc, char **argv){
+  const bool saving = ((1 < argc) && (strcmp(argv[1], "save") == 0));
+
+  const int infoArg = (saving ? 2 : 1);
+
+  occa::device device((infoArg < argc) ? argv[infoArg] : "mode = Serial");
+
+  if(saving)
+    saveLibrary(device);
+  else
+    loadLibrary(device);
+
+  device.free();
+
+  return 0;
+}
+
+void saveLibrary(occa::device &device){
+  device.cacheKernelInLibrary("addVectors.okl", "addVectors");
+
+  occa::library::save("kernels.occalib");
+
+  std::cout << "Saved [addVectors] for [" << device.mode() << "] in [kernels.occalib]\n";
+}
+
+void loadLibrary(occa::device &device){
+  const int entries = 1000;
+
+  float *a  = new float[entries];
+  float *b  = new float[entries];
+  float *ab = new float[entries];
+
+  for(int i = 0; i < entries; ++i){
+    a[i]  = i;
+    b[i]  = 1 - i;
+    ab[i] = 0;
+  }
+
+  // The library is mapped, kernels are read from it in place
+  occa::library::load("kernels.occalib");
+
+  occa::kernelDatabase addVectorsDB = occa::library::loadKernelDatabase("addVectors");
+
+  occa::kernel addVectors = device[addVectorsDB];
+
+  occa::memory o_a  = device.malloc(entries*sizeof(float), a);
+  occa::memory o_b  = device.malloc(entries*sizeof(float), b);
+  occa::memory o_ab = device.malloc(entries*sizeof(float));
+
+  addVectors(entries, o_a, o_b, o_ab);
+
+  o_ab.copyTo(ab);
+
+  for(int i = 0; i < entries; ++i){
+    if(ab[i] != (a[i] + b[i])){
+      std::cout << "addVectors from the library failed at [" << i << "]\n";
+      throw 1;
+    }
+  }
+
+  std::cout << "Ran [addVectors] from [kernels.occalib] on [" << device.mode() << "]\n";
+
+  delete [] a;
+  delete [] b;
+  delete [] ab;
+
+  addVectors.free();
+  o_a.free();
+  o_b.free();
+  o_ab.free();
+}
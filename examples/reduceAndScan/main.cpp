@@ -0,0 +1,143 @@
+#include <iostream>
+#include <cmath>
+
+#include "occa.hpp"
+#include "occa/array.hpp"
+
+void checkReductions(occa::device &device, const int entries);
+void checkScan(occa::device &device, const int entries);
+void timeReductions(occa::device &device, const int entries);
+
+int main(int argc, char **argv){
+  // Pass a device string to run on another backend
+  occa::device device((1 < argc) ? argv[1] : "mode = Serial");
+
+  const int sizes[4] = {1, 1000, 100003, 1000000};
+
+  for(int i = 0; i < 4; ++i){
+    checkReductions(device, sizes[i]);
+    checkScan(device, sizes[i]);
+  }
+
+  timeReductions(device, 1 << 24);
+
+  device.free();
+
+  return 0;
+}
+
+void checkReductions(occa::device &device, const int entries){
+  int *a = new int[entries];
+
+  int trueSum = 0, trueMin = 1 << 30, trueMax = -(1 << 30);
+
+  for(int i = 0; i < entries; ++i){
+    a[i] = ((i * 37) % 101) - 50;
+
+    trueSum += a[i];
+    trueMin  = (a[i] < trueMin) ? a[i] : trueMin;
+    trueMax  = (trueMax < a[i]) ? a[i] : trueMax;
+  }
+
+  occa::memory o_a = device.malloc(entries * sizeof(int), a);
+
+  const int sum = occa::reduce<int>(o_a, occa::binaryOp::sum);
+  const int min = occa::reduce<int>(o_a, occa::binaryOp::min);
+  const int max = occa::reduce<int>(o_a, occa::binaryOp::max);
+
+  // User-defined operators are expressions of [a] and [b]
+  const int absMax = occa::reduce<int>(o_a, "(((a < 0) ? -a : a) < ((b < 0) ? -b : b)) ? b : a");
+
+  const int trueAbsMax = ((-trueMin < trueMax) ? trueMax : trueMin);
+
+  if((sum != trueSum) || (min != trueMin) || (max != trueMax) ||
+     (((absMax < 0) ? -absMax : absMax) != ((trueAbsMax < 0) ? -trueAbsMax : trueAbsMax))){
+    std::cout << "Reduction of [" << entries << "] entries failed\n";
+    throw 1;
+  }
+
+  std::cout << "Reduced [" << entries << "] entries: sum = " << sum
+            << ", min = " << min << ", max = " << max << '\n';
+
+  delete [] a;
+  o_a.free();
+}
+
+void checkScan(occa::device &device, const int entries){
+  occa::array<float> a(device, entries), aScan(device, entries);
+
+  for(int i = 0; i < entries; ++i)
+    a[i] = (i % 3);
+
+  occa::scan(a, aScan, occa::binaryOp::sum);
+  device.finish();
+
+  float partial = 0;
+
+  for(int i = 0; i < entries; ++i){
+    partial += a[i];
+
+    if(aScan[i] != partial){
+      std::cout << "Scan of [" << entries << "] entries failed at [" << i << "]\n";
+      throw 1;
+    }
+  }
+
+  std::cout << "Scanned [" << entries << "] entries: last = " << aScan[entries - 1] << '\n';
+
+  a.free();
+  aScan.free();
+}
+
+void timeReductions(occa::device &device, const int entries){
+  const int iterations = 20;
+  const double gb = (entries * sizeof(float) * iterations) / 1.0e9;
+
+  float *a = new float[entries];
+
+  for(int i = 0; i < entries; ++i)
+    a[i] = 1;
+
+  occa::memory o_a = device.malloc(entries * sizeof(float), a);
+  occa::memory o_b = device.malloc(entries * sizeof(float));
+
+  // Warm up the kernels before timing them
+  occa::reduce<float>(o_a, occa::binaryOp::sum);
+  occa::scan<float>(o_a, o_b, occa::binaryOp::sum);
+  device.finish();
+
+  double startTime = occa::currentTime();
+
+  for(int i = 0; i < iterations; ++i)
+    o_b.copyFrom(o_a);
+
+  device.finish();
+  const double copyTime = occa::currentTime() - startTime;
+
+  startTime = occa::currentTime();
+
+  for(int i = 0; i < iterations; ++i)
+    occa::reduce<float>(o_a, occa::binaryOp::sum);
+
+  device.finish();
+  const double reduceTime = occa::currentTime() - startTime;
+
+  startTime = occa::currentTime();
+
+  for(int i = 0; i < iterations; ++i)
+    occa::scan<float>(o_a, o_b, occa::binaryOp::sum);
+
+  device.finish();
+  const double scanTime = occa::currentTime() - startTime;
+
+  std::cout << "Throughput over [" << entries << "] floats:\n"
+            << "  memcpy : " << (gb / copyTime)   << " GB/s\n"
+            << "  reduce : " << (gb / reduceTime) << " GB/s ("
+            << (100.0 * copyTime / reduceTime) << "% of memcpy)\n"
+            << "  scan   : " << (gb / scanTime)   << " GB/s ("
+            << (100.0 * copyTime / scanTime) << "% of memcpy)\n";
+
+  delete [] a;
+  o_a.free();
+  o_b.free();
+}
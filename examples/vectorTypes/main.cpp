@@ -0,0 +1,81 @@
+#include <iostream>
+#include <cmath>
+
+#include "occa.hpp"
+
+int main(int argc, char **argv){
+  const int entries    = (1 << 22);
+  const int iterations = 10;
+
+  // Pass a device string to time another backend
+  occa::device device((1 < argc) ? argv[1] : "mode = Serial");
+
+  float *x  = new float[entries];
+  float *y  = new float[entries];
+  float *y4 = new float[entries];
+
+  for(int i = 0; i < entries; ++i)
+    x[i] = (i % 100) / 101.0f;
+
+  occa::kernelInfo info;
+  info.addDefine("p_terms", 64);
+
+  occa::kernel scalarPoly = device.buildKernelFromSource("vectorTypes.okl", "scalarPoly", info);
+  occa::kernel vectorPoly = device.buildKernelFromSource("vectorTypes.okl", "vectorPoly", info);
+
+  occa::memory o_x  = device.malloc(entries * sizeof(float), x);
+  occa::memory o_y  = device.malloc(entries * sizeof(float));
+  occa::memory o_y4 = device.malloc(entries * sizeof(float));
+
+  // Warm up both kernels before timing them
+  scalarPoly(entries, o_x, o_y);
+  vectorPoly(entries / 4, o_x, o_y4);
+  device.finish();
+
+  double startTime = occa::currentTime();
+
+  for(int i = 0; i < iterations; ++i)
+    scalarPoly(entries, o_x, o_y);
+
+  device.finish();
+  const double scalarTime = (occa::currentTime() - startTime) / iterations;
+
+  startTime = occa::currentTime();
+
+  for(int i = 0; i < iterations; ++i)
+    vectorPoly(entries / 4, o_x, o_y4);
+
+  device.finish();
+  const double vectorTime = (occa::currentTime() - startTime) / iterations;
+
+  o_y.copyTo(y);
+  o_y4.copyTo(y4);
+
+  for(int i = 0; i < entries; ++i){
+    if(1e-5 < std::fabs(y[i] - y4[i]) / std::fabs(y[i])){
+      std::cout << "Vector result differs at [" << i << "]: "
+                << y4[i] << " != " << y[i] << '\n';
+      throw 1;
+    }
+  }
+
+  std::cout << "[" << device.mode() << "] " << entries << " entries\n"
+            << "  float : " << (1.0e3 * scalarTime) << " ms\n"
+            << "  float4: " << (1.0e3 * vectorTime) << " ms ("
+            << (scalarTime / vectorTime) << "x)\n";
+
+  delete [] x;
+  delete [] y;
+  delete [] y4;
+
+  scalarPoly.free();
+  vectorPoly.free();
+
+  o_x.free();
+  o_y.free();
+  o_y4.free();
+
+  device.free();
+
+  return 0;
+}
@@ -136,6 +136,9 @@ namespace occa {
   template <>
   void kernel_t<CUDA>::runFromArguments(const int kArgc, const kernelArg *kArgs);
 
+  template <>
+  void kernel_t<CUDA>::runFromBoundArguments();
+
   template <>
   void kernel_t<CUDA>::free();
   //==================================
@@ -73,7 +73,8 @@ namespace occa {
                                 const std::string &functionName,
                                 const std::string &flags = "",
                                 const std::string &hash = "",
-                                const std::string &sourceFile = "");
+                                const std::string &sourceFile = "",
+                                const bool verbose = true);
 
     void buildKernelFromBinary(OpenCLKernelData_t &data_,
                                const unsigned char *content,
@@ -143,6 +144,9 @@ namespace occa {
   template <>
   void kernel_t<OpenCL>::runFromArguments(const int kArgc, const kernelArg *kArgs);
 
+  template <>
+  void kernel_t<OpenCL>::runFromBoundArguments();
+
   template <>
   void kernel_t<OpenCL>::free();
   //==================================
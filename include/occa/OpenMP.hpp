@@ -87,6 +87,9 @@ namespace occa {
   template <>
   void kernel_t<OpenMP>::runFromArguments(const int kArgc, const kernelArg *kArgs);
 
+  template <>
+  void kernel_t<OpenMP>::runFromBoundArguments();
+
   template <>
   void kernel_t<OpenMP>::free();
   //==================================
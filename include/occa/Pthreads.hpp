@@ -16,36 +16,148 @@
 #include <string.h>
 #include <fcntl.h>
 
-#include <queue>
-
 #include "occa/base.hpp"
 #include "occa/library.hpp"
+#include "occa/Serial.hpp"
 
 namespace occa {
   //---[ Data Structs ]-----------------
   struct PthreadKernelInfo_t;
+  struct PthreadWorkerData_t;
   typedef void (*PthreadLaunchHandle_t)(PthreadKernelInfo_t &args);
 
-  // [-] Hard-coded for now
+  // Hybrid spin-then-park wait point shared by the host and its workers
+  struct PthreadSignal_t {
+    // [us] Time spent spinning before parking, (-1) spins forever
+    int spinTime;
+
+    volatile unsigned int parked;
+
+    mutex_t mutex;
+    condition_t cond;
+  };
+
+  static const int pthreadRingSize = 64;
+
+  // Tags are recycled after this many newer tags on the same device
+  static const int pthreadTagPoolSize = 8192;
+
+  // Launches in a stream run in order, launches in different
+  //   streams only share the worker rings
+  struct PthreadStream_t {
+    // [launchedJobs] is only written by the host, [finishedJobs] by the workers
+    unsigned int launchedJobs;
+    volatile unsigned int finishedJobs;
+  };
+
+  // Device-owned, streamTag::handle holds the tag's [id] and the
+  //   record is [tags[id % pthreadTagPoolSize]] until it's recycled
+  struct PthreadTag_t {
+    uintptr_t id;
+
+    // Rank 0 stamps [time] and sets [reached] once every job before
+    //   the tag in its stream is done
+    double time;
+    volatile unsigned int reached;
+  };
+
+  // How the flattened outer loops are split between the workers
+  namespace pthreadSchedule {
+    static const int staticChunks  = 0; // One contiguous chunk per worker
+    static const int dynamicChunks = 1; // Workers grab [chunkSize] iterations at a time
+    static const int stealChunks   = 2; // Static chunks, idle workers steal from the rest
+  }
+
+  // Packed [start, end) range of a worker, padded to a cache line
+  struct PthreadRange_t {
+    volatile uint64_t range;
+    char padding[64 - sizeof(uint64_t)];
+  };
+
+  namespace pthreadLaunch {
+    static const int kernel = 0;
+    static const int marker = 1;
+    static const int copy   = 2;
+  }
+
+  // Packed once per launch and shared by every worker
+  struct PthreadLaunch_t {
+    int type;
+    PthreadStream_t *stream;
+
+    //---[ Kernel ]-----------
+    handleFunction_t kernelHandle;
+
+    int dims;
+    occa::dim inner, outer;
+
+    int argc;
+    void *args[2*OCCA_MAX_ARGS];
+
+    // Scalars are copied in since the kernel's own argument storage
+    //   can be overwritten before the queued launch runs
+    kernelArgData_t argData[2*OCCA_MAX_ARGS];
+
+    int schedule, chunkSize;
+    volatile unsigned int nextChunk;
+
+    // One range per worker, allocated with the slot
+    PthreadRange_t *ranges;
+
+    //---[ Marker ]-----------
+    PthreadTag_t *tag;
+
+    //---[ Copy ]-------------
+    void *dest;
+    const void *src;
+    uintptr_t bytes;
+  };
+
+  struct PthreadKernelInfo_t {
+    int rank, count;
+
+    // Wait for the stream's [finishedJobs] to reach [startAfter] before running
+    unsigned int startAfter;
+
+    // NULL launches tell the worker to exit
+    PthreadLaunch_t *launch;
+  };
+
   struct PthreadsDeviceData_t {
     int vendor;
 
     int coreCount;
 
     int pThreadCount;
+
+    // Thread placement: compact, scatter, numa or manual
     int schedule;
 
+    // Default outer-loop schedule, (0) chunk sizes are picked at launch
+    int loopSchedule, chunkSize;
+
 #if (OCCA_OS & (LINUX_OS | OSX_OS))
-    pthread_t tid[50];
+    std::vector<pthread_t> tid;
 #else
-    DWORD tid[50];
+    std::vector<DWORD> tid;
 #endif
 
-    int pendingJobs;
+    std::vector<PthreadWorkerData_t*> workers;
+
+    // Launch [n] uses [launches[n % pthreadRingSize]], slots are
+    //   free again once every worker ring moved past them
+    unsigned int launchCount;
+    PthreadLaunch_t launches[pthreadRingSize];
+
+    // Counts jobs from every stream, [finishedJobs] is only updated by the workers
+    unsigned int launchedJobs;
+    volatile unsigned int finishedJobs;
 
-    std::queue<PthreadKernelInfo_t*> pKernelInfo[50];
+    PthreadSignal_t signal;
 
-    mutex_t pendingJobsMutex, kernelMutex;
+    // Tag [n] uses [tags[n % pthreadTagPoolSize]], (0) is never handed out
+    uintptr_t tagCount;
+    PthreadTag_t *tags;
   };
 
   struct PthreadsKernelData_t {
@@ -53,39 +165,41 @@ namespace occa {
     handleFunction_t handle;
 
     int pThreadCount;
-    int *pendingJobs;
 
-    std::queue<PthreadKernelInfo_t*> *pKernelInfo[50];
+    // (-1) uses the device defaults
+    int loopSchedule, chunkSize;
 
-    mutex_t *pendingJobsMutex, *kernelMutex;
+    PthreadsDeviceData_t *dData;
   };
 
   struct PthreadWorkerData_t {
     int rank, count;
-    int pinnedCore;
+    int pinnedCore, socket, numaNode;
 
-    int *pendingJobs;
+    // Single-producer/single-consumer ring
+    //   [head] is only written by the host, [tail] by the worker
+    volatile unsigned int head, tail;
+    PthreadKernelInfo_t ring[pthreadRingSize];
 
-    std::queue<PthreadKernelInfo_t*> *pKernelInfo;
+    PthreadsDeviceData_t *dData;
 
-    mutex_t *pendingJobsMutex, *kernelMutex;
+    // Only written by the worker
+    int jobsRun, timesParked;
+    double activeTime, idleTime;
   };
 
-  struct PthreadKernelInfo_t {
-    int rank, count;
-
-    handleFunction_t kernelHandle;
-
-    int dims;
-    occa::dim inner, outer;
-
-    int argc;
-    void **args;
+  struct PthreadWorkerStats_t {
+    int rank, pinnedCore, socket, numaNode;
+    int jobsRun, timesParked;
+    double activeTime, idleTime;
   };
 
   static const int compact = (1 << 10);
   static const int scatter = (1 << 11);
   static const int manual  = (1 << 12);
+  static const int numa    = (1 << 13);
+
+  static const int defaultSpinTime = 100; // [us]
   //====================================
 
 
@@ -93,6 +207,73 @@ namespace occa {
   namespace pthreads {
     void* limbo(void *args);
     void run(PthreadKernelInfo_t &pArgs);
+
+    // Runs the flattened outer iterations [start, end)
+    void runRange(PthreadLaunch_t &launch,
+                  const int start, const int end);
+
+    int scheduleFromString(const std::string &schedule);
+
+    // Picks a processor for each thread
+    //   compact: fill a socket's cores (and their SMT siblings) first
+    //   scatter: round-robin over sockets, physical cores before siblings
+    //   numa   : round-robin over NUMA nodes, physical cores before siblings
+    void getPlacement(std::vector<cpu::processorInfo_t> procs,
+                      const int schedule,
+                      const int threadCount,
+                      std::vector<cpu::processorInfo_t> &placement);
+
+    // Overrides the device schedule for [k] and its nested kernels,
+    //   a (0) chunk size is picked at launch
+    void setSchedule(occa::kernel k,
+                     const std::string &schedule,
+                     const int chunkSize);
+
+    // Returns the time spent waiting
+    double waitFor(PthreadSignal_t &signal,
+                   volatile unsigned int *counter,
+                   const unsigned int target,
+                   int *timesParked = NULL);
+
+    void notify(PthreadSignal_t &signal);
+
+    // Blocks while the worker's ring is full
+    void waitForRingSlot(PthreadsDeviceData_t &dData,
+                         const int rank);
+
+    void pushJob(PthreadsDeviceData_t &dData,
+                 const int rank,
+                 const unsigned int startAfter,
+                 PthreadLaunch_t *launch);
+
+    // NULL once the tag's record was recycled
+    PthreadTag_t* findTag(PthreadsDeviceData_t &dData, const streamTag &tag);
+
+    // Returns the next launch slot once every ring has room for it
+    PthreadLaunch_t& nextLaunch(PthreadsDeviceData_t &dData);
+
+    // Flattens [kArgs] into [launch], copying scalars by value
+    void setLaunchArgs(PthreadLaunch_t &launch,
+                       const int kArgc, const kernelArg *kArgs);
+
+    // Picks the loop schedule and chunking for a kernel launch
+    void scheduleLaunch(PthreadsKernelData_t &data_,
+                        PthreadsDeviceData_t &dData,
+                        PthreadLaunch_t &launch);
+
+    // Hands [launch] to every worker in order on [stream]
+    void pushLaunch(PthreadsDeviceData_t &dData,
+                    PthreadStream_t &stream,
+                    PthreadLaunch_t &launch);
+
+    // A NULL [src] zeroes [dest] instead
+    void enqueueCopy(PthreadsDeviceData_t &dData,
+                     PthreadStream_t &stream,
+                     void *dest, const void *src,
+                     const uintptr_t bytes);
+
+    std::vector<PthreadWorkerStats_t> getWorkerStats(occa::device d);
+    void printWorkerStats(occa::device d);
   }
   //====================================
 
@@ -144,6 +325,9 @@ namespace occa {
   template <>
   void kernel_t<Pthreads>::runFromArguments(const int kArgc, const kernelArg *kArgs);
 
+  template <>
+  void kernel_t<Pthreads>::runFromBoundArguments();
+
   template <>
   void kernel_t<Pthreads>::free();
   //====================================
@@ -42,6 +42,14 @@ namespace occa {
 
   //---[ Helper Functions ]-----------
   namespace cpu {
+    // Set through the [memPlacement] and [memNode] device properties
+    namespace memPlacement {
+      static const int none       = 0; // Pages land wherever they are first touched
+      static const int firstTouch = 1; // Workers touch their static share of the pages
+      static const int interleave = 2; // Pages go round-robin over the NUMA nodes
+      static const int bound      = 3; // Pages are bound to [memNode]
+    }
+
     namespace vendor {
       static const int notFound     = 0;
 
@@ -98,6 +106,26 @@ namespace occa {
     std::string getCPUINFOField(const std::string &field,
 				bool ignoreCase = false);
 
+    // Logical processor as seen by the OS
+    struct processorInfo_t {
+      int id;
+      int core, socket, numaNode;
+
+      // Position among the SMT siblings of its core
+      int smtIndex;
+    };
+
+    // Parses sysfs cpu lists such as "0-3,8,10-11"
+    void parseCpuList(const std::string &list, std::vector<int> &ids);
+
+    ///
+    /// Online logical processors ordered by id.
+    ///
+    /// Read from sysfs on Linux, other OSes report every
+    /// processor as its own core on socket and node 0.
+    ///
+    void getTopology(std::vector<processorInfo_t> &procs);
+
     std::string getProcessorName();
     int getCoreCount();
     int getProcessorFrequency();
@@ -118,6 +146,25 @@ namespace occa {
     void* malloc(uintptr_t bytes);
     void free(void *ptr);
 
+    uintptr_t pageSize();
+
+    int getMemPlacement(argInfoMap &properties, int &node);
+
+    // Page-aligned if [placement] is set, interleaved and bound
+    //   policies are applied before returning
+    void* malloc(uintptr_t bytes,
+                 const int placement, const int node);
+
+    // Moves pages that were already touched, no-op outside Linux
+    void setMemPolicy(void *ptr, uintptr_t bytes,
+                      const int placement, const int node);
+
+    // [rank]'s share of [bytes] at page granularity, proportional
+    //   like the static kernel schedule
+    void getPageRange(const uintptr_t bytes,
+                      const int rank, const int count,
+                      uintptr_t &start, uintptr_t &end);
+
     void* dlopen(const std::string &filename,
                  const std::string &hash = "");
 
@@ -125,6 +172,10 @@ namespace occa {
                            const std::string &functionName,
                            const std::string &hash = "");
 
+    // Exposes a library's [uint64 bytes][shared object] image as a
+    //   file dlopen() can load, each image is only written once
+    std::string libraryImageFilename(const char *cache);
+
     void runFunction(handleFunction_t f,
                      const int *occaKernelInfoArgs,
                      int occaInnerId0, int occaInnerId1, int occaInnerId2,
@@ -177,6 +228,9 @@ namespace occa {
   template <>
   void kernel_t<Serial>::runFromArguments(const int kArgc, const kernelArg *kArgs);
 
+  template <>
+  void kernel_t<Serial>::runFromBoundArguments();
+
   template <>
   void kernel_t<Serial>::free();
   //==================================
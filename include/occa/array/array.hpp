@@ -2,6 +2,7 @@
 #define OCCA_ARRAY_HEADER
 
 #include "occa/base.hpp"
+#include "occa/miniLib.hpp"
 
 namespace occa {
   typedef uintptr_t dim_t;
@@ -218,6 +219,21 @@ namespace occa {
     void sync();
     void dontSync();
   };
+
+  //---[ Reductions ]-----------------
+  template <class TM, const int idxType>
+  inline TM reduce(array<TM,idxType> &in,
+                   const std::string &op) {
+    return reduce<TM>(in.memory, op, in.entries());
+  }
+
+  template <class TM, const int idxType, const int idxType2>
+  inline void scan(array<TM,idxType> &in,
+                   array<TM,idxType2> &out,
+                   const std::string &op) {
+    scan<TM>(in.memory, out.memory, op, in.entries());
+  }
+  //==================================
 }
 
 #include "occa/array/array.tpp"
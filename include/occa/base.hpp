@@ -70,6 +70,27 @@ namespace occa {
   class deviceInfo;
   class kernelDatabase;
 
+  struct kernelBuild_t;
+  struct kernelSpecialization_t;
+
+  namespace pthreads {
+    void setSchedule(occa::kernel k,
+                     const std::string &schedule,
+                     const int chunkSize = 0);
+  }
+
+  namespace library {
+    void cacheCpuKernel(occa::device_v *dHandle,
+                        const std::string &filename,
+                        const std::string &functionName,
+                        const kernelInfo &info);
+
+    occa::kernel loadCpuKernel(occa::device_v *dHandle,
+                               const char *contents,
+                               const uint64_t contentBytes,
+                               const std::string &kernelName);
+  }
+
   //---[ Typedefs ]-----------------------
   typedef std::vector<int>          intVector_t;
   typedef std::vector<intVector_t>  intVecVector_t;
@@ -90,6 +111,10 @@ namespace occa {
 
   void setVerboseCompilation(const bool value);
 
+  // Bounds device::buildKernelAsync(), [0] uses [OCCA_MAX_BUILDS]
+  //   or the core count
+  void setMaxConcurrentBuilds(const int count);
+
   namespace flags {
     extern const int checkCacheDir;
   }
@@ -382,6 +407,20 @@ namespace occa {
     friend class occa::kernel;
     friend class occa::device;
 
+    friend void pthreads::setSchedule(occa::kernel k,
+                                      const std::string &schedule,
+                                      const int chunkSize);
+
+    friend void library::cacheCpuKernel(occa::device_v *dHandle,
+                                        const std::string &filename,
+                                        const std::string &functionName,
+                                        const kernelInfo &info);
+
+    friend occa::kernel library::loadCpuKernel(occa::device_v *dHandle,
+                                               const char *contents,
+                                               const uint64_t contentBytes,
+                                               const std::string &kernelName);
+
   private:
     std::string strMode;
 
@@ -396,15 +435,37 @@ namespace occa {
     uintptr_t maximumInnerDimSize_;
     int preferredDimSize_;
 
+    double buildTime_;
+
     int dims;
     dim inner, outer;
 
     std::vector<kernel> nestedKernels;
     std::vector<kernelArg> arguments;
 
+    //---[ Bound Arguments ]----------
+    // Set by kernel::setArgument(), the nested kernels are kept at [0]
+    std::vector<kernelArg> boundArguments;
+    std::vector<char> boundArgChanged;
+
+    // Flattened ptr() of [boundArguments] and where each one starts,
+    //   repacked only when an argument's storage or argc changes
+    std::vector<void*> boundArgPtrs;
+    std::vector<int> boundArgOffsets;
+    bool boundArgsPacked;
+    //================================
+
+    // Set when the kernelInfo asked for specialized variants
+    kernelSpecialization_t *spec;
+
   public:
     virtual occa::mode mode() = 0;
 
+    inline kernel_v() :
+      buildTime_(0),
+      boundArgsPacked(false),
+      spec(NULL) {}
+
     virtual inline ~kernel_v() {}
 
     virtual void* getKernelHandle() = 0;
@@ -428,10 +489,25 @@ namespace occa {
     kernelArg* argumentsPtr();
     int argumentCount();
 
+    void packBoundArguments();
+    void markBoundArgumentsChanged();
+
+    void setupSpecialization(device_v *dHandle_,
+                             const std::string &filename,
+                             const std::string &functionName,
+                             const kernelInfo &info,
+                             const bool usesArgs);
+
+    // Returns NULL when the generic kernel should run
+    kernel_v* specializedVariant();
+
+    void freeSpecialization();
+
     virtual uintptr_t maximumInnerDimSize() = 0;
     virtual int preferredDimSize() = 0;
 
     virtual void runFromArguments(const int kArgc, const kernelArg *kArgs) = 0;
+    virtual void runFromBoundArguments() = 0;
 
     virtual void free() = 0;
   };
@@ -472,6 +548,7 @@ namespace occa {
     int preferredDimSize();
 
     void runFromArguments(const int kArgc, const kernelArg *kArgs);
+    void runFromBoundArguments();
 
     void free();
   };
@@ -479,8 +556,21 @@ namespace occa {
   class kernel {
     friend class occa::device;
 
+    friend void library::cacheCpuKernel(occa::device_v *dHandle,
+                                        const std::string &filename,
+                                        const std::string &functionName,
+                                        const kernelInfo &info);
+
+    friend occa::kernel library::loadCpuKernel(occa::device_v *dHandle,
+                                               const char *contents,
+                                               const uint64_t contentBytes,
+                                               const std::string &kernelName);
+
   private:
-    kernel_v *kHandle;
+    // Kernels from device::buildKernelAsync() get their [kHandle]
+    //   once [bHandle] finishes building
+    mutable kernel_v *kHandle;
+    mutable kernelBuild_t *bHandle;
 
   public:
     kernel();
@@ -491,6 +581,12 @@ namespace occa {
 
     void checkIfInitialized() const;
 
+    bool isReady();
+    void waitForBuild() const;
+
+    // Seconds spent parsing and compiling the kernel
+    double buildTime();
+
     void* getKernelHandle();
     void* getProgramHandle();
 
@@ -515,6 +611,14 @@ namespace occa {
 
     void runFromArguments();
 
+    // Bound arguments stay set between launch() calls, only the ones
+    //   that change need to be set again. Arguments passed by reference
+    //   (non-scalar, non-memory) must outlive the launches using them
+    void setArgument(const int argPos,
+                     const kernelArg &arg);
+
+    void launch();
+
 #include "occa/operators/declarations.hpp"
 
     void free();
@@ -550,6 +654,18 @@ namespace occa {
 
     // #include "occa/operators/declarations.hpp"
   };
+
+  // device::buildKernelFromSource() memoizes the binaries of kernels per
+  //   device, checking the source file's size and mtime on every hit.
+  //   Each hit still returns its own kernel.
+  struct kernelMemoStats_t {
+    int hits, misses;
+
+    // Misses caused by a changed source file
+    int invalidated;
+  };
+
+  kernelMemoStats_t getKernelMemoStats();
   //==============================================
 
 
@@ -1305,6 +1421,11 @@ namespace occa {
       return TM();
     }
 
+    template <class TM>
+    void setProperty(const std::string &prop, const TM &value) {
+      dHandle->properties.set(prop, value);
+    }
+
     void setCompiler(const std::string &compiler_);
     void setCompilerEnvScript(const std::string &compilerEnvScript_);
     void setCompilerFlags(const std::string &compilerFlags_);
@@ -1343,9 +1464,19 @@ namespace occa {
                                  const std::string &functionName,
                                  const kernelInfo &info_ = defaultKernelInfo);
 
+    // Parses [filename] once and compiles it once for all [functionNames]
+    std::vector<kernel> buildKernelsFromSource(const std::string &filename,
+                                               const std::vector<std::string> &functionNames,
+                                               const kernelInfo &info_ = defaultKernelInfo);
+
     kernel buildKernelFromBinary(const std::string &filename,
                                  const std::string &functionName);
 
+    // Builds in the background, the kernel blocks on its first use
+    kernel buildKernelAsync(const std::string &filename,
+                            const std::string &functionName,
+                            const kernelInfo &info_ = defaultKernelInfo);
+
     void cacheKernelInLibrary(const std::string &filename,
                               const std::string &functionName,
                               const kernelInfo &info_ = defaultKernelInfo);
@@ -1461,9 +1592,17 @@ namespace occa {
                                const std::string &functionName,
                                const kernelInfo &info_ = defaultKernelInfo);
 
+  std::vector<kernel> buildKernelsFromSource(const std::string &filename,
+                                             const std::vector<std::string> &functionNames,
+                                             const kernelInfo &info_ = defaultKernelInfo);
+
   kernel buildKernelFromBinary(const std::string &filename,
                                const std::string &functionName);
 
+  kernel buildKernelAsync(const std::string &filename,
+                          const std::string &functionName,
+                          const kernelInfo &info_ = defaultKernelInfo);
+
   void cacheKernelInLibrary(const std::string &filename,
                             const std::string &functionName,
                             const kernelInfo &info_ = defaultKernelInfo);
@@ -1656,6 +1795,14 @@ namespace occa {
 
     flags_t parserFlags;
 
+    // Set by specializeArgument() and specializeInnerDims()
+    std::vector<int> specializedArgs;
+    bool specializedInnerDims;
+    int maxSpecializations;
+
+    // Set by hideCompilation()
+    bool quietCompilation;
+
     kernelInfo();
 
     kernelInfo(const kernelInfo &p);
@@ -1698,6 +1845,25 @@ namespace occa {
 
     void addParserFlag(const std::string &flag,
                        const std::string &value = "");
+
+    // Launches recompile the kernel with the argument's value baked in,
+    //   variants are cached by value. Only parsed kernels (OKL/OFL)
+    //   can specialize arguments
+    void specializeArgument(const int argPos);
+
+    // Same as specializeArgument() for the inner dimensions
+    void specializeInnerDims();
+
+    // Launches past the last variant run the generic kernel
+    void setMaxSpecializations(const int count);
+
+    bool hasSpecializations() const;
+
+    // Skips this kernel's compilation output without touching
+    //   the process-wide setVerboseCompilation()
+    void hideCompilation();
+
+    bool showsCompilation() const;
   };
 
   template <> void kernelInfo::addDefine(const std::string &macro, const std::string &value);
@@ -73,6 +73,33 @@ typedef struct occaArgumentList_t* occaArgumentList;
 
 struct occaType_t;
 
+// Scalars held by value, kernels take their address in place of an
+//   occaType. Nothing is allocated or freed for them
+typedef struct occaScalar_t {
+  struct occaType_t *ptr; // Always NULL, tells scalars apart from occaType
+  int type;
+  uintptr_t bytes;
+
+  union {
+    int int_;
+    unsigned int uint_;
+
+    char char_;
+    unsigned char uchar_;
+
+    short short_;
+    unsigned short ushort_;
+
+    long long_;
+    unsigned long ulong_;
+
+    float float_;
+    double double_;
+
+    void *void_;
+  } value;
+} occaScalar;
+
 typedef void* occaStream;
 
 typedef struct occaStreamTag_t {
@@ -122,6 +149,21 @@ OCCA_LFUNC occaType OCCA_RFUNC occaDouble(double value);
 OCCA_LFUNC occaType OCCA_RFUNC occaStruct(void *value, uintptr_t bytes);
 
 OCCA_LFUNC occaType OCCA_RFUNC occaString(const char *str);
+
+OCCA_LFUNC occaScalar OCCA_RFUNC occaIntScalar(int value);
+OCCA_LFUNC occaScalar OCCA_RFUNC occaUIntScalar(unsigned int value);
+
+OCCA_LFUNC occaScalar OCCA_RFUNC occaCharScalar(char value);
+OCCA_LFUNC occaScalar OCCA_RFUNC occaUCharScalar(unsigned char value);
+
+OCCA_LFUNC occaScalar OCCA_RFUNC occaShortScalar(short value);
+OCCA_LFUNC occaScalar OCCA_RFUNC occaUShortScalar(unsigned short value);
+
+OCCA_LFUNC occaScalar OCCA_RFUNC occaLongScalar(long value);
+OCCA_LFUNC occaScalar OCCA_RFUNC occaULongScalar(unsigned long value);
+
+OCCA_LFUNC occaScalar OCCA_RFUNC occaFloatScalar(float value);
+OCCA_LFUNC occaScalar OCCA_RFUNC occaDoubleScalar(double value);
 //====================================
 
 
@@ -318,6 +360,8 @@ OCCA_LFUNC void OCCA_RFUNC occaArgumentListClear(occaArgumentList list);
 
 OCCA_LFUNC void OCCA_RFUNC occaArgumentListFree(occaArgumentList list);
 
+// [type] is an occaMemory, an occaType (the list takes it over) or
+//   the address of an occaScalar (copied into the list)
 OCCA_LFUNC void OCCA_RFUNC occaArgumentListAddArg(occaArgumentList list,
                                                   int argPos,
                                                   void *type);
@@ -382,6 +426,8 @@ OCCA_LFUNC occaMemory OCCA_RFUNC occaDeviceWrapMemory(occaDevice device,
 //---[ Memory ]-----------------------
 OCCA_LFUNC const char* OCCA_RFUNC occaMemoryMode(occaMemory memory);
 
+OCCA_LFUNC uintptr_t OCCA_RFUNC occaMemoryBytes(occaMemory memory);
+
 OCCA_LFUNC void* OCCA_RFUNC occaMemoryGetMemoryHandle(occaMemory mem);
 OCCA_LFUNC void* OCCA_RFUNC occaMemoryGetMappedPointer(occaMemory mem);
 OCCA_LFUNC void* OCCA_RFUNC occaMemoryGetTextureHandle(occaMemory mem);
@@ -415,6 +461,7 @@ OCCA_LFUNC void OCCA_RFUNC occaAsyncCopyMemToPtr(void *dest, occaMemory src,
                                                  const uintptr_t bytes, const uintptr_t offset);
 
 OCCA_LFUNC void OCCA_RFUNC occaMemoryFree(occaMemory memory);
+OCCA_LFUNC void OCCA_RFUNC occaMemoryDetach(occaMemory memory);
 //====================================
 
 OCCA_END_EXTERN_C
@@ -66,6 +66,12 @@
 #  define OCCA_INLINE __forceinline
 #endif
 
+#if   (OCCA_OS == LINUX_OS) || (OCCA_OS == OSX_OS)
+#  define OCCA_NORETURN __attribute__ ((noreturn))
+#elif (OCCA_OS == WINDOWS_OS)
+#  define OCCA_NORETURN __declspec(noreturn)
+#endif
+
 #if defined __arm__
 #  define OCCA_ARM 1
 #else
@@ -95,7 +101,16 @@
 
 //---[ Checks and Info ]----------------
 #ifndef OCCA_COMPILED_FOR_JULIA
-#  define OCCA_THROW abort()
+#  ifdef __cplusplus
+namespace occa {
+  // Aborts, or throws on kernel build threads so the failure
+  //   is reported by the kernel's waitForBuild()
+  OCCA_NORETURN void failCheck();
+}
+#    define OCCA_THROW occa::failCheck()
+#  else
+#    define OCCA_THROW abort()
+#  endif
 #else
 #  define OCCA_THROW exit(1)
 #endif
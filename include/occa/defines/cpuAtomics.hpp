@@ -0,0 +1,221 @@
+#ifndef OCCA_CPU_ATOMICS_HEADER
+#define OCCA_CPU_ATOMICS_HEADER
+
+// Atomics shared by the threaded CPU modes (OpenMP, Pthreads)
+//   Integer ops map to single fetch-and-op instructions, everything
+//   else (floating point, min/max) retries a compare-and-swap
+
+#if defined(__GNUC__) || defined(__clang__)
+
+//---[ Helpers ]----------------------------------
+#define OCCA_ATOMIC_ORDER __ATOMIC_RELAXED
+
+namespace occa {
+  namespace cpuAtomic {
+    struct add { template <class TM> static inline TM apply(const TM &a, const TM &b){ return (a + b); } };
+    struct sub { template <class TM> static inline TM apply(const TM &a, const TM &b){ return (a - b); } };
+    struct min { template <class TM> static inline TM apply(const TM &a, const TM &b){ return ((b < a) ? b : a); } };
+    struct max { template <class TM> static inline TM apply(const TM &a, const TM &b){ return ((a < b) ? b : a); } };
+
+    // Retries [*ptr = OP(*ptr, update)] until no other thread got in between
+    template <class OP, class TM>
+    inline TM casLoop(TM *ptr, const TM &update){
+      TM old, next;
+      __atomic_load(ptr, &old, OCCA_ATOMIC_ORDER);
+
+      do {
+        next = OP::apply(old, update);
+      } while(!__atomic_compare_exchange(ptr, &old, &next,
+                                         true,
+                                         OCCA_ATOMIC_ORDER, OCCA_ATOMIC_ORDER));
+
+      return old;
+    }
+
+    // Min/max skip the write when [*ptr] already wins, which is
+    //   the common case once a contended value settles
+    template <class OP, class TM>
+    inline TM casLoopIfChanged(TM *ptr, const TM &update){
+      TM old, next;
+      __atomic_load(ptr, &old, OCCA_ATOMIC_ORDER);
+
+      while(true){
+        next = OP::apply(old, update);
+
+        if(!(next < old) && !(old < next))
+          return old;
+
+        if(__atomic_compare_exchange(ptr, &old, &next,
+                                     true,
+                                     OCCA_ATOMIC_ORDER, OCCA_ATOMIC_ORDER))
+          return old;
+      }
+    }
+  }
+}
+//================================================
+
+
+//---[ Atomics ]----------------------------------
+template <class TM>
+inline TM occaAtomicAdd(TM *ptr, const TM &update){
+  return __atomic_fetch_add(ptr, update, OCCA_ATOMIC_ORDER);
+}
+
+inline float occaAtomicAdd(float *ptr, const float &update){
+  return occa::cpuAtomic::casLoop<occa::cpuAtomic::add>(ptr, update);
+}
+
+inline double occaAtomicAdd(double *ptr, const double &update){
+  return occa::cpuAtomic::casLoop<occa::cpuAtomic::add>(ptr, update);
+}
+
+template <class TM>
+inline TM occaAtomicSub(TM *ptr, const TM &update){
+  return __atomic_fetch_sub(ptr, update, OCCA_ATOMIC_ORDER);
+}
+
+inline float occaAtomicSub(float *ptr, const float &update){
+  return occa::cpuAtomic::casLoop<occa::cpuAtomic::sub>(ptr, update);
+}
+
+inline double occaAtomicSub(double *ptr, const double &update){
+  return occa::cpuAtomic::casLoop<occa::cpuAtomic::sub>(ptr, update);
+}
+
+template <class TM>
+inline TM occaAtomicSwap(TM *ptr, const TM &update){
+  TM old, next = update;
+  __atomic_exchange(ptr, &next, &old, __ATOMIC_SEQ_CST);
+
+  return old;
+}
+
+template <class TM>
+inline TM occaAtomicInc(TM *ptr){
+  return occaAtomicAdd(ptr, (TM) 1);
+}
+
+template <class TM>
+inline TM occaAtomicDec(TM *ptr, const TM &update){
+  return occaAtomicSub(ptr, (TM) 1);
+}
+
+template <class TM>
+inline TM occaAtomicMin(TM *ptr, const TM &update){
+  return occa::cpuAtomic::casLoopIfChanged<occa::cpuAtomic::min>(ptr, update);
+}
+
+template <class TM>
+inline TM occaAtomicMax(TM *ptr, const TM &update){
+  return occa::cpuAtomic::casLoopIfChanged<occa::cpuAtomic::max>(ptr, update);
+}
+
+template <class TM>
+inline TM occaAtomicAnd(TM *ptr, const TM &update){
+  return __atomic_fetch_and(ptr, update, OCCA_ATOMIC_ORDER);
+}
+
+template <class TM>
+inline TM occaAtomicOr(TM *ptr, const TM &update){
+  return __atomic_fetch_or(ptr, update, OCCA_ATOMIC_ORDER);
+}
+
+template <class TM>
+inline TM occaAtomicXor(TM *ptr, const TM &update){
+  return __atomic_fetch_xor(ptr, update, OCCA_ATOMIC_ORDER);
+}
+
+// Stores [update] if [*ptr == comp], returns the previous value
+template <class TM>
+inline TM occaAtomicCAS(TM *ptr, const TM &comp, const TM &update){
+  TM old = comp, next = update;
+  __atomic_compare_exchange(ptr, &old, &next,
+                            false,
+                            __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST);
+
+  return old;
+}
+//================================================
+
+#else
+
+//---[ Atomics ]----------------------------------
+// No builtins, every atomic goes through one critical section
+//   (only OpenMP can provide it)
+#define OCCA_ATOMIC_UPDATE(UPDATE)              \
+  TM old;                                       \
+  OCCA_PRAGMA("omp critical(occaAtomic)")       \
+  {                                             \
+    old = *ptr;                                 \
+    UPDATE;                                     \
+  }                                             \
+  return old
+
+template <class TM>
+TM occaAtomicAdd(TM *ptr, const TM &update){
+  OCCA_ATOMIC_UPDATE(*ptr += update);
+}
+
+template <class TM>
+TM occaAtomicSub(TM *ptr, const TM &update){
+  OCCA_ATOMIC_UPDATE(*ptr -= update);
+}
+
+template <class TM>
+TM occaAtomicSwap(TM *ptr, const TM &update){
+  OCCA_ATOMIC_UPDATE(*ptr = update);
+}
+
+template <class TM>
+TM occaAtomicInc(TM *ptr){
+  OCCA_ATOMIC_UPDATE(++(*ptr));
+}
+
+template <class TM>
+TM occaAtomicDec(TM *ptr, const TM &update){
+  OCCA_ATOMIC_UPDATE(--(*ptr));
+}
+
+template <class TM>
+TM occaAtomicMin(TM *ptr, const TM &update){
+  OCCA_ATOMIC_UPDATE(*ptr = ((old < update) ? old : update));
+}
+
+template <class TM>
+TM occaAtomicMax(TM *ptr, const TM &update){
+  OCCA_ATOMIC_UPDATE(*ptr = ((old < update) ? update : old));
+}
+
+template <class TM>
+TM occaAtomicAnd(TM *ptr, const TM &update){
+  OCCA_ATOMIC_UPDATE(*ptr &= update);
+}
+
+template <class TM>
+TM occaAtomicOr(TM *ptr, const TM &update){
+  OCCA_ATOMIC_UPDATE(*ptr |= update);
+}
+
+template <class TM>
+TM occaAtomicXor(TM *ptr, const TM &update){
+  OCCA_ATOMIC_UPDATE(*ptr ^= update);
+}
+
+template <class TM>
+TM occaAtomicCAS(TM *ptr, const TM &comp, const TM &update){
+  OCCA_ATOMIC_UPDATE(if(old == comp) *ptr = update);
+}
+
+#undef OCCA_ATOMIC_UPDATE
+//================================================
+
+#endif
+
+#define occaAtomicAdd64  occaAtomicAdd
+#define occaAtomicSub64  occaAtomicSub
+#define occaAtomicSwap64 occaAtomicSwap
+#define occaAtomicInc64  occaAtomicInc
+#define occaAtomicDec64  occaAtomicDec
+
+#endif
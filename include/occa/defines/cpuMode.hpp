@@ -73,6 +73,20 @@
 #define occaInnerFor occaInnerFor2 occaInnerFor1 occaInnerFor0
 // - - - - - - - - - - - - - - - - - - - - - - - -
 #define occaGlobalFor0 occaOuterFor0 occaInnerFor0
+// - - - - - - - - - - - - - - - - - - - - - - - -
+// Placed before inner loops the parser found to be free of
+//   cross-iteration dependencies (parser flag: simd-inner-loops)
+#if defined(_OPENMP) && (_OPENMP >= 201307)
+#  define occaSimdFor0 OCCA_PRAGMA("omp simd")
+#elif defined(__INTEL_COMPILER)
+#  define occaSimdFor0 OCCA_PRAGMA("ivdep")
+#elif defined(__clang__)
+#  define occaSimdFor0 OCCA_PRAGMA("clang loop vectorize(assume_safety)")
+#elif defined(__GNUC__) && ((4 < __GNUC__) || ((__GNUC__ == 4) && (9 <= __GNUC_MINOR__)))
+#  define occaSimdFor0 OCCA_PRAGMA("GCC ivdep")
+#else
+#  define occaSimdFor0
+#endif
 //================================================
 
 
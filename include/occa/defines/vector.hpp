@@ -16,6 +16,18 @@
 namespace occa {
 #  endif
 
+// CPU modes back vector types with compiler vector extensions
+//   Alignment is capped at 16 bytes, what malloc/new already give
+#if ((defined(__GNUC__) || defined(__clang__)) && !defined(__CUDACC__) && \
+     (!defined(OCCA_IN_KERNEL) || OCCA_USING_CPU))
+#  define OCCA_VECTOR_EXTENSIONS 1
+#  define OCCA_VECTOR_EXT_TYPE(TYPE, N)                                   \
+  TYPE __attribute__((vector_size(N * sizeof(TYPE)),                    \
+                      aligned(((N * sizeof(TYPE)) < 16) ? (N * sizeof(TYPE)) : 16)))
+#else
+#  define OCCA_VECTOR_EXTENSIONS 0
+#endif
+
 //---[ bool2 ]--------------------------
 #define OCCA_BOOL2 bool2
 class bool2{
@@ -1612,11 +1624,37 @@ inline std::ostream& operator << (std::ostream &out, const bool16& a){
 #  define OCCA_CHAR2 char2
 #endif
 #if (!defined(OCCA_IN_KERNEL) || (OCCA_USING_CUDA == 0))
+#if OCCA_VECTOR_EXTENSIONS
+typedef OCCA_VECTOR_EXT_TYPE(char, 2) occaVector_char2;
+#endif
 class char2{
 public:
+#if OCCA_VECTOR_EXTENSIONS
+  union {
+    occaVector_char2 reg;
+    struct {
+#endif
   union { char s0, x; };
   union { char s1, y; };
+#if OCCA_VECTOR_EXTENSIONS
+    };
+  };
+#endif
 
+#if OCCA_VECTOR_EXTENSIONS
+  inline occaFunction char2(const occaVector_char2 &reg_) : 
+    reg(reg_) {}
+
+  inline occaFunction char2() : 
+    reg((occaVector_char2) {0, 0}) {}
+
+  inline occaFunction char2(const char &x_) : 
+    reg((occaVector_char2) {x_, 0}) {}
+
+  inline occaFunction char2(const char &x_,
+                            const char &y_) : 
+    reg((occaVector_char2) {x_, y_}) {}
+#else
   inline occaFunction char2() : 
     x(0),
     y(0) {}
@@ -1629,12 +1667,17 @@ public:
                             const char &y_) : 
     x(x_),
     y(y_) {}
+#endif
 };
 #endif
 
 occaFunction inline char2 operator + (const char2 &a){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_CHAR2(+a.reg);
+#else
   return OCCA_CHAR2(+a.x,
                     +a.y);
+#endif
 }
 
 occaFunction inline char2 operator ++ (char2 &a, int){
@@ -1648,8 +1691,12 @@ occaFunction inline char2& operator ++ (char2 &a){
   return a;
 }
 occaFunction inline char2 operator - (const char2 &a){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_CHAR2(-a.reg);
+#else
   return OCCA_CHAR2(-a.x,
                     -a.y);
+#endif
 }
 
 occaFunction inline char2 operator -- (char2 &a, int){
@@ -1663,107 +1710,187 @@ occaFunction inline char2& operator -- (char2 &a){
   return a;
 }
 occaFunction inline char2  operator +  (const char2 &a, const char2 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_CHAR2(a.reg + b.reg);
+#else
   return OCCA_CHAR2(a.x + b.x,
                     a.y + b.y);
+#endif
 }
 
 occaFunction inline char2  operator +  (const char &a, const char2 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_CHAR2(a + b.reg);
+#else
   return OCCA_CHAR2(a + b.x,
                     a + b.y);
+#endif
 }
 
 occaFunction inline char2  operator +  (const char2 &a, const char &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_CHAR2(a.reg + b);
+#else
   return OCCA_CHAR2(a.x + b,
                     a.y + b);
+#endif
 }
 
 occaFunction inline char2& operator += (      char2 &a, const char2 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.reg += b.reg;
+#else
   a.x += b.x;
   a.y += b.y;
+#endif
   return a;
 }
 
 occaFunction inline char2& operator += (      char2 &a, const char &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.reg += b;
+#else
   a.x += b;
   a.y += b;
+#endif
   return a;
 }
 occaFunction inline char2  operator -  (const char2 &a, const char2 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_CHAR2(a.reg - b.reg);
+#else
   return OCCA_CHAR2(a.x - b.x,
                     a.y - b.y);
+#endif
 }
 
 occaFunction inline char2  operator -  (const char &a, const char2 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_CHAR2(a - b.reg);
+#else
   return OCCA_CHAR2(a - b.x,
                     a - b.y);
+#endif
 }
 
 occaFunction inline char2  operator -  (const char2 &a, const char &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_CHAR2(a.reg - b);
+#else
   return OCCA_CHAR2(a.x - b,
                     a.y - b);
+#endif
 }
 
 occaFunction inline char2& operator -= (      char2 &a, const char2 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.reg -= b.reg;
+#else
   a.x -= b.x;
   a.y -= b.y;
+#endif
   return a;
 }
 
 occaFunction inline char2& operator -= (      char2 &a, const char &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.reg -= b;
+#else
   a.x -= b;
   a.y -= b;
+#endif
   return a;
 }
 occaFunction inline char2  operator *  (const char2 &a, const char2 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_CHAR2(a.reg * b.reg);
+#else
   return OCCA_CHAR2(a.x * b.x,
                     a.y * b.y);
+#endif
 }
 
 occaFunction inline char2  operator *  (const char &a, const char2 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_CHAR2(a * b.reg);
+#else
   return OCCA_CHAR2(a * b.x,
                     a * b.y);
+#endif
 }
 
 occaFunction inline char2  operator *  (const char2 &a, const char &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_CHAR2(a.reg * b);
+#else
   return OCCA_CHAR2(a.x * b,
                     a.y * b);
+#endif
 }
 
 occaFunction inline char2& operator *= (      char2 &a, const char2 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.reg *= b.reg;
+#else
   a.x *= b.x;
   a.y *= b.y;
+#endif
   return a;
 }
 
 occaFunction inline char2& operator *= (      char2 &a, const char &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.reg *= b;
+#else
   a.x *= b;
   a.y *= b;
+#endif
   return a;
 }
 occaFunction inline char2  operator /  (const char2 &a, const char2 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_CHAR2(a.reg / b.reg);
+#else
   return OCCA_CHAR2(a.x / b.x,
                     a.y / b.y);
+#endif
 }
 
 occaFunction inline char2  operator /  (const char &a, const char2 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_CHAR2(a / b.reg);
+#else
   return OCCA_CHAR2(a / b.x,
                     a / b.y);
+#endif
 }
 
 occaFunction inline char2  operator /  (const char2 &a, const char &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_CHAR2(a.reg / b);
+#else
   return OCCA_CHAR2(a.x / b,
                     a.y / b);
+#endif
 }
 
 occaFunction inline char2& operator /= (      char2 &a, const char2 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.reg /= b.reg;
+#else
   a.x /= b.x;
   a.y /= b.y;
+#endif
   return a;
 }
 
 occaFunction inline char2& operator /= (      char2 &a, const char &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.reg /= b;
+#else
   a.x /= b;
   a.y /= b;
+#endif
   return a;
 }
 
@@ -1787,13 +1914,50 @@ inline std::ostream& operator << (std::ostream &out, const char2& a){
 #  define OCCA_CHAR4 char4
 #endif
 #if (!defined(OCCA_IN_KERNEL) || (OCCA_USING_CUDA == 0))
+#if OCCA_VECTOR_EXTENSIONS
+typedef OCCA_VECTOR_EXT_TYPE(char, 4) occaVector_char4;
+#endif
 class char4{
 public:
+#if OCCA_VECTOR_EXTENSIONS
+  union {
+    occaVector_char4 reg;
+    struct {
+#endif
   union { char s0, x; };
   union { char s1, y; };
   union { char s2, z; };
   union { char s3, w; };
+#if OCCA_VECTOR_EXTENSIONS
+    };
+  };
+#endif
+
+#if OCCA_VECTOR_EXTENSIONS
+  inline occaFunction char4(const occaVector_char4 &reg_) : 
+    reg(reg_) {}
+
+  inline occaFunction char4() : 
+    reg((occaVector_char4) {0, 0, 0, 0}) {}
+
+  inline occaFunction char4(const char &x_) : 
+    reg((occaVector_char4) {x_, 0, 0, 0}) {}
+
+  inline occaFunction char4(const char &x_,
+                            const char &y_) : 
+    reg((occaVector_char4) {x_, y_, 0, 0}) {}
+
+  inline occaFunction char4(const char &x_,
+                            const char &y_,
+                            const char &z_) : 
+    reg((occaVector_char4) {x_, y_, z_, 0}) {}
 
+  inline occaFunction char4(const char &x_,
+                            const char &y_,
+                            const char &z_,
+                            const char &w_) : 
+    reg((occaVector_char4) {x_, y_, z_, w_}) {}
+#else
   inline occaFunction char4() : 
     x(0),
     y(0),
@@ -1829,14 +1993,19 @@ public:
     y(y_),
     z(z_),
     w(w_) {}
+#endif
 };
 #endif
 
 occaFunction inline char4 operator + (const char4 &a){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_CHAR4(+a.reg);
+#else
   return OCCA_CHAR4(+a.x,
                     +a.y,
                     +a.z,
                     +a.w);
+#endif
 }
 
 occaFunction inline char4 operator ++ (char4 &a, int){
@@ -1854,10 +2023,14 @@ occaFunction inline char4& operator ++ (char4 &a){
   return a;
 }
 occaFunction inline char4 operator - (const char4 &a){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_CHAR4(-a.reg);
+#else
   return OCCA_CHAR4(-a.x,
                     -a.y,
                     -a.z,
                     -a.w);
+#endif
 }
 
 occaFunction inline char4 operator -- (char4 &a, int){
@@ -1875,147 +2048,227 @@ occaFunction inline char4& operator -- (char4 &a){
   return a;
 }
 occaFunction inline char4  operator +  (const char4 &a, const char4 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_CHAR4(a.reg + b.reg);
+#else
   return OCCA_CHAR4(a.x + b.x,
                     a.y + b.y,
                     a.z + b.z,
                     a.w + b.w);
+#endif
 }
 
 occaFunction inline char4  operator +  (const char &a, const char4 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_CHAR4(a + b.reg);
+#else
   return OCCA_CHAR4(a + b.x,
                     a + b.y,
                     a + b.z,
                     a + b.w);
+#endif
 }
 
 occaFunction inline char4  operator +  (const char4 &a, const char &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_CHAR4(a.reg + b);
+#else
   return OCCA_CHAR4(a.x + b,
                     a.y + b,
                     a.z + b,
                     a.w + b);
+#endif
 }
 
 occaFunction inline char4& operator += (      char4 &a, const char4 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.reg += b.reg;
+#else
   a.x += b.x;
   a.y += b.y;
   a.z += b.z;
   a.w += b.w;
+#endif
   return a;
 }
 
 occaFunction inline char4& operator += (      char4 &a, const char &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.reg += b;
+#else
   a.x += b;
   a.y += b;
   a.z += b;
   a.w += b;
+#endif
   return a;
 }
 occaFunction inline char4  operator -  (const char4 &a, const char4 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_CHAR4(a.reg - b.reg);
+#else
   return OCCA_CHAR4(a.x - b.x,
                     a.y - b.y,
                     a.z - b.z,
                     a.w - b.w);
+#endif
 }
 
 occaFunction inline char4  operator -  (const char &a, const char4 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_CHAR4(a - b.reg);
+#else
   return OCCA_CHAR4(a - b.x,
                     a - b.y,
                     a - b.z,
                     a - b.w);
+#endif
 }
 
 occaFunction inline char4  operator -  (const char4 &a, const char &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_CHAR4(a.reg - b);
+#else
   return OCCA_CHAR4(a.x - b,
                     a.y - b,
                     a.z - b,
                     a.w - b);
+#endif
 }
 
 occaFunction inline char4& operator -= (      char4 &a, const char4 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.reg -= b.reg;
+#else
   a.x -= b.x;
   a.y -= b.y;
   a.z -= b.z;
   a.w -= b.w;
+#endif
   return a;
 }
 
 occaFunction inline char4& operator -= (      char4 &a, const char &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.reg -= b;
+#else
   a.x -= b;
   a.y -= b;
   a.z -= b;
   a.w -= b;
+#endif
   return a;
 }
 occaFunction inline char4  operator *  (const char4 &a, const char4 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_CHAR4(a.reg * b.reg);
+#else
   return OCCA_CHAR4(a.x * b.x,
                     a.y * b.y,
                     a.z * b.z,
                     a.w * b.w);
+#endif
 }
 
 occaFunction inline char4  operator *  (const char &a, const char4 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_CHAR4(a * b.reg);
+#else
   return OCCA_CHAR4(a * b.x,
                     a * b.y,
                     a * b.z,
                     a * b.w);
+#endif
 }
 
 occaFunction inline char4  operator *  (const char4 &a, const char &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_CHAR4(a.reg * b);
+#else
   return OCCA_CHAR4(a.x * b,
                     a.y * b,
                     a.z * b,
                     a.w * b);
+#endif
 }
 
 occaFunction inline char4& operator *= (      char4 &a, const char4 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.reg *= b.reg;
+#else
   a.x *= b.x;
   a.y *= b.y;
   a.z *= b.z;
   a.w *= b.w;
+#endif
   return a;
 }
 
 occaFunction inline char4& operator *= (      char4 &a, const char &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.reg *= b;
+#else
   a.x *= b;
   a.y *= b;
   a.z *= b;
   a.w *= b;
+#endif
   return a;
 }
 occaFunction inline char4  operator /  (const char4 &a, const char4 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_CHAR4(a.reg / b.reg);
+#else
   return OCCA_CHAR4(a.x / b.x,
                     a.y / b.y,
                     a.z / b.z,
                     a.w / b.w);
+#endif
 }
 
 occaFunction inline char4  operator /  (const char &a, const char4 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_CHAR4(a / b.reg);
+#else
   return OCCA_CHAR4(a / b.x,
                     a / b.y,
                     a / b.z,
                     a / b.w);
+#endif
 }
 
 occaFunction inline char4  operator /  (const char4 &a, const char &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_CHAR4(a.reg / b);
+#else
   return OCCA_CHAR4(a.x / b,
                     a.y / b,
                     a.z / b,
                     a.w / b);
+#endif
 }
 
 occaFunction inline char4& operator /= (      char4 &a, const char4 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.reg /= b.reg;
+#else
   a.x /= b.x;
   a.y /= b.y;
   a.z /= b.z;
   a.w /= b.w;
+#endif
   return a;
 }
 
 occaFunction inline char4& operator /= (      char4 &a, const char &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.reg /= b;
+#else
   a.x /= b;
   a.y /= b;
   a.z /= b;
   a.w /= b;
+#endif
   return a;
 }
 
@@ -2048,8 +2301,16 @@ typedef char4 char3;
 
 //---[ char8 ]--------------------------
 #define OCCA_CHAR8 char8
+#if OCCA_VECTOR_EXTENSIONS
+typedef OCCA_VECTOR_EXT_TYPE(char, 8) occaVector_char8;
+#endif
 class char8{
 public:
+#if OCCA_VECTOR_EXTENSIONS
+  union {
+    occaVector_char8 reg;
+    struct {
+#endif
   union { char s0, x; };
   union { char s1, y; };
   union { char s2, z; };
@@ -2058,7 +2319,70 @@ public:
   char s5;
   char s6;
   char s7;
+#if OCCA_VECTOR_EXTENSIONS
+    };
+  };
+#endif
+
+#if OCCA_VECTOR_EXTENSIONS
+  inline occaFunction char8(const occaVector_char8 &reg_) : 
+    reg(reg_) {}
+
+  inline occaFunction char8() : 
+    reg((occaVector_char8) {0, 0, 0, 0, 0, 0, 0, 0}) {}
+
+  inline occaFunction char8(const char &x_) : 
+    reg((occaVector_char8) {x_, 0, 0, 0, 0, 0, 0, 0}) {}
+
+  inline occaFunction char8(const char &x_,
+                            const char &y_) : 
+    reg((occaVector_char8) {x_, y_, 0, 0, 0, 0, 0, 0}) {}
+
+  inline occaFunction char8(const char &x_,
+                            const char &y_,
+                            const char &z_) : 
+    reg((occaVector_char8) {x_, y_, z_, 0, 0, 0, 0, 0}) {}
+
+  inline occaFunction char8(const char &x_,
+                            const char &y_,
+                            const char &z_,
+                            const char &w_) : 
+    reg((occaVector_char8) {x_, y_, z_, w_, 0, 0, 0, 0}) {}
+
+  inline occaFunction char8(const char &x_,
+                            const char &y_,
+                            const char &z_,
+                            const char &w_,
+                            const char &s4_) : 
+    reg((occaVector_char8) {x_, y_, z_, w_, s4_, 0, 0, 0}) {}
+
+  inline occaFunction char8(const char &x_,
+                            const char &y_,
+                            const char &z_,
+                            const char &w_,
+                            const char &s4_,
+                            const char &s5_) : 
+    reg((occaVector_char8) {x_, y_, z_, w_, s4_, s5_, 0, 0}) {}
+
+  inline occaFunction char8(const char &x_,
+                            const char &y_,
+                            const char &z_,
+                            const char &w_,
+                            const char &s4_,
+                            const char &s5_,
+                            const char &s6_) : 
+    reg((occaVector_char8) {x_, y_, z_, w_, s4_, s5_, s6_, 0}) {}
 
+  inline occaFunction char8(const char &x_,
+                            const char &y_,
+                            const char &z_,
+                            const char &w_,
+                            const char &s4_,
+                            const char &s5_,
+                            const char &s6_,
+                            const char &s7_) : 
+    reg((occaVector_char8) {x_, y_, z_, w_, s4_, s5_, s6_, s7_}) {}
+#else
   inline occaFunction char8() : 
     x(0),
     y(0),
@@ -2176,9 +2500,13 @@ public:
     s5(s5_),
     s6(s6_),
     s7(s7_) {}
+#endif
 };
 
 occaFunction inline char8 operator + (const char8 &a){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_CHAR8(+a.reg);
+#else
   return OCCA_CHAR8(+a.x,
                     +a.y,
                     +a.z,
@@ -2187,6 +2515,7 @@ occaFunction inline char8 operator + (const char8 &a){
                     +a.s5,
                     +a.s6,
                     +a.s7);
+#endif
 }
 
 occaFunction inline char8 operator ++ (char8 &a, int){
@@ -2212,6 +2541,9 @@ occaFunction inline char8& operator ++ (char8 &a){
   return a;
 }
 occaFunction inline char8 operator - (const char8 &a){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_CHAR8(-a.reg);
+#else
   return OCCA_CHAR8(-a.x,
                     -a.y,
                     -a.z,
@@ -2220,6 +2552,7 @@ occaFunction inline char8 operator - (const char8 &a){
                     -a.s5,
                     -a.s6,
                     -a.s7);
+#endif
 }
 
 occaFunction inline char8 operator -- (char8 &a, int){
@@ -2245,6 +2578,9 @@ occaFunction inline char8& operator -- (char8 &a){
   return a;
 }
 occaFunction inline char8  operator +  (const char8 &a, const char8 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_CHAR8(a.reg + b.reg);
+#else
   return OCCA_CHAR8(a.x + b.x,
                     a.y + b.y,
                     a.z + b.z,
@@ -2253,9 +2589,13 @@ occaFunction inline char8  operator +  (const char8 &a, const char8 &b){
                     a.s5 + b.s5,
                     a.s6 + b.s6,
                     a.s7 + b.s7);
+#endif
 }
 
 occaFunction inline char8  operator +  (const char &a, const char8 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_CHAR8(a + b.reg);
+#else
   return OCCA_CHAR8(a + b.x,
                     a + b.y,
                     a + b.z,
@@ -2264,9 +2604,13 @@ occaFunction inline char8  operator +  (const char &a, const char8 &b){
                     a + b.s5,
                     a + b.s6,
                     a + b.s7);
+#endif
 }
 
 occaFunction inline char8  operator +  (const char8 &a, const char &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_CHAR8(a.reg + b);
+#else
   return OCCA_CHAR8(a.x + b,
                     a.y + b,
                     a.z + b,
@@ -2275,9 +2619,13 @@ occaFunction inline char8  operator +  (const char8 &a, const char &b){
                     a.s5 + b,
                     a.s6 + b,
                     a.s7 + b);
+#endif
 }
 
 occaFunction inline char8& operator += (      char8 &a, const char8 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.reg += b.reg;
+#else
   a.x += b.x;
   a.y += b.y;
   a.z += b.z;
@@ -2286,10 +2634,14 @@ occaFunction inline char8& operator += (      char8 &a, const char8 &b){
   a.s5 += b.s5;
   a.s6 += b.s6;
   a.s7 += b.s7;
+#endif
   return a;
 }
 
 occaFunction inline char8& operator += (      char8 &a, const char &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.reg += b;
+#else
   a.x += b;
   a.y += b;
   a.z += b;
@@ -2298,9 +2650,13 @@ occaFunction inline char8& operator += (      char8 &a, const char &b){
   a.s5 += b;
   a.s6 += b;
   a.s7 += b;
+#endif
   return a;
 }
 occaFunction inline char8  operator -  (const char8 &a, const char8 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_CHAR8(a.reg - b.reg);
+#else
   return OCCA_CHAR8(a.x - b.x,
                     a.y - b.y,
                     a.z - b.z,
@@ -2309,9 +2665,13 @@ occaFunction inline char8  operator -  (const char8 &a, const char8 &b){
                     a.s5 - b.s5,
                     a.s6 - b.s6,
                     a.s7 - b.s7);
+#endif
 }
 
 occaFunction inline char8  operator -  (const char &a, const char8 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_CHAR8(a - b.reg);
+#else
   return OCCA_CHAR8(a - b.x,
                     a - b.y,
                     a - b.z,
@@ -2320,9 +2680,13 @@ occaFunction inline char8  operator -  (const char &a, const char8 &b){
                     a - b.s5,
                     a - b.s6,
                     a - b.s7);
+#endif
 }
 
 occaFunction inline char8  operator -  (const char8 &a, const char &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_CHAR8(a.reg - b);
+#else
   return OCCA_CHAR8(a.x - b,
                     a.y - b,
                     a.z - b,
@@ -2331,9 +2695,13 @@ occaFunction inline char8  operator -  (const char8 &a, const char &b){
                     a.s5 - b,
                     a.s6 - b,
                     a.s7 - b);
+#endif
 }
 
 occaFunction inline char8& operator -= (      char8 &a, const char8 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.reg -= b.reg;
+#else
   a.x -= b.x;
   a.y -= b.y;
   a.z -= b.z;
@@ -2342,10 +2710,14 @@ occaFunction inline char8& operator -= (      char8 &a, const char8 &b){
   a.s5 -= b.s5;
   a.s6 -= b.s6;
   a.s7 -= b.s7;
+#endif
   return a;
 }
 
 occaFunction inline char8& operator -= (      char8 &a, const char &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.reg -= b;
+#else
   a.x -= b;
   a.y -= b;
   a.z -= b;
@@ -2354,9 +2726,13 @@ occaFunction inline char8& operator -= (      char8 &a, const char &b){
   a.s5 -= b;
   a.s6 -= b;
   a.s7 -= b;
+#endif
   return a;
 }
 occaFunction inline char8  operator *  (const char8 &a, const char8 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_CHAR8(a.reg * b.reg);
+#else
   return OCCA_CHAR8(a.x * b.x,
                     a.y * b.y,
                     a.z * b.z,
@@ -2365,9 +2741,13 @@ occaFunction inline char8  operator *  (const char8 &a, const char8 &b){
                     a.s5 * b.s5,
                     a.s6 * b.s6,
                     a.s7 * b.s7);
+#endif
 }
 
 occaFunction inline char8  operator *  (const char &a, const char8 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_CHAR8(a * b.reg);
+#else
   return OCCA_CHAR8(a * b.x,
                     a * b.y,
                     a * b.z,
@@ -2376,9 +2756,13 @@ occaFunction inline char8  operator *  (const char &a, const char8 &b){
                     a * b.s5,
                     a * b.s6,
                     a * b.s7);
+#endif
 }
 
 occaFunction inline char8  operator *  (const char8 &a, const char &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_CHAR8(a.reg * b);
+#else
   return OCCA_CHAR8(a.x * b,
                     a.y * b,
                     a.z * b,
@@ -2387,9 +2771,13 @@ occaFunction inline char8  operator *  (const char8 &a, const char &b){
                     a.s5 * b,
                     a.s6 * b,
                     a.s7 * b);
+#endif
 }
 
 occaFunction inline char8& operator *= (      char8 &a, const char8 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.reg *= b.reg;
+#else
   a.x *= b.x;
   a.y *= b.y;
   a.z *= b.z;
@@ -2398,10 +2786,14 @@ occaFunction inline char8& operator *= (      char8 &a, const char8 &b){
   a.s5 *= b.s5;
   a.s6 *= b.s6;
   a.s7 *= b.s7;
+#endif
   return a;
 }
 
 occaFunction inline char8& operator *= (      char8 &a, const char &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.reg *= b;
+#else
   a.x *= b;
   a.y *= b;
   a.z *= b;
@@ -2410,9 +2802,13 @@ occaFunction inline char8& operator *= (      char8 &a, const char &b){
   a.s5 *= b;
   a.s6 *= b;
   a.s7 *= b;
+#endif
   return a;
 }
 occaFunction inline char8  operator /  (const char8 &a, const char8 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_CHAR8(a.reg / b.reg);
+#else
   return OCCA_CHAR8(a.x / b.x,
                     a.y / b.y,
                     a.z / b.z,
@@ -2421,9 +2817,13 @@ occaFunction inline char8  operator /  (const char8 &a, const char8 &b){
                     a.s5 / b.s5,
                     a.s6 / b.s6,
                     a.s7 / b.s7);
+#endif
 }
 
 occaFunction inline char8  operator /  (const char &a, const char8 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_CHAR8(a / b.reg);
+#else
   return OCCA_CHAR8(a / b.x,
                     a / b.y,
                     a / b.z,
@@ -2432,9 +2832,13 @@ occaFunction inline char8  operator /  (const char &a, const char8 &b){
                     a / b.s5,
                     a / b.s6,
                     a / b.s7);
+#endif
 }
 
 occaFunction inline char8  operator /  (const char8 &a, const char &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_CHAR8(a.reg / b);
+#else
   return OCCA_CHAR8(a.x / b,
                     a.y / b,
                     a.z / b,
@@ -2443,9 +2847,13 @@ occaFunction inline char8  operator /  (const char8 &a, const char &b){
                     a.s5 / b,
                     a.s6 / b,
                     a.s7 / b);
+#endif
 }
 
 occaFunction inline char8& operator /= (      char8 &a, const char8 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.reg /= b.reg;
+#else
   a.x /= b.x;
   a.y /= b.y;
   a.z /= b.z;
@@ -2454,10 +2862,14 @@ occaFunction inline char8& operator /= (      char8 &a, const char8 &b){
   a.s5 /= b.s5;
   a.s6 /= b.s6;
   a.s7 /= b.s7;
+#endif
   return a;
 }
 
 occaFunction inline char8& operator /= (      char8 &a, const char &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.reg /= b;
+#else
   a.x /= b;
   a.y /= b;
   a.z /= b;
@@ -2466,6 +2878,7 @@ occaFunction inline char8& operator /= (      char8 &a, const char &b){
   a.s5 /= b;
   a.s6 /= b;
   a.s7 /= b;
+#endif
   return a;
 }
 
@@ -2490,8 +2903,16 @@ inline std::ostream& operator << (std::ostream &out, const char8& a){
 
 //---[ char16 ]-------------------------
 #define OCCA_CHAR16 char16
+#if OCCA_VECTOR_EXTENSIONS
+typedef OCCA_VECTOR_EXT_TYPE(char, 16) occaVector_char16;
+#endif
 class char16{
 public:
+#if OCCA_VECTOR_EXTENSIONS
+  union {
+    occaVector_char16 reg;
+    struct {
+#endif
   union { char s0, x; };
   union { char s1, y; };
   union { char s2, z; };
@@ -2508,35 +2929,214 @@ public:
   char s13;
   char s14;
   char s15;
+#if OCCA_VECTOR_EXTENSIONS
+    };
+  };
+#endif
+
+#if OCCA_VECTOR_EXTENSIONS
+  inline occaFunction char16(const occaVector_char16 &reg_) : 
+    reg(reg_) {}
 
   inline occaFunction char16() : 
-    x(0),
-    y(0),
-    z(0),
-    w(0),
-    s4(0),
-    s5(0),
-    s6(0),
-    s7(0),
-    s8(0),
-    s9(0),
-    s10(0),
-    s11(0),
-    s12(0),
-    s13(0),
-    s14(0),
-    s15(0) {}
+    reg((occaVector_char16) {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}) {}
 
   inline occaFunction char16(const char &x_) : 
-    x(x_),
-    y(0),
-    z(0),
-    w(0),
-    s4(0),
-    s5(0),
-    s6(0),
-    s7(0),
-    s8(0),
+    reg((occaVector_char16) {x_, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}) {}
+
+  inline occaFunction char16(const char &x_,
+                             const char &y_) : 
+    reg((occaVector_char16) {x_, y_, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}) {}
+
+  inline occaFunction char16(const char &x_,
+                             const char &y_,
+                             const char &z_) : 
+    reg((occaVector_char16) {x_, y_, z_, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}) {}
+
+  inline occaFunction char16(const char &x_,
+                             const char &y_,
+                             const char &z_,
+                             const char &w_) : 
+    reg((occaVector_char16) {x_, y_, z_, w_, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}) {}
+
+  inline occaFunction char16(const char &x_,
+                             const char &y_,
+                             const char &z_,
+                             const char &w_,
+                             const char &s4_) : 
+    reg((occaVector_char16) {x_, y_, z_, w_, s4_, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}) {}
+
+  inline occaFunction char16(const char &x_,
+                             const char &y_,
+                             const char &z_,
+                             const char &w_,
+                             const char &s4_,
+                             const char &s5_) : 
+    reg((occaVector_char16) {x_, y_, z_, w_, s4_, s5_, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}) {}
+
+  inline occaFunction char16(const char &x_,
+                             const char &y_,
+                             const char &z_,
+                             const char &w_,
+                             const char &s4_,
+                             const char &s5_,
+                             const char &s6_) : 
+    reg((occaVector_char16) {x_, y_, z_, w_, s4_, s5_, s6_, 0, 0, 0, 0, 0, 0, 0, 0, 0}) {}
+
+  inline occaFunction char16(const char &x_,
+                             const char &y_,
+                             const char &z_,
+                             const char &w_,
+                             const char &s4_,
+                             const char &s5_,
+                             const char &s6_,
+                             const char &s7_) : 
+    reg((occaVector_char16) {x_, y_, z_, w_, s4_, s5_, s6_, s7_, 0, 0, 0, 0, 0, 0, 0, 0}) {}
+
+  inline occaFunction char16(const char &x_,
+                             const char &y_,
+                             const char &z_,
+                             const char &w_,
+                             const char &s4_,
+                             const char &s5_,
+                             const char &s6_,
+                             const char &s7_,
+                             const char &s8_) : 
+    reg((occaVector_char16) {x_, y_, z_, w_, s4_, s5_, s6_, s7_, s8_, 0, 0, 0, 0, 0, 0, 0}) {}
+
+  inline occaFunction char16(const char &x_,
+                             const char &y_,
+                             const char &z_,
+                             const char &w_,
+                             const char &s4_,
+                             const char &s5_,
+                             const char &s6_,
+                             const char &s7_,
+                             const char &s8_,
+                             const char &s9_) : 
+    reg((occaVector_char16) {x_, y_, z_, w_, s4_, s5_, s6_, s7_, s8_, s9_, 0, 0, 0, 0, 0, 0}) {}
+
+  inline occaFunction char16(const char &x_,
+                             const char &y_,
+                             const char &z_,
+                             const char &w_,
+                             const char &s4_,
+                             const char &s5_,
+                             const char &s6_,
+                             const char &s7_,
+                             const char &s8_,
+                             const char &s9_,
+                             const char &s10_) : 
+    reg((occaVector_char16) {x_, y_, z_, w_, s4_, s5_, s6_, s7_, s8_, s9_, s10_, 0, 0, 0, 0, 0}) {}
+
+  inline occaFunction char16(const char &x_,
+                             const char &y_,
+                             const char &z_,
+                             const char &w_,
+                             const char &s4_,
+                             const char &s5_,
+                             const char &s6_,
+                             const char &s7_,
+                             const char &s8_,
+                             const char &s9_,
+                             const char &s10_,
+                             const char &s11_) : 
+    reg((occaVector_char16) {x_, y_, z_, w_, s4_, s5_, s6_, s7_, s8_, s9_, s10_, s11_, 0, 0, 0, 0}) {}
+
+  inline occaFunction char16(const char &x_,
+                             const char &y_,
+                             const char &z_,
+                             const char &w_,
+                             const char &s4_,
+                             const char &s5_,
+                             const char &s6_,
+                             const char &s7_,
+                             const char &s8_,
+                             const char &s9_,
+                             const char &s10_,
+                             const char &s11_,
+                             const char &s12_) : 
+    reg((occaVector_char16) {x_, y_, z_, w_, s4_, s5_, s6_, s7_, s8_, s9_, s10_, s11_, s12_, 0, 0, 0}) {}
+
+  inline occaFunction char16(const char &x_,
+                             const char &y_,
+                             const char &z_,
+                             const char &w_,
+                             const char &s4_,
+                             const char &s5_,
+                             const char &s6_,
+                             const char &s7_,
+                             const char &s8_,
+                             const char &s9_,
+                             const char &s10_,
+                             const char &s11_,
+                             const char &s12_,
+                             const char &s13_) : 
+    reg((occaVector_char16) {x_, y_, z_, w_, s4_, s5_, s6_, s7_, s8_, s9_, s10_, s11_, s12_, s13_, 0, 0}) {}
+
+  inline occaFunction char16(const char &x_,
+                             const char &y_,
+                             const char &z_,
+                             const char &w_,
+                             const char &s4_,
+                             const char &s5_,
+                             const char &s6_,
+                             const char &s7_,
+                             const char &s8_,
+                             const char &s9_,
+                             const char &s10_,
+                             const char &s11_,
+                             const char &s12_,
+                             const char &s13_,
+                             const char &s14_) : 
+    reg((occaVector_char16) {x_, y_, z_, w_, s4_, s5_, s6_, s7_, s8_, s9_, s10_, s11_, s12_, s13_, s14_, 0}) {}
+
+  inline occaFunction char16(const char &x_,
+                             const char &y_,
+                             const char &z_,
+                             const char &w_,
+                             const char &s4_,
+                             const char &s5_,
+                             const char &s6_,
+                             const char &s7_,
+                             const char &s8_,
+                             const char &s9_,
+                             const char &s10_,
+                             const char &s11_,
+                             const char &s12_,
+                             const char &s13_,
+                             const char &s14_,
+                             const char &s15_) : 
+    reg((occaVector_char16) {x_, y_, z_, w_, s4_, s5_, s6_, s7_, s8_, s9_, s10_, s11_, s12_, s13_, s14_, s15_}) {}
+#else
+  inline occaFunction char16() : 
+    x(0),
+    y(0),
+    z(0),
+    w(0),
+    s4(0),
+    s5(0),
+    s6(0),
+    s7(0),
+    s8(0),
+    s9(0),
+    s10(0),
+    s11(0),
+    s12(0),
+    s13(0),
+    s14(0),
+    s15(0) {}
+
+  inline occaFunction char16(const char &x_) : 
+    x(x_),
+    y(0),
+    z(0),
+    w(0),
+    s4(0),
+    s5(0),
+    s6(0),
+    s7(0),
+    s8(0),
     s9(0),
     s10(0),
     s11(0),
@@ -2934,9 +3534,13 @@ public:
     s13(s13_),
     s14(s14_),
     s15(s15_) {}
+#endif
 };
 
 occaFunction inline char16 operator + (const char16 &a){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_CHAR16(+a.reg);
+#else
   return OCCA_CHAR16(+a.x,
                      +a.y,
                      +a.z,
@@ -2953,6 +3557,7 @@ occaFunction inline char16 operator + (const char16 &a){
                      +a.s13,
                      +a.s14,
                      +a.s15);
+#endif
 }
 
 occaFunction inline char16 operator ++ (char16 &a, int){
@@ -2994,6 +3599,9 @@ occaFunction inline char16& operator ++ (char16 &a){
   return a;
 }
 occaFunction inline char16 operator - (const char16 &a){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_CHAR16(-a.reg);
+#else
   return OCCA_CHAR16(-a.x,
                      -a.y,
                      -a.z,
@@ -3010,6 +3618,7 @@ occaFunction inline char16 operator - (const char16 &a){
                      -a.s13,
                      -a.s14,
                      -a.s15);
+#endif
 }
 
 occaFunction inline char16 operator -- (char16 &a, int){
@@ -3051,6 +3660,9 @@ occaFunction inline char16& operator -- (char16 &a){
   return a;
 }
 occaFunction inline char16  operator +  (const char16 &a, const char16 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_CHAR16(a.reg + b.reg);
+#else
   return OCCA_CHAR16(a.x + b.x,
                      a.y + b.y,
                      a.z + b.z,
@@ -3067,9 +3679,13 @@ occaFunction inline char16  operator +  (const char16 &a, const char16 &b){
                      a.s13 + b.s13,
                      a.s14 + b.s14,
                      a.s15 + b.s15);
+#endif
 }
 
 occaFunction inline char16  operator +  (const char &a, const char16 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_CHAR16(a + b.reg);
+#else
   return OCCA_CHAR16(a + b.x,
                      a + b.y,
                      a + b.z,
@@ -3086,9 +3702,13 @@ occaFunction inline char16  operator +  (const char &a, const char16 &b){
                      a + b.s13,
                      a + b.s14,
                      a + b.s15);
+#endif
 }
 
 occaFunction inline char16  operator +  (const char16 &a, const char &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_CHAR16(a.reg + b);
+#else
   return OCCA_CHAR16(a.x + b,
                      a.y + b,
                      a.z + b,
@@ -3105,9 +3725,13 @@ occaFunction inline char16  operator +  (const char16 &a, const char &b){
                      a.s13 + b,
                      a.s14 + b,
                      a.s15 + b);
+#endif
 }
 
 occaFunction inline char16& operator += (      char16 &a, const char16 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.reg += b.reg;
+#else
   a.x += b.x;
   a.y += b.y;
   a.z += b.z;
@@ -3124,10 +3748,14 @@ occaFunction inline char16& operator += (      char16 &a, const char16 &b){
   a.s13 += b.s13;
   a.s14 += b.s14;
   a.s15 += b.s15;
+#endif
   return a;
 }
 
 occaFunction inline char16& operator += (      char16 &a, const char &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.reg += b;
+#else
   a.x += b;
   a.y += b;
   a.z += b;
@@ -3144,9 +3772,13 @@ occaFunction inline char16& operator += (      char16 &a, const char &b){
   a.s13 += b;
   a.s14 += b;
   a.s15 += b;
+#endif
   return a;
 }
 occaFunction inline char16  operator -  (const char16 &a, const char16 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_CHAR16(a.reg - b.reg);
+#else
   return OCCA_CHAR16(a.x - b.x,
                      a.y - b.y,
                      a.z - b.z,
@@ -3163,9 +3795,13 @@ occaFunction inline char16  operator -  (const char16 &a, const char16 &b){
                      a.s13 - b.s13,
                      a.s14 - b.s14,
                      a.s15 - b.s15);
+#endif
 }
 
 occaFunction inline char16  operator -  (const char &a, const char16 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_CHAR16(a - b.reg);
+#else
   return OCCA_CHAR16(a - b.x,
                      a - b.y,
                      a - b.z,
@@ -3182,9 +3818,13 @@ occaFunction inline char16  operator -  (const char &a, const char16 &b){
                      a - b.s13,
                      a - b.s14,
                      a - b.s15);
+#endif
 }
 
 occaFunction inline char16  operator -  (const char16 &a, const char &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_CHAR16(a.reg - b);
+#else
   return OCCA_CHAR16(a.x - b,
                      a.y - b,
                      a.z - b,
@@ -3201,9 +3841,13 @@ occaFunction inline char16  operator -  (const char16 &a, const char &b){
                      a.s13 - b,
                      a.s14 - b,
                      a.s15 - b);
+#endif
 }
 
 occaFunction inline char16& operator -= (      char16 &a, const char16 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.reg -= b.reg;
+#else
   a.x -= b.x;
   a.y -= b.y;
   a.z -= b.z;
@@ -3220,10 +3864,14 @@ occaFunction inline char16& operator -= (      char16 &a, const char16 &b){
   a.s13 -= b.s13;
   a.s14 -= b.s14;
   a.s15 -= b.s15;
+#endif
   return a;
 }
 
 occaFunction inline char16& operator -= (      char16 &a, const char &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.reg -= b;
+#else
   a.x -= b;
   a.y -= b;
   a.z -= b;
@@ -3240,9 +3888,13 @@ occaFunction inline char16& operator -= (      char16 &a, const char &b){
   a.s13 -= b;
   a.s14 -= b;
   a.s15 -= b;
+#endif
   return a;
 }
 occaFunction inline char16  operator *  (const char16 &a, const char16 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_CHAR16(a.reg * b.reg);
+#else
   return OCCA_CHAR16(a.x * b.x,
                      a.y * b.y,
                      a.z * b.z,
@@ -3259,9 +3911,13 @@ occaFunction inline char16  operator *  (const char16 &a, const char16 &b){
                      a.s13 * b.s13,
                      a.s14 * b.s14,
                      a.s15 * b.s15);
+#endif
 }
 
 occaFunction inline char16  operator *  (const char &a, const char16 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_CHAR16(a * b.reg);
+#else
   return OCCA_CHAR16(a * b.x,
                      a * b.y,
                      a * b.z,
@@ -3278,9 +3934,13 @@ occaFunction inline char16  operator *  (const char &a, const char16 &b){
                      a * b.s13,
                      a * b.s14,
                      a * b.s15);
+#endif
 }
 
 occaFunction inline char16  operator *  (const char16 &a, const char &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_CHAR16(a.reg * b);
+#else
   return OCCA_CHAR16(a.x * b,
                      a.y * b,
                      a.z * b,
@@ -3297,9 +3957,13 @@ occaFunction inline char16  operator *  (const char16 &a, const char &b){
                      a.s13 * b,
                      a.s14 * b,
                      a.s15 * b);
+#endif
 }
 
 occaFunction inline char16& operator *= (      char16 &a, const char16 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.reg *= b.reg;
+#else
   a.x *= b.x;
   a.y *= b.y;
   a.z *= b.z;
@@ -3316,10 +3980,14 @@ occaFunction inline char16& operator *= (      char16 &a, const char16 &b){
   a.s13 *= b.s13;
   a.s14 *= b.s14;
   a.s15 *= b.s15;
+#endif
   return a;
 }
 
 occaFunction inline char16& operator *= (      char16 &a, const char &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.reg *= b;
+#else
   a.x *= b;
   a.y *= b;
   a.z *= b;
@@ -3336,9 +4004,13 @@ occaFunction inline char16& operator *= (      char16 &a, const char &b){
   a.s13 *= b;
   a.s14 *= b;
   a.s15 *= b;
+#endif
   return a;
 }
 occaFunction inline char16  operator /  (const char16 &a, const char16 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_CHAR16(a.reg / b.reg);
+#else
   return OCCA_CHAR16(a.x / b.x,
                      a.y / b.y,
                      a.z / b.z,
@@ -3355,9 +4027,13 @@ occaFunction inline char16  operator /  (const char16 &a, const char16 &b){
                      a.s13 / b.s13,
                      a.s14 / b.s14,
                      a.s15 / b.s15);
+#endif
 }
 
 occaFunction inline char16  operator /  (const char &a, const char16 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_CHAR16(a / b.reg);
+#else
   return OCCA_CHAR16(a / b.x,
                      a / b.y,
                      a / b.z,
@@ -3374,9 +4050,13 @@ occaFunction inline char16  operator /  (const char &a, const char16 &b){
                      a / b.s13,
                      a / b.s14,
                      a / b.s15);
+#endif
 }
 
 occaFunction inline char16  operator /  (const char16 &a, const char &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_CHAR16(a.reg / b);
+#else
   return OCCA_CHAR16(a.x / b,
                      a.y / b,
                      a.z / b,
@@ -3393,9 +4073,13 @@ occaFunction inline char16  operator /  (const char16 &a, const char &b){
                      a.s13 / b,
                      a.s14 / b,
                      a.s15 / b);
+#endif
 }
 
 occaFunction inline char16& operator /= (      char16 &a, const char16 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.reg /= b.reg;
+#else
   a.x /= b.x;
   a.y /= b.y;
   a.z /= b.z;
@@ -3412,10 +4096,14 @@ occaFunction inline char16& operator /= (      char16 &a, const char16 &b){
   a.s13 /= b.s13;
   a.s14 /= b.s14;
   a.s15 /= b.s15;
+#endif
   return a;
 }
 
 occaFunction inline char16& operator /= (      char16 &a, const char &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.reg /= b;
+#else
   a.x /= b;
   a.y /= b;
   a.z /= b;
@@ -3432,6 +4120,7 @@ occaFunction inline char16& operator /= (      char16 &a, const char &b){
   a.s13 /= b;
   a.s14 /= b;
   a.s15 /= b;
+#endif
   return a;
 }
 
@@ -3469,11 +4158,37 @@ inline std::ostream& operator << (std::ostream &out, const char16& a){
 #  define OCCA_SHORT2 short2
 #endif
 #if (!defined(OCCA_IN_KERNEL) || (OCCA_USING_CUDA == 0))
+#if OCCA_VECTOR_EXTENSIONS
+typedef OCCA_VECTOR_EXT_TYPE(short, 2) occaVector_short2;
+#endif
 class short2{
 public:
+#if OCCA_VECTOR_EXTENSIONS
+  union {
+    occaVector_short2 reg;
+    struct {
+#endif
   union { short s0, x; };
   union { short s1, y; };
+#if OCCA_VECTOR_EXTENSIONS
+    };
+  };
+#endif
+
+#if OCCA_VECTOR_EXTENSIONS
+  inline occaFunction short2(const occaVector_short2 &reg_) : 
+    reg(reg_) {}
+
+  inline occaFunction short2() : 
+    reg((occaVector_short2) {0, 0}) {}
 
+  inline occaFunction short2(const short &x_) : 
+    reg((occaVector_short2) {x_, 0}) {}
+
+  inline occaFunction short2(const short &x_,
+                             const short &y_) : 
+    reg((occaVector_short2) {x_, y_}) {}
+#else
   inline occaFunction short2() : 
     x(0),
     y(0) {}
@@ -3486,12 +4201,17 @@ public:
                              const short &y_) : 
     x(x_),
     y(y_) {}
+#endif
 };
 #endif
 
 occaFunction inline short2 operator + (const short2 &a){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_SHORT2(+a.reg);
+#else
   return OCCA_SHORT2(+a.x,
                      +a.y);
+#endif
 }
 
 occaFunction inline short2 operator ++ (short2 &a, int){
@@ -3505,8 +4225,12 @@ occaFunction inline short2& operator ++ (short2 &a){
   return a;
 }
 occaFunction inline short2 operator - (const short2 &a){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_SHORT2(-a.reg);
+#else
   return OCCA_SHORT2(-a.x,
                      -a.y);
+#endif
 }
 
 occaFunction inline short2 operator -- (short2 &a, int){
@@ -3520,107 +4244,187 @@ occaFunction inline short2& operator -- (short2 &a){
   return a;
 }
 occaFunction inline short2  operator +  (const short2 &a, const short2 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_SHORT2(a.reg + b.reg);
+#else
   return OCCA_SHORT2(a.x + b.x,
                      a.y + b.y);
+#endif
 }
 
 occaFunction inline short2  operator +  (const short &a, const short2 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_SHORT2(a + b.reg);
+#else
   return OCCA_SHORT2(a + b.x,
                      a + b.y);
+#endif
 }
 
 occaFunction inline short2  operator +  (const short2 &a, const short &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_SHORT2(a.reg + b);
+#else
   return OCCA_SHORT2(a.x + b,
                      a.y + b);
+#endif
 }
 
 occaFunction inline short2& operator += (      short2 &a, const short2 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.reg += b.reg;
+#else
   a.x += b.x;
   a.y += b.y;
+#endif
   return a;
 }
 
 occaFunction inline short2& operator += (      short2 &a, const short &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.reg += b;
+#else
   a.x += b;
   a.y += b;
+#endif
   return a;
 }
 occaFunction inline short2  operator -  (const short2 &a, const short2 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_SHORT2(a.reg - b.reg);
+#else
   return OCCA_SHORT2(a.x - b.x,
                      a.y - b.y);
+#endif
 }
 
 occaFunction inline short2  operator -  (const short &a, const short2 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_SHORT2(a - b.reg);
+#else
   return OCCA_SHORT2(a - b.x,
                      a - b.y);
+#endif
 }
 
 occaFunction inline short2  operator -  (const short2 &a, const short &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_SHORT2(a.reg - b);
+#else
   return OCCA_SHORT2(a.x - b,
                      a.y - b);
+#endif
 }
 
 occaFunction inline short2& operator -= (      short2 &a, const short2 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.reg -= b.reg;
+#else
   a.x -= b.x;
   a.y -= b.y;
+#endif
   return a;
 }
 
 occaFunction inline short2& operator -= (      short2 &a, const short &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.reg -= b;
+#else
   a.x -= b;
   a.y -= b;
+#endif
   return a;
 }
 occaFunction inline short2  operator *  (const short2 &a, const short2 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_SHORT2(a.reg * b.reg);
+#else
   return OCCA_SHORT2(a.x * b.x,
                      a.y * b.y);
+#endif
 }
 
 occaFunction inline short2  operator *  (const short &a, const short2 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_SHORT2(a * b.reg);
+#else
   return OCCA_SHORT2(a * b.x,
                      a * b.y);
+#endif
 }
 
 occaFunction inline short2  operator *  (const short2 &a, const short &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_SHORT2(a.reg * b);
+#else
   return OCCA_SHORT2(a.x * b,
                      a.y * b);
+#endif
 }
 
 occaFunction inline short2& operator *= (      short2 &a, const short2 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.reg *= b.reg;
+#else
   a.x *= b.x;
   a.y *= b.y;
+#endif
   return a;
 }
 
 occaFunction inline short2& operator *= (      short2 &a, const short &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.reg *= b;
+#else
   a.x *= b;
   a.y *= b;
+#endif
   return a;
 }
 occaFunction inline short2  operator /  (const short2 &a, const short2 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_SHORT2(a.reg / b.reg);
+#else
   return OCCA_SHORT2(a.x / b.x,
                      a.y / b.y);
+#endif
 }
 
 occaFunction inline short2  operator /  (const short &a, const short2 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_SHORT2(a / b.reg);
+#else
   return OCCA_SHORT2(a / b.x,
                      a / b.y);
+#endif
 }
 
 occaFunction inline short2  operator /  (const short2 &a, const short &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_SHORT2(a.reg / b);
+#else
   return OCCA_SHORT2(a.x / b,
                      a.y / b);
+#endif
 }
 
 occaFunction inline short2& operator /= (      short2 &a, const short2 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.reg /= b.reg;
+#else
   a.x /= b.x;
   a.y /= b.y;
+#endif
   return a;
 }
 
 occaFunction inline short2& operator /= (      short2 &a, const short &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.reg /= b;
+#else
   a.x /= b;
   a.y /= b;
+#endif
   return a;
 }
 
@@ -3644,13 +4448,50 @@ inline std::ostream& operator << (std::ostream &out, const short2& a){
 #  define OCCA_SHORT4 short4
 #endif
 #if (!defined(OCCA_IN_KERNEL) || (OCCA_USING_CUDA == 0))
+#if OCCA_VECTOR_EXTENSIONS
+typedef OCCA_VECTOR_EXT_TYPE(short, 4) occaVector_short4;
+#endif
 class short4{
 public:
+#if OCCA_VECTOR_EXTENSIONS
+  union {
+    occaVector_short4 reg;
+    struct {
+#endif
   union { short s0, x; };
   union { short s1, y; };
   union { short s2, z; };
   union { short s3, w; };
+#if OCCA_VECTOR_EXTENSIONS
+    };
+  };
+#endif
+
+#if OCCA_VECTOR_EXTENSIONS
+  inline occaFunction short4(const occaVector_short4 &reg_) : 
+    reg(reg_) {}
 
+  inline occaFunction short4() : 
+    reg((occaVector_short4) {0, 0, 0, 0}) {}
+
+  inline occaFunction short4(const short &x_) : 
+    reg((occaVector_short4) {x_, 0, 0, 0}) {}
+
+  inline occaFunction short4(const short &x_,
+                             const short &y_) : 
+    reg((occaVector_short4) {x_, y_, 0, 0}) {}
+
+  inline occaFunction short4(const short &x_,
+                             const short &y_,
+                             const short &z_) : 
+    reg((occaVector_short4) {x_, y_, z_, 0}) {}
+
+  inline occaFunction short4(const short &x_,
+                             const short &y_,
+                             const short &z_,
+                             const short &w_) : 
+    reg((occaVector_short4) {x_, y_, z_, w_}) {}
+#else
   inline occaFunction short4() : 
     x(0),
     y(0),
@@ -3686,14 +4527,19 @@ public:
     y(y_),
     z(z_),
     w(w_) {}
+#endif
 };
 #endif
 
 occaFunction inline short4 operator + (const short4 &a){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_SHORT4(+a.reg);
+#else
   return OCCA_SHORT4(+a.x,
                      +a.y,
                      +a.z,
                      +a.w);
+#endif
 }
 
 occaFunction inline short4 operator ++ (short4 &a, int){
@@ -3711,10 +4557,14 @@ occaFunction inline short4& operator ++ (short4 &a){
   return a;
 }
 occaFunction inline short4 operator - (const short4 &a){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_SHORT4(-a.reg);
+#else
   return OCCA_SHORT4(-a.x,
                      -a.y,
                      -a.z,
                      -a.w);
+#endif
 }
 
 occaFunction inline short4 operator -- (short4 &a, int){
@@ -3732,147 +4582,227 @@ occaFunction inline short4& operator -- (short4 &a){
   return a;
 }
 occaFunction inline short4  operator +  (const short4 &a, const short4 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_SHORT4(a.reg + b.reg);
+#else
   return OCCA_SHORT4(a.x + b.x,
                      a.y + b.y,
                      a.z + b.z,
                      a.w + b.w);
+#endif
 }
 
 occaFunction inline short4  operator +  (const short &a, const short4 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_SHORT4(a + b.reg);
+#else
   return OCCA_SHORT4(a + b.x,
                      a + b.y,
                      a + b.z,
                      a + b.w);
+#endif
 }
 
 occaFunction inline short4  operator +  (const short4 &a, const short &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_SHORT4(a.reg + b);
+#else
   return OCCA_SHORT4(a.x + b,
                      a.y + b,
                      a.z + b,
                      a.w + b);
+#endif
 }
 
 occaFunction inline short4& operator += (      short4 &a, const short4 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.reg += b.reg;
+#else
   a.x += b.x;
   a.y += b.y;
   a.z += b.z;
   a.w += b.w;
+#endif
   return a;
 }
 
 occaFunction inline short4& operator += (      short4 &a, const short &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.reg += b;
+#else
   a.x += b;
   a.y += b;
   a.z += b;
   a.w += b;
+#endif
   return a;
 }
 occaFunction inline short4  operator -  (const short4 &a, const short4 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_SHORT4(a.reg - b.reg);
+#else
   return OCCA_SHORT4(a.x - b.x,
                      a.y - b.y,
                      a.z - b.z,
                      a.w - b.w);
+#endif
 }
 
 occaFunction inline short4  operator -  (const short &a, const short4 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_SHORT4(a - b.reg);
+#else
   return OCCA_SHORT4(a - b.x,
                      a - b.y,
                      a - b.z,
                      a - b.w);
+#endif
 }
 
 occaFunction inline short4  operator -  (const short4 &a, const short &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_SHORT4(a.reg - b);
+#else
   return OCCA_SHORT4(a.x - b,
                      a.y - b,
                      a.z - b,
                      a.w - b);
+#endif
 }
 
 occaFunction inline short4& operator -= (      short4 &a, const short4 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.reg -= b.reg;
+#else
   a.x -= b.x;
   a.y -= b.y;
   a.z -= b.z;
   a.w -= b.w;
+#endif
   return a;
 }
 
 occaFunction inline short4& operator -= (      short4 &a, const short &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.reg -= b;
+#else
   a.x -= b;
   a.y -= b;
   a.z -= b;
   a.w -= b;
+#endif
   return a;
 }
 occaFunction inline short4  operator *  (const short4 &a, const short4 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_SHORT4(a.reg * b.reg);
+#else
   return OCCA_SHORT4(a.x * b.x,
                      a.y * b.y,
                      a.z * b.z,
                      a.w * b.w);
+#endif
 }
 
 occaFunction inline short4  operator *  (const short &a, const short4 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_SHORT4(a * b.reg);
+#else
   return OCCA_SHORT4(a * b.x,
                      a * b.y,
                      a * b.z,
                      a * b.w);
+#endif
 }
 
 occaFunction inline short4  operator *  (const short4 &a, const short &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_SHORT4(a.reg * b);
+#else
   return OCCA_SHORT4(a.x * b,
                      a.y * b,
                      a.z * b,
                      a.w * b);
+#endif
 }
 
 occaFunction inline short4& operator *= (      short4 &a, const short4 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.reg *= b.reg;
+#else
   a.x *= b.x;
   a.y *= b.y;
   a.z *= b.z;
   a.w *= b.w;
+#endif
   return a;
 }
 
 occaFunction inline short4& operator *= (      short4 &a, const short &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.reg *= b;
+#else
   a.x *= b;
   a.y *= b;
   a.z *= b;
   a.w *= b;
+#endif
   return a;
 }
 occaFunction inline short4  operator /  (const short4 &a, const short4 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_SHORT4(a.reg / b.reg);
+#else
   return OCCA_SHORT4(a.x / b.x,
                      a.y / b.y,
                      a.z / b.z,
                      a.w / b.w);
+#endif
 }
 
 occaFunction inline short4  operator /  (const short &a, const short4 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_SHORT4(a / b.reg);
+#else
   return OCCA_SHORT4(a / b.x,
                      a / b.y,
                      a / b.z,
                      a / b.w);
+#endif
 }
 
 occaFunction inline short4  operator /  (const short4 &a, const short &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_SHORT4(a.reg / b);
+#else
   return OCCA_SHORT4(a.x / b,
                      a.y / b,
                      a.z / b,
                      a.w / b);
+#endif
 }
 
 occaFunction inline short4& operator /= (      short4 &a, const short4 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.reg /= b.reg;
+#else
   a.x /= b.x;
   a.y /= b.y;
   a.z /= b.z;
   a.w /= b.w;
+#endif
   return a;
 }
 
 occaFunction inline short4& operator /= (      short4 &a, const short &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.reg /= b;
+#else
   a.x /= b;
   a.y /= b;
   a.z /= b;
   a.w /= b;
+#endif
   return a;
 }
 
@@ -3905,8 +4835,16 @@ typedef short4 short3;
 
 //---[ short8 ]-------------------------
 #define OCCA_SHORT8 short8
+#if OCCA_VECTOR_EXTENSIONS
+typedef OCCA_VECTOR_EXT_TYPE(short, 8) occaVector_short8;
+#endif
 class short8{
 public:
+#if OCCA_VECTOR_EXTENSIONS
+  union {
+    occaVector_short8 reg;
+    struct {
+#endif
   union { short s0, x; };
   union { short s1, y; };
   union { short s2, z; };
@@ -3915,7 +4853,70 @@ public:
   short s5;
   short s6;
   short s7;
+#if OCCA_VECTOR_EXTENSIONS
+    };
+  };
+#endif
+
+#if OCCA_VECTOR_EXTENSIONS
+  inline occaFunction short8(const occaVector_short8 &reg_) : 
+    reg(reg_) {}
+
+  inline occaFunction short8() : 
+    reg((occaVector_short8) {0, 0, 0, 0, 0, 0, 0, 0}) {}
+
+  inline occaFunction short8(const short &x_) : 
+    reg((occaVector_short8) {x_, 0, 0, 0, 0, 0, 0, 0}) {}
+
+  inline occaFunction short8(const short &x_,
+                             const short &y_) : 
+    reg((occaVector_short8) {x_, y_, 0, 0, 0, 0, 0, 0}) {}
+
+  inline occaFunction short8(const short &x_,
+                             const short &y_,
+                             const short &z_) : 
+    reg((occaVector_short8) {x_, y_, z_, 0, 0, 0, 0, 0}) {}
+
+  inline occaFunction short8(const short &x_,
+                             const short &y_,
+                             const short &z_,
+                             const short &w_) : 
+    reg((occaVector_short8) {x_, y_, z_, w_, 0, 0, 0, 0}) {}
+
+  inline occaFunction short8(const short &x_,
+                             const short &y_,
+                             const short &z_,
+                             const short &w_,
+                             const short &s4_) : 
+    reg((occaVector_short8) {x_, y_, z_, w_, s4_, 0, 0, 0}) {}
+
+  inline occaFunction short8(const short &x_,
+                             const short &y_,
+                             const short &z_,
+                             const short &w_,
+                             const short &s4_,
+                             const short &s5_) : 
+    reg((occaVector_short8) {x_, y_, z_, w_, s4_, s5_, 0, 0}) {}
 
+  inline occaFunction short8(const short &x_,
+                             const short &y_,
+                             const short &z_,
+                             const short &w_,
+                             const short &s4_,
+                             const short &s5_,
+                             const short &s6_) : 
+    reg((occaVector_short8) {x_, y_, z_, w_, s4_, s5_, s6_, 0}) {}
+
+  inline occaFunction short8(const short &x_,
+                             const short &y_,
+                             const short &z_,
+                             const short &w_,
+                             const short &s4_,
+                             const short &s5_,
+                             const short &s6_,
+                             const short &s7_) : 
+    reg((occaVector_short8) {x_, y_, z_, w_, s4_, s5_, s6_, s7_}) {}
+#else
   inline occaFunction short8() : 
     x(0),
     y(0),
@@ -4033,9 +5034,13 @@ public:
     s5(s5_),
     s6(s6_),
     s7(s7_) {}
+#endif
 };
 
 occaFunction inline short8 operator + (const short8 &a){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_SHORT8(+a.reg);
+#else
   return OCCA_SHORT8(+a.x,
                      +a.y,
                      +a.z,
@@ -4044,6 +5049,7 @@ occaFunction inline short8 operator + (const short8 &a){
                      +a.s5,
                      +a.s6,
                      +a.s7);
+#endif
 }
 
 occaFunction inline short8 operator ++ (short8 &a, int){
@@ -4069,6 +5075,9 @@ occaFunction inline short8& operator ++ (short8 &a){
   return a;
 }
 occaFunction inline short8 operator - (const short8 &a){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_SHORT8(-a.reg);
+#else
   return OCCA_SHORT8(-a.x,
                      -a.y,
                      -a.z,
@@ -4077,6 +5086,7 @@ occaFunction inline short8 operator - (const short8 &a){
                      -a.s5,
                      -a.s6,
                      -a.s7);
+#endif
 }
 
 occaFunction inline short8 operator -- (short8 &a, int){
@@ -4102,6 +5112,9 @@ occaFunction inline short8& operator -- (short8 &a){
   return a;
 }
 occaFunction inline short8  operator +  (const short8 &a, const short8 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_SHORT8(a.reg + b.reg);
+#else
   return OCCA_SHORT8(a.x + b.x,
                      a.y + b.y,
                      a.z + b.z,
@@ -4110,9 +5123,13 @@ occaFunction inline short8  operator +  (const short8 &a, const short8 &b){
                      a.s5 + b.s5,
                      a.s6 + b.s6,
                      a.s7 + b.s7);
+#endif
 }
 
 occaFunction inline short8  operator +  (const short &a, const short8 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_SHORT8(a + b.reg);
+#else
   return OCCA_SHORT8(a + b.x,
                      a + b.y,
                      a + b.z,
@@ -4121,9 +5138,13 @@ occaFunction inline short8  operator +  (const short &a, const short8 &b){
                      a + b.s5,
                      a + b.s6,
                      a + b.s7);
+#endif
 }
 
 occaFunction inline short8  operator +  (const short8 &a, const short &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_SHORT8(a.reg + b);
+#else
   return OCCA_SHORT8(a.x + b,
                      a.y + b,
                      a.z + b,
@@ -4132,9 +5153,13 @@ occaFunction inline short8  operator +  (const short8 &a, const short &b){
                      a.s5 + b,
                      a.s6 + b,
                      a.s7 + b);
+#endif
 }
 
 occaFunction inline short8& operator += (      short8 &a, const short8 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.reg += b.reg;
+#else
   a.x += b.x;
   a.y += b.y;
   a.z += b.z;
@@ -4143,10 +5168,14 @@ occaFunction inline short8& operator += (      short8 &a, const short8 &b){
   a.s5 += b.s5;
   a.s6 += b.s6;
   a.s7 += b.s7;
+#endif
   return a;
 }
 
 occaFunction inline short8& operator += (      short8 &a, const short &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.reg += b;
+#else
   a.x += b;
   a.y += b;
   a.z += b;
@@ -4155,9 +5184,13 @@ occaFunction inline short8& operator += (      short8 &a, const short &b){
   a.s5 += b;
   a.s6 += b;
   a.s7 += b;
+#endif
   return a;
 }
 occaFunction inline short8  operator -  (const short8 &a, const short8 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_SHORT8(a.reg - b.reg);
+#else
   return OCCA_SHORT8(a.x - b.x,
                      a.y - b.y,
                      a.z - b.z,
@@ -4166,9 +5199,13 @@ occaFunction inline short8  operator -  (const short8 &a, const short8 &b){
                      a.s5 - b.s5,
                      a.s6 - b.s6,
                      a.s7 - b.s7);
+#endif
 }
 
 occaFunction inline short8  operator -  (const short &a, const short8 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_SHORT8(a - b.reg);
+#else
   return OCCA_SHORT8(a - b.x,
                      a - b.y,
                      a - b.z,
@@ -4177,9 +5214,13 @@ occaFunction inline short8  operator -  (const short &a, const short8 &b){
                      a - b.s5,
                      a - b.s6,
                      a - b.s7);
+#endif
 }
 
 occaFunction inline short8  operator -  (const short8 &a, const short &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_SHORT8(a.reg - b);
+#else
   return OCCA_SHORT8(a.x - b,
                      a.y - b,
                      a.z - b,
@@ -4188,9 +5229,13 @@ occaFunction inline short8  operator -  (const short8 &a, const short &b){
                      a.s5 - b,
                      a.s6 - b,
                      a.s7 - b);
+#endif
 }
 
 occaFunction inline short8& operator -= (      short8 &a, const short8 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.reg -= b.reg;
+#else
   a.x -= b.x;
   a.y -= b.y;
   a.z -= b.z;
@@ -4199,10 +5244,14 @@ occaFunction inline short8& operator -= (      short8 &a, const short8 &b){
   a.s5 -= b.s5;
   a.s6 -= b.s6;
   a.s7 -= b.s7;
+#endif
   return a;
 }
 
 occaFunction inline short8& operator -= (      short8 &a, const short &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.reg -= b;
+#else
   a.x -= b;
   a.y -= b;
   a.z -= b;
@@ -4211,9 +5260,13 @@ occaFunction inline short8& operator -= (      short8 &a, const short &b){
   a.s5 -= b;
   a.s6 -= b;
   a.s7 -= b;
+#endif
   return a;
 }
 occaFunction inline short8  operator *  (const short8 &a, const short8 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_SHORT8(a.reg * b.reg);
+#else
   return OCCA_SHORT8(a.x * b.x,
                      a.y * b.y,
                      a.z * b.z,
@@ -4222,9 +5275,13 @@ occaFunction inline short8  operator *  (const short8 &a, const short8 &b){
                      a.s5 * b.s5,
                      a.s6 * b.s6,
                      a.s7 * b.s7);
+#endif
 }
 
 occaFunction inline short8  operator *  (const short &a, const short8 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_SHORT8(a * b.reg);
+#else
   return OCCA_SHORT8(a * b.x,
                      a * b.y,
                      a * b.z,
@@ -4233,9 +5290,13 @@ occaFunction inline short8  operator *  (const short &a, const short8 &b){
                      a * b.s5,
                      a * b.s6,
                      a * b.s7);
+#endif
 }
 
 occaFunction inline short8  operator *  (const short8 &a, const short &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_SHORT8(a.reg * b);
+#else
   return OCCA_SHORT8(a.x * b,
                      a.y * b,
                      a.z * b,
@@ -4244,9 +5305,13 @@ occaFunction inline short8  operator *  (const short8 &a, const short &b){
                      a.s5 * b,
                      a.s6 * b,
                      a.s7 * b);
+#endif
 }
 
 occaFunction inline short8& operator *= (      short8 &a, const short8 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.reg *= b.reg;
+#else
   a.x *= b.x;
   a.y *= b.y;
   a.z *= b.z;
@@ -4255,10 +5320,14 @@ occaFunction inline short8& operator *= (      short8 &a, const short8 &b){
   a.s5 *= b.s5;
   a.s6 *= b.s6;
   a.s7 *= b.s7;
+#endif
   return a;
 }
 
 occaFunction inline short8& operator *= (      short8 &a, const short &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.reg *= b;
+#else
   a.x *= b;
   a.y *= b;
   a.z *= b;
@@ -4267,9 +5336,13 @@ occaFunction inline short8& operator *= (      short8 &a, const short &b){
   a.s5 *= b;
   a.s6 *= b;
   a.s7 *= b;
+#endif
   return a;
 }
 occaFunction inline short8  operator /  (const short8 &a, const short8 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_SHORT8(a.reg / b.reg);
+#else
   return OCCA_SHORT8(a.x / b.x,
                      a.y / b.y,
                      a.z / b.z,
@@ -4278,9 +5351,13 @@ occaFunction inline short8  operator /  (const short8 &a, const short8 &b){
                      a.s5 / b.s5,
                      a.s6 / b.s6,
                      a.s7 / b.s7);
+#endif
 }
 
 occaFunction inline short8  operator /  (const short &a, const short8 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_SHORT8(a / b.reg);
+#else
   return OCCA_SHORT8(a / b.x,
                      a / b.y,
                      a / b.z,
@@ -4289,9 +5366,13 @@ occaFunction inline short8  operator /  (const short &a, const short8 &b){
                      a / b.s5,
                      a / b.s6,
                      a / b.s7);
+#endif
 }
 
 occaFunction inline short8  operator /  (const short8 &a, const short &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_SHORT8(a.reg / b);
+#else
   return OCCA_SHORT8(a.x / b,
                      a.y / b,
                      a.z / b,
@@ -4300,9 +5381,13 @@ occaFunction inline short8  operator /  (const short8 &a, const short &b){
                      a.s5 / b,
                      a.s6 / b,
                      a.s7 / b);
+#endif
 }
 
 occaFunction inline short8& operator /= (      short8 &a, const short8 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.reg /= b.reg;
+#else
   a.x /= b.x;
   a.y /= b.y;
   a.z /= b.z;
@@ -4311,10 +5396,14 @@ occaFunction inline short8& operator /= (      short8 &a, const short8 &b){
   a.s5 /= b.s5;
   a.s6 /= b.s6;
   a.s7 /= b.s7;
+#endif
   return a;
 }
 
 occaFunction inline short8& operator /= (      short8 &a, const short &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.reg /= b;
+#else
   a.x /= b;
   a.y /= b;
   a.z /= b;
@@ -4323,6 +5412,7 @@ occaFunction inline short8& operator /= (      short8 &a, const short &b){
   a.s5 /= b;
   a.s6 /= b;
   a.s7 /= b;
+#endif
   return a;
 }
 
@@ -4347,8 +5437,16 @@ inline std::ostream& operator << (std::ostream &out, const short8& a){
 
 //---[ short16 ]------------------------
 #define OCCA_SHORT16 short16
+#if OCCA_VECTOR_EXTENSIONS
+typedef OCCA_VECTOR_EXT_TYPE(short, 16) occaVector_short16;
+#endif
 class short16{
 public:
+#if OCCA_VECTOR_EXTENSIONS
+  union {
+    occaVector_short16 reg;
+    struct {
+#endif
   union { short s0, x; };
   union { short s1, y; };
   union { short s2, z; };
@@ -4365,77 +5463,256 @@ public:
   short s13;
   short s14;
   short s15;
+#if OCCA_VECTOR_EXTENSIONS
+    };
+  };
+#endif
+
+#if OCCA_VECTOR_EXTENSIONS
+  inline occaFunction short16(const occaVector_short16 &reg_) : 
+    reg(reg_) {}
 
   inline occaFunction short16() : 
-    x(0),
-    y(0),
-    z(0),
-    w(0),
-    s4(0),
-    s5(0),
-    s6(0),
-    s7(0),
-    s8(0),
-    s9(0),
-    s10(0),
-    s11(0),
-    s12(0),
-    s13(0),
-    s14(0),
-    s15(0) {}
+    reg((occaVector_short16) {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}) {}
 
   inline occaFunction short16(const short &x_) : 
-    x(x_),
-    y(0),
-    z(0),
-    w(0),
-    s4(0),
-    s5(0),
-    s6(0),
-    s7(0),
-    s8(0),
-    s9(0),
-    s10(0),
-    s11(0),
-    s12(0),
-    s13(0),
-    s14(0),
-    s15(0) {}
+    reg((occaVector_short16) {x_, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}) {}
 
   inline occaFunction short16(const short &x_,
                               const short &y_) : 
-    x(x_),
-    y(y_),
-    z(0),
-    w(0),
-    s4(0),
-    s5(0),
-    s6(0),
-    s7(0),
-    s8(0),
-    s9(0),
-    s10(0),
-    s11(0),
-    s12(0),
-    s13(0),
-    s14(0),
-    s15(0) {}
+    reg((occaVector_short16) {x_, y_, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}) {}
 
   inline occaFunction short16(const short &x_,
                               const short &y_,
                               const short &z_) : 
-    x(x_),
-    y(y_),
-    z(z_),
-    w(0),
-    s4(0),
-    s5(0),
-    s6(0),
-    s7(0),
-    s8(0),
-    s9(0),
-    s10(0),
-    s11(0),
+    reg((occaVector_short16) {x_, y_, z_, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}) {}
+
+  inline occaFunction short16(const short &x_,
+                              const short &y_,
+                              const short &z_,
+                              const short &w_) : 
+    reg((occaVector_short16) {x_, y_, z_, w_, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}) {}
+
+  inline occaFunction short16(const short &x_,
+                              const short &y_,
+                              const short &z_,
+                              const short &w_,
+                              const short &s4_) : 
+    reg((occaVector_short16) {x_, y_, z_, w_, s4_, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}) {}
+
+  inline occaFunction short16(const short &x_,
+                              const short &y_,
+                              const short &z_,
+                              const short &w_,
+                              const short &s4_,
+                              const short &s5_) : 
+    reg((occaVector_short16) {x_, y_, z_, w_, s4_, s5_, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}) {}
+
+  inline occaFunction short16(const short &x_,
+                              const short &y_,
+                              const short &z_,
+                              const short &w_,
+                              const short &s4_,
+                              const short &s5_,
+                              const short &s6_) : 
+    reg((occaVector_short16) {x_, y_, z_, w_, s4_, s5_, s6_, 0, 0, 0, 0, 0, 0, 0, 0, 0}) {}
+
+  inline occaFunction short16(const short &x_,
+                              const short &y_,
+                              const short &z_,
+                              const short &w_,
+                              const short &s4_,
+                              const short &s5_,
+                              const short &s6_,
+                              const short &s7_) : 
+    reg((occaVector_short16) {x_, y_, z_, w_, s4_, s5_, s6_, s7_, 0, 0, 0, 0, 0, 0, 0, 0}) {}
+
+  inline occaFunction short16(const short &x_,
+                              const short &y_,
+                              const short &z_,
+                              const short &w_,
+                              const short &s4_,
+                              const short &s5_,
+                              const short &s6_,
+                              const short &s7_,
+                              const short &s8_) : 
+    reg((occaVector_short16) {x_, y_, z_, w_, s4_, s5_, s6_, s7_, s8_, 0, 0, 0, 0, 0, 0, 0}) {}
+
+  inline occaFunction short16(const short &x_,
+                              const short &y_,
+                              const short &z_,
+                              const short &w_,
+                              const short &s4_,
+                              const short &s5_,
+                              const short &s6_,
+                              const short &s7_,
+                              const short &s8_,
+                              const short &s9_) : 
+    reg((occaVector_short16) {x_, y_, z_, w_, s4_, s5_, s6_, s7_, s8_, s9_, 0, 0, 0, 0, 0, 0}) {}
+
+  inline occaFunction short16(const short &x_,
+                              const short &y_,
+                              const short &z_,
+                              const short &w_,
+                              const short &s4_,
+                              const short &s5_,
+                              const short &s6_,
+                              const short &s7_,
+                              const short &s8_,
+                              const short &s9_,
+                              const short &s10_) : 
+    reg((occaVector_short16) {x_, y_, z_, w_, s4_, s5_, s6_, s7_, s8_, s9_, s10_, 0, 0, 0, 0, 0}) {}
+
+  inline occaFunction short16(const short &x_,
+                              const short &y_,
+                              const short &z_,
+                              const short &w_,
+                              const short &s4_,
+                              const short &s5_,
+                              const short &s6_,
+                              const short &s7_,
+                              const short &s8_,
+                              const short &s9_,
+                              const short &s10_,
+                              const short &s11_) : 
+    reg((occaVector_short16) {x_, y_, z_, w_, s4_, s5_, s6_, s7_, s8_, s9_, s10_, s11_, 0, 0, 0, 0}) {}
+
+  inline occaFunction short16(const short &x_,
+                              const short &y_,
+                              const short &z_,
+                              const short &w_,
+                              const short &s4_,
+                              const short &s5_,
+                              const short &s6_,
+                              const short &s7_,
+                              const short &s8_,
+                              const short &s9_,
+                              const short &s10_,
+                              const short &s11_,
+                              const short &s12_) : 
+    reg((occaVector_short16) {x_, y_, z_, w_, s4_, s5_, s6_, s7_, s8_, s9_, s10_, s11_, s12_, 0, 0, 0}) {}
+
+  inline occaFunction short16(const short &x_,
+                              const short &y_,
+                              const short &z_,
+                              const short &w_,
+                              const short &s4_,
+                              const short &s5_,
+                              const short &s6_,
+                              const short &s7_,
+                              const short &s8_,
+                              const short &s9_,
+                              const short &s10_,
+                              const short &s11_,
+                              const short &s12_,
+                              const short &s13_) : 
+    reg((occaVector_short16) {x_, y_, z_, w_, s4_, s5_, s6_, s7_, s8_, s9_, s10_, s11_, s12_, s13_, 0, 0}) {}
+
+  inline occaFunction short16(const short &x_,
+                              const short &y_,
+                              const short &z_,
+                              const short &w_,
+                              const short &s4_,
+                              const short &s5_,
+                              const short &s6_,
+                              const short &s7_,
+                              const short &s8_,
+                              const short &s9_,
+                              const short &s10_,
+                              const short &s11_,
+                              const short &s12_,
+                              const short &s13_,
+                              const short &s14_) : 
+    reg((occaVector_short16) {x_, y_, z_, w_, s4_, s5_, s6_, s7_, s8_, s9_, s10_, s11_, s12_, s13_, s14_, 0}) {}
+
+  inline occaFunction short16(const short &x_,
+                              const short &y_,
+                              const short &z_,
+                              const short &w_,
+                              const short &s4_,
+                              const short &s5_,
+                              const short &s6_,
+                              const short &s7_,
+                              const short &s8_,
+                              const short &s9_,
+                              const short &s10_,
+                              const short &s11_,
+                              const short &s12_,
+                              const short &s13_,
+                              const short &s14_,
+                              const short &s15_) : 
+    reg((occaVector_short16) {x_, y_, z_, w_, s4_, s5_, s6_, s7_, s8_, s9_, s10_, s11_, s12_, s13_, s14_, s15_}) {}
+#else
+  inline occaFunction short16() : 
+    x(0),
+    y(0),
+    z(0),
+    w(0),
+    s4(0),
+    s5(0),
+    s6(0),
+    s7(0),
+    s8(0),
+    s9(0),
+    s10(0),
+    s11(0),
+    s12(0),
+    s13(0),
+    s14(0),
+    s15(0) {}
+
+  inline occaFunction short16(const short &x_) : 
+    x(x_),
+    y(0),
+    z(0),
+    w(0),
+    s4(0),
+    s5(0),
+    s6(0),
+    s7(0),
+    s8(0),
+    s9(0),
+    s10(0),
+    s11(0),
+    s12(0),
+    s13(0),
+    s14(0),
+    s15(0) {}
+
+  inline occaFunction short16(const short &x_,
+                              const short &y_) : 
+    x(x_),
+    y(y_),
+    z(0),
+    w(0),
+    s4(0),
+    s5(0),
+    s6(0),
+    s7(0),
+    s8(0),
+    s9(0),
+    s10(0),
+    s11(0),
+    s12(0),
+    s13(0),
+    s14(0),
+    s15(0) {}
+
+  inline occaFunction short16(const short &x_,
+                              const short &y_,
+                              const short &z_) : 
+    x(x_),
+    y(y_),
+    z(z_),
+    w(0),
+    s4(0),
+    s5(0),
+    s6(0),
+    s7(0),
+    s8(0),
+    s9(0),
+    s10(0),
+    s11(0),
     s12(0),
     s13(0),
     s14(0),
@@ -4791,9 +6068,13 @@ public:
     s13(s13_),
     s14(s14_),
     s15(s15_) {}
+#endif
 };
 
 occaFunction inline short16 operator + (const short16 &a){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_SHORT16(+a.reg);
+#else
   return OCCA_SHORT16(+a.x,
                       +a.y,
                       +a.z,
@@ -4810,6 +6091,7 @@ occaFunction inline short16 operator + (const short16 &a){
                       +a.s13,
                       +a.s14,
                       +a.s15);
+#endif
 }
 
 occaFunction inline short16 operator ++ (short16 &a, int){
@@ -4851,6 +6133,9 @@ occaFunction inline short16& operator ++ (short16 &a){
   return a;
 }
 occaFunction inline short16 operator - (const short16 &a){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_SHORT16(-a.reg);
+#else
   return OCCA_SHORT16(-a.x,
                       -a.y,
                       -a.z,
@@ -4867,6 +6152,7 @@ occaFunction inline short16 operator - (const short16 &a){
                       -a.s13,
                       -a.s14,
                       -a.s15);
+#endif
 }
 
 occaFunction inline short16 operator -- (short16 &a, int){
@@ -4908,6 +6194,9 @@ occaFunction inline short16& operator -- (short16 &a){
   return a;
 }
 occaFunction inline short16  operator +  (const short16 &a, const short16 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_SHORT16(a.reg + b.reg);
+#else
   return OCCA_SHORT16(a.x + b.x,
                       a.y + b.y,
                       a.z + b.z,
@@ -4924,9 +6213,13 @@ occaFunction inline short16  operator +  (const short16 &a, const short16 &b){
                       a.s13 + b.s13,
                       a.s14 + b.s14,
                       a.s15 + b.s15);
+#endif
 }
 
 occaFunction inline short16  operator +  (const short &a, const short16 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_SHORT16(a + b.reg);
+#else
   return OCCA_SHORT16(a + b.x,
                       a + b.y,
                       a + b.z,
@@ -4943,9 +6236,13 @@ occaFunction inline short16  operator +  (const short &a, const short16 &b){
                       a + b.s13,
                       a + b.s14,
                       a + b.s15);
+#endif
 }
 
 occaFunction inline short16  operator +  (const short16 &a, const short &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_SHORT16(a.reg + b);
+#else
   return OCCA_SHORT16(a.x + b,
                       a.y + b,
                       a.z + b,
@@ -4962,9 +6259,13 @@ occaFunction inline short16  operator +  (const short16 &a, const short &b){
                       a.s13 + b,
                       a.s14 + b,
                       a.s15 + b);
+#endif
 }
 
 occaFunction inline short16& operator += (      short16 &a, const short16 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.reg += b.reg;
+#else
   a.x += b.x;
   a.y += b.y;
   a.z += b.z;
@@ -4981,10 +6282,14 @@ occaFunction inline short16& operator += (      short16 &a, const short16 &b){
   a.s13 += b.s13;
   a.s14 += b.s14;
   a.s15 += b.s15;
+#endif
   return a;
 }
 
 occaFunction inline short16& operator += (      short16 &a, const short &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.reg += b;
+#else
   a.x += b;
   a.y += b;
   a.z += b;
@@ -5001,9 +6306,13 @@ occaFunction inline short16& operator += (      short16 &a, const short &b){
   a.s13 += b;
   a.s14 += b;
   a.s15 += b;
+#endif
   return a;
 }
 occaFunction inline short16  operator -  (const short16 &a, const short16 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_SHORT16(a.reg - b.reg);
+#else
   return OCCA_SHORT16(a.x - b.x,
                       a.y - b.y,
                       a.z - b.z,
@@ -5020,9 +6329,13 @@ occaFunction inline short16  operator -  (const short16 &a, const short16 &b){
                       a.s13 - b.s13,
                       a.s14 - b.s14,
                       a.s15 - b.s15);
+#endif
 }
 
 occaFunction inline short16  operator -  (const short &a, const short16 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_SHORT16(a - b.reg);
+#else
   return OCCA_SHORT16(a - b.x,
                       a - b.y,
                       a - b.z,
@@ -5039,9 +6352,13 @@ occaFunction inline short16  operator -  (const short &a, const short16 &b){
                       a - b.s13,
                       a - b.s14,
                       a - b.s15);
+#endif
 }
 
 occaFunction inline short16  operator -  (const short16 &a, const short &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_SHORT16(a.reg - b);
+#else
   return OCCA_SHORT16(a.x - b,
                       a.y - b,
                       a.z - b,
@@ -5058,9 +6375,13 @@ occaFunction inline short16  operator -  (const short16 &a, const short &b){
                       a.s13 - b,
                       a.s14 - b,
                       a.s15 - b);
+#endif
 }
 
 occaFunction inline short16& operator -= (      short16 &a, const short16 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.reg -= b.reg;
+#else
   a.x -= b.x;
   a.y -= b.y;
   a.z -= b.z;
@@ -5077,10 +6398,14 @@ occaFunction inline short16& operator -= (      short16 &a, const short16 &b){
   a.s13 -= b.s13;
   a.s14 -= b.s14;
   a.s15 -= b.s15;
+#endif
   return a;
 }
 
 occaFunction inline short16& operator -= (      short16 &a, const short &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.reg -= b;
+#else
   a.x -= b;
   a.y -= b;
   a.z -= b;
@@ -5097,9 +6422,13 @@ occaFunction inline short16& operator -= (      short16 &a, const short &b){
   a.s13 -= b;
   a.s14 -= b;
   a.s15 -= b;
+#endif
   return a;
 }
 occaFunction inline short16  operator *  (const short16 &a, const short16 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_SHORT16(a.reg * b.reg);
+#else
   return OCCA_SHORT16(a.x * b.x,
                       a.y * b.y,
                       a.z * b.z,
@@ -5116,9 +6445,13 @@ occaFunction inline short16  operator *  (const short16 &a, const short16 &b){
                       a.s13 * b.s13,
                       a.s14 * b.s14,
                       a.s15 * b.s15);
+#endif
 }
 
 occaFunction inline short16  operator *  (const short &a, const short16 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_SHORT16(a * b.reg);
+#else
   return OCCA_SHORT16(a * b.x,
                       a * b.y,
                       a * b.z,
@@ -5135,9 +6468,13 @@ occaFunction inline short16  operator *  (const short &a, const short16 &b){
                       a * b.s13,
                       a * b.s14,
                       a * b.s15);
+#endif
 }
 
 occaFunction inline short16  operator *  (const short16 &a, const short &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_SHORT16(a.reg * b);
+#else
   return OCCA_SHORT16(a.x * b,
                       a.y * b,
                       a.z * b,
@@ -5154,9 +6491,13 @@ occaFunction inline short16  operator *  (const short16 &a, const short &b){
                       a.s13 * b,
                       a.s14 * b,
                       a.s15 * b);
+#endif
 }
 
 occaFunction inline short16& operator *= (      short16 &a, const short16 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.reg *= b.reg;
+#else
   a.x *= b.x;
   a.y *= b.y;
   a.z *= b.z;
@@ -5173,10 +6514,14 @@ occaFunction inline short16& operator *= (      short16 &a, const short16 &b){
   a.s13 *= b.s13;
   a.s14 *= b.s14;
   a.s15 *= b.s15;
+#endif
   return a;
 }
 
 occaFunction inline short16& operator *= (      short16 &a, const short &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.reg *= b;
+#else
   a.x *= b;
   a.y *= b;
   a.z *= b;
@@ -5193,9 +6538,13 @@ occaFunction inline short16& operator *= (      short16 &a, const short &b){
   a.s13 *= b;
   a.s14 *= b;
   a.s15 *= b;
+#endif
   return a;
 }
 occaFunction inline short16  operator /  (const short16 &a, const short16 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_SHORT16(a.reg / b.reg);
+#else
   return OCCA_SHORT16(a.x / b.x,
                       a.y / b.y,
                       a.z / b.z,
@@ -5212,9 +6561,13 @@ occaFunction inline short16  operator /  (const short16 &a, const short16 &b){
                       a.s13 / b.s13,
                       a.s14 / b.s14,
                       a.s15 / b.s15);
+#endif
 }
 
 occaFunction inline short16  operator /  (const short &a, const short16 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_SHORT16(a / b.reg);
+#else
   return OCCA_SHORT16(a / b.x,
                       a / b.y,
                       a / b.z,
@@ -5231,9 +6584,13 @@ occaFunction inline short16  operator /  (const short &a, const short16 &b){
                       a / b.s13,
                       a / b.s14,
                       a / b.s15);
+#endif
 }
 
 occaFunction inline short16  operator /  (const short16 &a, const short &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_SHORT16(a.reg / b);
+#else
   return OCCA_SHORT16(a.x / b,
                       a.y / b,
                       a.z / b,
@@ -5250,9 +6607,13 @@ occaFunction inline short16  operator /  (const short16 &a, const short &b){
                       a.s13 / b,
                       a.s14 / b,
                       a.s15 / b);
+#endif
 }
 
 occaFunction inline short16& operator /= (      short16 &a, const short16 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.reg /= b.reg;
+#else
   a.x /= b.x;
   a.y /= b.y;
   a.z /= b.z;
@@ -5269,10 +6630,14 @@ occaFunction inline short16& operator /= (      short16 &a, const short16 &b){
   a.s13 /= b.s13;
   a.s14 /= b.s14;
   a.s15 /= b.s15;
+#endif
   return a;
 }
 
 occaFunction inline short16& operator /= (      short16 &a, const short &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.reg /= b;
+#else
   a.x /= b;
   a.y /= b;
   a.z /= b;
@@ -5289,6 +6654,7 @@ occaFunction inline short16& operator /= (      short16 &a, const short &b){
   a.s13 /= b;
   a.s14 /= b;
   a.s15 /= b;
+#endif
   return a;
 }
 
@@ -5326,11 +6692,37 @@ inline std::ostream& operator << (std::ostream &out, const short16& a){
 #  define OCCA_INT2 int2
 #endif
 #if (!defined(OCCA_IN_KERNEL) || (OCCA_USING_CUDA == 0))
+#if OCCA_VECTOR_EXTENSIONS
+typedef OCCA_VECTOR_EXT_TYPE(int, 2) occaVector_int2;
+#endif
 class int2{
 public:
+#if OCCA_VECTOR_EXTENSIONS
+  union {
+    occaVector_int2 reg;
+    struct {
+#endif
   union { int s0, x; };
   union { int s1, y; };
+#if OCCA_VECTOR_EXTENSIONS
+    };
+  };
+#endif
 
+#if OCCA_VECTOR_EXTENSIONS
+  inline occaFunction int2(const occaVector_int2 &reg_) : 
+    reg(reg_) {}
+
+  inline occaFunction int2() : 
+    reg((occaVector_int2) {0, 0}) {}
+
+  inline occaFunction int2(const int &x_) : 
+    reg((occaVector_int2) {x_, 0}) {}
+
+  inline occaFunction int2(const int &x_,
+                           const int &y_) : 
+    reg((occaVector_int2) {x_, y_}) {}
+#else
   inline occaFunction int2() : 
     x(0),
     y(0) {}
@@ -5343,12 +6735,17 @@ public:
                            const int &y_) : 
     x(x_),
     y(y_) {}
+#endif
 };
 #endif
 
 occaFunction inline int2 operator + (const int2 &a){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_INT2(+a.reg);
+#else
   return OCCA_INT2(+a.x,
                    +a.y);
+#endif
 }
 
 occaFunction inline int2 operator ++ (int2 &a, int){
@@ -5362,8 +6759,12 @@ occaFunction inline int2& operator ++ (int2 &a){
   return a;
 }
 occaFunction inline int2 operator - (const int2 &a){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_INT2(-a.reg);
+#else
   return OCCA_INT2(-a.x,
                    -a.y);
+#endif
 }
 
 occaFunction inline int2 operator -- (int2 &a, int){
@@ -5377,107 +6778,187 @@ occaFunction inline int2& operator -- (int2 &a){
   return a;
 }
 occaFunction inline int2  operator +  (const int2 &a, const int2 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_INT2(a.reg + b.reg);
+#else
   return OCCA_INT2(a.x + b.x,
                    a.y + b.y);
+#endif
 }
 
 occaFunction inline int2  operator +  (const int &a, const int2 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_INT2(a + b.reg);
+#else
   return OCCA_INT2(a + b.x,
                    a + b.y);
+#endif
 }
 
 occaFunction inline int2  operator +  (const int2 &a, const int &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_INT2(a.reg + b);
+#else
   return OCCA_INT2(a.x + b,
                    a.y + b);
+#endif
 }
 
 occaFunction inline int2& operator += (      int2 &a, const int2 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.reg += b.reg;
+#else
   a.x += b.x;
   a.y += b.y;
+#endif
   return a;
 }
 
 occaFunction inline int2& operator += (      int2 &a, const int &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.reg += b;
+#else
   a.x += b;
   a.y += b;
+#endif
   return a;
 }
 occaFunction inline int2  operator -  (const int2 &a, const int2 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_INT2(a.reg - b.reg);
+#else
   return OCCA_INT2(a.x - b.x,
                    a.y - b.y);
+#endif
 }
 
 occaFunction inline int2  operator -  (const int &a, const int2 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_INT2(a - b.reg);
+#else
   return OCCA_INT2(a - b.x,
                    a - b.y);
+#endif
 }
 
 occaFunction inline int2  operator -  (const int2 &a, const int &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_INT2(a.reg - b);
+#else
   return OCCA_INT2(a.x - b,
                    a.y - b);
+#endif
 }
 
 occaFunction inline int2& operator -= (      int2 &a, const int2 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.reg -= b.reg;
+#else
   a.x -= b.x;
   a.y -= b.y;
+#endif
   return a;
 }
 
 occaFunction inline int2& operator -= (      int2 &a, const int &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.reg -= b;
+#else
   a.x -= b;
   a.y -= b;
+#endif
   return a;
 }
 occaFunction inline int2  operator *  (const int2 &a, const int2 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_INT2(a.reg * b.reg);
+#else
   return OCCA_INT2(a.x * b.x,
                    a.y * b.y);
+#endif
 }
 
 occaFunction inline int2  operator *  (const int &a, const int2 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_INT2(a * b.reg);
+#else
   return OCCA_INT2(a * b.x,
                    a * b.y);
+#endif
 }
 
 occaFunction inline int2  operator *  (const int2 &a, const int &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_INT2(a.reg * b);
+#else
   return OCCA_INT2(a.x * b,
                    a.y * b);
+#endif
 }
 
 occaFunction inline int2& operator *= (      int2 &a, const int2 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.reg *= b.reg;
+#else
   a.x *= b.x;
   a.y *= b.y;
+#endif
   return a;
 }
 
 occaFunction inline int2& operator *= (      int2 &a, const int &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.reg *= b;
+#else
   a.x *= b;
   a.y *= b;
+#endif
   return a;
 }
 occaFunction inline int2  operator /  (const int2 &a, const int2 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_INT2(a.reg / b.reg);
+#else
   return OCCA_INT2(a.x / b.x,
                    a.y / b.y);
+#endif
 }
 
 occaFunction inline int2  operator /  (const int &a, const int2 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_INT2(a / b.reg);
+#else
   return OCCA_INT2(a / b.x,
                    a / b.y);
+#endif
 }
 
 occaFunction inline int2  operator /  (const int2 &a, const int &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_INT2(a.reg / b);
+#else
   return OCCA_INT2(a.x / b,
                    a.y / b);
+#endif
 }
 
 occaFunction inline int2& operator /= (      int2 &a, const int2 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.reg /= b.reg;
+#else
   a.x /= b.x;
   a.y /= b.y;
+#endif
   return a;
 }
 
 occaFunction inline int2& operator /= (      int2 &a, const int &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.reg /= b;
+#else
   a.x /= b;
   a.y /= b;
+#endif
   return a;
 }
 
@@ -5501,13 +6982,50 @@ inline std::ostream& operator << (std::ostream &out, const int2& a){
 #  define OCCA_INT4 int4
 #endif
 #if (!defined(OCCA_IN_KERNEL) || (OCCA_USING_CUDA == 0))
+#if OCCA_VECTOR_EXTENSIONS
+typedef OCCA_VECTOR_EXT_TYPE(int, 4) occaVector_int4;
+#endif
 class int4{
 public:
+#if OCCA_VECTOR_EXTENSIONS
+  union {
+    occaVector_int4 reg;
+    struct {
+#endif
   union { int s0, x; };
   union { int s1, y; };
   union { int s2, z; };
   union { int s3, w; };
+#if OCCA_VECTOR_EXTENSIONS
+    };
+  };
+#endif
+
+#if OCCA_VECTOR_EXTENSIONS
+  inline occaFunction int4(const occaVector_int4 &reg_) : 
+    reg(reg_) {}
+
+  inline occaFunction int4() : 
+    reg((occaVector_int4) {0, 0, 0, 0}) {}
+
+  inline occaFunction int4(const int &x_) : 
+    reg((occaVector_int4) {x_, 0, 0, 0}) {}
+
+  inline occaFunction int4(const int &x_,
+                           const int &y_) : 
+    reg((occaVector_int4) {x_, y_, 0, 0}) {}
+
+  inline occaFunction int4(const int &x_,
+                           const int &y_,
+                           const int &z_) : 
+    reg((occaVector_int4) {x_, y_, z_, 0}) {}
 
+  inline occaFunction int4(const int &x_,
+                           const int &y_,
+                           const int &z_,
+                           const int &w_) : 
+    reg((occaVector_int4) {x_, y_, z_, w_}) {}
+#else
   inline occaFunction int4() : 
     x(0),
     y(0),
@@ -5543,14 +7061,19 @@ public:
     y(y_),
     z(z_),
     w(w_) {}
+#endif
 };
 #endif
 
 occaFunction inline int4 operator + (const int4 &a){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_INT4(+a.reg);
+#else
   return OCCA_INT4(+a.x,
                    +a.y,
                    +a.z,
                    +a.w);
+#endif
 }
 
 occaFunction inline int4 operator ++ (int4 &a, int){
@@ -5568,10 +7091,14 @@ occaFunction inline int4& operator ++ (int4 &a){
   return a;
 }
 occaFunction inline int4 operator - (const int4 &a){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_INT4(-a.reg);
+#else
   return OCCA_INT4(-a.x,
                    -a.y,
                    -a.z,
                    -a.w);
+#endif
 }
 
 occaFunction inline int4 operator -- (int4 &a, int){
@@ -5589,147 +7116,227 @@ occaFunction inline int4& operator -- (int4 &a){
   return a;
 }
 occaFunction inline int4  operator +  (const int4 &a, const int4 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_INT4(a.reg + b.reg);
+#else
   return OCCA_INT4(a.x + b.x,
                    a.y + b.y,
                    a.z + b.z,
                    a.w + b.w);
+#endif
 }
 
 occaFunction inline int4  operator +  (const int &a, const int4 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_INT4(a + b.reg);
+#else
   return OCCA_INT4(a + b.x,
                    a + b.y,
                    a + b.z,
                    a + b.w);
+#endif
 }
 
 occaFunction inline int4  operator +  (const int4 &a, const int &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_INT4(a.reg + b);
+#else
   return OCCA_INT4(a.x + b,
                    a.y + b,
                    a.z + b,
                    a.w + b);
+#endif
 }
 
 occaFunction inline int4& operator += (      int4 &a, const int4 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.reg += b.reg;
+#else
   a.x += b.x;
   a.y += b.y;
   a.z += b.z;
   a.w += b.w;
+#endif
   return a;
 }
 
 occaFunction inline int4& operator += (      int4 &a, const int &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.reg += b;
+#else
   a.x += b;
   a.y += b;
   a.z += b;
   a.w += b;
+#endif
   return a;
 }
 occaFunction inline int4  operator -  (const int4 &a, const int4 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_INT4(a.reg - b.reg);
+#else
   return OCCA_INT4(a.x - b.x,
                    a.y - b.y,
                    a.z - b.z,
                    a.w - b.w);
+#endif
 }
 
 occaFunction inline int4  operator -  (const int &a, const int4 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_INT4(a - b.reg);
+#else
   return OCCA_INT4(a - b.x,
                    a - b.y,
                    a - b.z,
                    a - b.w);
+#endif
 }
 
 occaFunction inline int4  operator -  (const int4 &a, const int &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_INT4(a.reg - b);
+#else
   return OCCA_INT4(a.x - b,
                    a.y - b,
                    a.z - b,
                    a.w - b);
+#endif
 }
 
 occaFunction inline int4& operator -= (      int4 &a, const int4 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.reg -= b.reg;
+#else
   a.x -= b.x;
   a.y -= b.y;
   a.z -= b.z;
   a.w -= b.w;
+#endif
   return a;
 }
 
 occaFunction inline int4& operator -= (      int4 &a, const int &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.reg -= b;
+#else
   a.x -= b;
   a.y -= b;
   a.z -= b;
   a.w -= b;
+#endif
   return a;
 }
 occaFunction inline int4  operator *  (const int4 &a, const int4 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_INT4(a.reg * b.reg);
+#else
   return OCCA_INT4(a.x * b.x,
                    a.y * b.y,
                    a.z * b.z,
                    a.w * b.w);
+#endif
 }
 
 occaFunction inline int4  operator *  (const int &a, const int4 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_INT4(a * b.reg);
+#else
   return OCCA_INT4(a * b.x,
                    a * b.y,
                    a * b.z,
                    a * b.w);
+#endif
 }
 
 occaFunction inline int4  operator *  (const int4 &a, const int &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_INT4(a.reg * b);
+#else
   return OCCA_INT4(a.x * b,
                    a.y * b,
                    a.z * b,
                    a.w * b);
+#endif
 }
 
 occaFunction inline int4& operator *= (      int4 &a, const int4 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.reg *= b.reg;
+#else
   a.x *= b.x;
   a.y *= b.y;
   a.z *= b.z;
   a.w *= b.w;
+#endif
   return a;
 }
 
 occaFunction inline int4& operator *= (      int4 &a, const int &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.reg *= b;
+#else
   a.x *= b;
   a.y *= b;
   a.z *= b;
   a.w *= b;
+#endif
   return a;
 }
 occaFunction inline int4  operator /  (const int4 &a, const int4 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_INT4(a.reg / b.reg);
+#else
   return OCCA_INT4(a.x / b.x,
                    a.y / b.y,
                    a.z / b.z,
                    a.w / b.w);
+#endif
 }
 
 occaFunction inline int4  operator /  (const int &a, const int4 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_INT4(a / b.reg);
+#else
   return OCCA_INT4(a / b.x,
                    a / b.y,
                    a / b.z,
                    a / b.w);
+#endif
 }
 
 occaFunction inline int4  operator /  (const int4 &a, const int &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_INT4(a.reg / b);
+#else
   return OCCA_INT4(a.x / b,
                    a.y / b,
                    a.z / b,
                    a.w / b);
+#endif
 }
 
 occaFunction inline int4& operator /= (      int4 &a, const int4 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.reg /= b.reg;
+#else
   a.x /= b.x;
   a.y /= b.y;
   a.z /= b.z;
   a.w /= b.w;
+#endif
   return a;
 }
 
 occaFunction inline int4& operator /= (      int4 &a, const int &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.reg /= b;
+#else
   a.x /= b;
   a.y /= b;
   a.z /= b;
   a.w /= b;
+#endif
   return a;
 }
 
@@ -5762,8 +7369,16 @@ typedef int4 int3;
 
 //---[ int8 ]---------------------------
 #define OCCA_INT8 int8
+#if OCCA_VECTOR_EXTENSIONS
+typedef OCCA_VECTOR_EXT_TYPE(int, 8) occaVector_int8;
+#endif
 class int8{
 public:
+#if OCCA_VECTOR_EXTENSIONS
+  union {
+    occaVector_int8 reg;
+    struct {
+#endif
   union { int s0, x; };
   union { int s1, y; };
   union { int s2, z; };
@@ -5772,7 +7387,70 @@ public:
   int s5;
   int s6;
   int s7;
+#if OCCA_VECTOR_EXTENSIONS
+    };
+  };
+#endif
+
+#if OCCA_VECTOR_EXTENSIONS
+  inline occaFunction int8(const occaVector_int8 &reg_) : 
+    reg(reg_) {}
+
+  inline occaFunction int8() : 
+    reg((occaVector_int8) {0, 0, 0, 0, 0, 0, 0, 0}) {}
+
+  inline occaFunction int8(const int &x_) : 
+    reg((occaVector_int8) {x_, 0, 0, 0, 0, 0, 0, 0}) {}
+
+  inline occaFunction int8(const int &x_,
+                           const int &y_) : 
+    reg((occaVector_int8) {x_, y_, 0, 0, 0, 0, 0, 0}) {}
+
+  inline occaFunction int8(const int &x_,
+                           const int &y_,
+                           const int &z_) : 
+    reg((occaVector_int8) {x_, y_, z_, 0, 0, 0, 0, 0}) {}
+
+  inline occaFunction int8(const int &x_,
+                           const int &y_,
+                           const int &z_,
+                           const int &w_) : 
+    reg((occaVector_int8) {x_, y_, z_, w_, 0, 0, 0, 0}) {}
+
+  inline occaFunction int8(const int &x_,
+                           const int &y_,
+                           const int &z_,
+                           const int &w_,
+                           const int &s4_) : 
+    reg((occaVector_int8) {x_, y_, z_, w_, s4_, 0, 0, 0}) {}
+
+  inline occaFunction int8(const int &x_,
+                           const int &y_,
+                           const int &z_,
+                           const int &w_,
+                           const int &s4_,
+                           const int &s5_) : 
+    reg((occaVector_int8) {x_, y_, z_, w_, s4_, s5_, 0, 0}) {}
+
+  inline occaFunction int8(const int &x_,
+                           const int &y_,
+                           const int &z_,
+                           const int &w_,
+                           const int &s4_,
+                           const int &s5_,
+                           const int &s6_) : 
+    reg((occaVector_int8) {x_, y_, z_, w_, s4_, s5_, s6_, 0}) {}
 
+  inline occaFunction int8(const int &x_,
+                           const int &y_,
+                           const int &z_,
+                           const int &w_,
+                           const int &s4_,
+                           const int &s5_,
+                           const int &s6_,
+                           const int &s7_) : 
+    reg((occaVector_int8) {x_, y_, z_, w_, s4_, s5_, s6_, s7_}) {}
+#else
   inline occaFunction int8() : 
     x(0),
     y(0),
@@ -5890,9 +7568,13 @@ public:
     s5(s5_),
     s6(s6_),
     s7(s7_) {}
+#endif
 };
 
 occaFunction inline int8 operator + (const int8 &a){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_INT8(+a.reg);
+#else
   return OCCA_INT8(+a.x,
                    +a.y,
                    +a.z,
@@ -5901,6 +7583,7 @@ occaFunction inline int8 operator + (const int8 &a){
                    +a.s5,
                    +a.s6,
                    +a.s7);
+#endif
 }
 
 occaFunction inline int8 operator ++ (int8 &a, int){
@@ -5926,6 +7609,9 @@ occaFunction inline int8& operator ++ (int8 &a){
   return a;
 }
 occaFunction inline int8 operator - (const int8 &a){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_INT8(-a.reg);
+#else
   return OCCA_INT8(-a.x,
                    -a.y,
                    -a.z,
@@ -5934,6 +7620,7 @@ occaFunction inline int8 operator - (const int8 &a){
                    -a.s5,
                    -a.s6,
                    -a.s7);
+#endif
 }
 
 occaFunction inline int8 operator -- (int8 &a, int){
@@ -5959,6 +7646,9 @@ occaFunction inline int8& operator -- (int8 &a){
   return a;
 }
 occaFunction inline int8  operator +  (const int8 &a, const int8 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_INT8(a.reg + b.reg);
+#else
   return OCCA_INT8(a.x + b.x,
                    a.y + b.y,
                    a.z + b.z,
@@ -5967,9 +7657,13 @@ occaFunction inline int8  operator +  (const int8 &a, const int8 &b){
                    a.s5 + b.s5,
                    a.s6 + b.s6,
                    a.s7 + b.s7);
+#endif
 }
 
 occaFunction inline int8  operator +  (const int &a, const int8 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_INT8(a + b.reg);
+#else
   return OCCA_INT8(a + b.x,
                    a + b.y,
                    a + b.z,
@@ -5978,9 +7672,13 @@ occaFunction inline int8  operator +  (const int &a, const int8 &b){
                    a + b.s5,
                    a + b.s6,
                    a + b.s7);
+#endif
 }
 
 occaFunction inline int8  operator +  (const int8 &a, const int &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_INT8(a.reg + b);
+#else
   return OCCA_INT8(a.x + b,
                    a.y + b,
                    a.z + b,
@@ -5989,9 +7687,13 @@ occaFunction inline int8  operator +  (const int8 &a, const int &b){
                    a.s5 + b,
                    a.s6 + b,
                    a.s7 + b);
+#endif
 }
 
 occaFunction inline int8& operator += (      int8 &a, const int8 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.reg += b.reg;
+#else
   a.x += b.x;
   a.y += b.y;
   a.z += b.z;
@@ -6000,10 +7702,14 @@ occaFunction inline int8& operator += (      int8 &a, const int8 &b){
   a.s5 += b.s5;
   a.s6 += b.s6;
   a.s7 += b.s7;
+#endif
   return a;
 }
 
 occaFunction inline int8& operator += (      int8 &a, const int &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.reg += b;
+#else
   a.x += b;
   a.y += b;
   a.z += b;
@@ -6012,9 +7718,13 @@ occaFunction inline int8& operator += (      int8 &a, const int &b){
   a.s5 += b;
   a.s6 += b;
   a.s7 += b;
+#endif
   return a;
 }
 occaFunction inline int8  operator -  (const int8 &a, const int8 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_INT8(a.reg - b.reg);
+#else
   return OCCA_INT8(a.x - b.x,
                    a.y - b.y,
                    a.z - b.z,
@@ -6023,9 +7733,13 @@ occaFunction inline int8  operator -  (const int8 &a, const int8 &b){
                    a.s5 - b.s5,
                    a.s6 - b.s6,
                    a.s7 - b.s7);
+#endif
 }
 
 occaFunction inline int8  operator -  (const int &a, const int8 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_INT8(a - b.reg);
+#else
   return OCCA_INT8(a - b.x,
                    a - b.y,
                    a - b.z,
@@ -6034,9 +7748,13 @@ occaFunction inline int8  operator -  (const int &a, const int8 &b){
                    a - b.s5,
                    a - b.s6,
                    a - b.s7);
+#endif
 }
 
 occaFunction inline int8  operator -  (const int8 &a, const int &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_INT8(a.reg - b);
+#else
   return OCCA_INT8(a.x - b,
                    a.y - b,
                    a.z - b,
@@ -6045,9 +7763,13 @@ occaFunction inline int8  operator -  (const int8 &a, const int &b){
                    a.s5 - b,
                    a.s6 - b,
                    a.s7 - b);
+#endif
 }
 
 occaFunction inline int8& operator -= (      int8 &a, const int8 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.reg -= b.reg;
+#else
   a.x -= b.x;
   a.y -= b.y;
   a.z -= b.z;
@@ -6056,10 +7778,14 @@ occaFunction inline int8& operator -= (      int8 &a, const int8 &b){
   a.s5 -= b.s5;
   a.s6 -= b.s6;
   a.s7 -= b.s7;
+#endif
   return a;
 }
 
 occaFunction inline int8& operator -= (      int8 &a, const int &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.reg -= b;
+#else
   a.x -= b;
   a.y -= b;
   a.z -= b;
@@ -6068,9 +7794,13 @@ occaFunction inline int8& operator -= (      int8 &a, const int &b){
   a.s5 -= b;
   a.s6 -= b;
   a.s7 -= b;
+#endif
   return a;
 }
 occaFunction inline int8  operator *  (const int8 &a, const int8 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_INT8(a.reg * b.reg);
+#else
   return OCCA_INT8(a.x * b.x,
                    a.y * b.y,
                    a.z * b.z,
@@ -6079,9 +7809,13 @@ occaFunction inline int8  operator *  (const int8 &a, const int8 &b){
                    a.s5 * b.s5,
                    a.s6 * b.s6,
                    a.s7 * b.s7);
+#endif
 }
 
 occaFunction inline int8  operator *  (const int &a, const int8 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_INT8(a * b.reg);
+#else
   return OCCA_INT8(a * b.x,
                    a * b.y,
                    a * b.z,
@@ -6090,9 +7824,13 @@ occaFunction inline int8  operator *  (const int &a, const int8 &b){
                    a * b.s5,
                    a * b.s6,
                    a * b.s7);
+#endif
 }
 
 occaFunction inline int8  operator *  (const int8 &a, const int &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_INT8(a.reg * b);
+#else
   return OCCA_INT8(a.x * b,
                    a.y * b,
                    a.z * b,
@@ -6101,9 +7839,13 @@ occaFunction inline int8  operator *  (const int8 &a, const int &b){
                    a.s5 * b,
                    a.s6 * b,
                    a.s7 * b);
+#endif
 }
 
 occaFunction inline int8& operator *= (      int8 &a, const int8 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.reg *= b.reg;
+#else
   a.x *= b.x;
   a.y *= b.y;
   a.z *= b.z;
@@ -6112,10 +7854,14 @@ occaFunction inline int8& operator *= (      int8 &a, const int8 &b){
   a.s5 *= b.s5;
   a.s6 *= b.s6;
   a.s7 *= b.s7;
+#endif
   return a;
 }
 
 occaFunction inline int8& operator *= (      int8 &a, const int &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.reg *= b;
+#else
   a.x *= b;
   a.y *= b;
   a.z *= b;
@@ -6124,9 +7870,13 @@ occaFunction inline int8& operator *= (      int8 &a, const int &b){
   a.s5 *= b;
   a.s6 *= b;
   a.s7 *= b;
+#endif
   return a;
 }
 occaFunction inline int8  operator /  (const int8 &a, const int8 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_INT8(a.reg / b.reg);
+#else
   return OCCA_INT8(a.x / b.x,
                    a.y / b.y,
                    a.z / b.z,
@@ -6135,9 +7885,13 @@ occaFunction inline int8  operator /  (const int8 &a, const int8 &b){
                    a.s5 / b.s5,
                    a.s6 / b.s6,
                    a.s7 / b.s7);
+#endif
 }
 
 occaFunction inline int8  operator /  (const int &a, const int8 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_INT8(a / b.reg);
+#else
   return OCCA_INT8(a / b.x,
                    a / b.y,
                    a / b.z,
@@ -6146,9 +7900,13 @@ occaFunction inline int8  operator /  (const int &a, const int8 &b){
                    a / b.s5,
                    a / b.s6,
                    a / b.s7);
+#endif
 }
 
 occaFunction inline int8  operator /  (const int8 &a, const int &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_INT8(a.reg / b);
+#else
   return OCCA_INT8(a.x / b,
                    a.y / b,
                    a.z / b,
@@ -6157,9 +7915,13 @@ occaFunction inline int8  operator /  (const int8 &a, const int &b){
                    a.s5 / b,
                    a.s6 / b,
                    a.s7 / b);
+#endif
 }
 
 occaFunction inline int8& operator /= (      int8 &a, const int8 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.reg /= b.reg;
+#else
   a.x /= b.x;
   a.y /= b.y;
   a.z /= b.z;
@@ -6168,10 +7930,14 @@ occaFunction inline int8& operator /= (      int8 &a, const int8 &b){
   a.s5 /= b.s5;
   a.s6 /= b.s6;
   a.s7 /= b.s7;
+#endif
   return a;
 }
 
 occaFunction inline int8& operator /= (      int8 &a, const int &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.reg /= b;
+#else
   a.x /= b;
   a.y /= b;
   a.z /= b;
@@ -6180,6 +7946,7 @@ occaFunction inline int8& operator /= (      int8 &a, const int &b){
   a.s5 /= b;
   a.s6 /= b;
   a.s7 /= b;
+#endif
   return a;
 }
 
@@ -6204,8 +7971,16 @@ inline std::ostream& operator << (std::ostream &out, const int8& a){
 
 //---[ int16 ]--------------------------
 #define OCCA_INT16 int16
+#if OCCA_VECTOR_EXTENSIONS
+typedef OCCA_VECTOR_EXT_TYPE(int, 16) occaVector_int16;
+#endif
 class int16{
 public:
+#if OCCA_VECTOR_EXTENSIONS
+  union {
+    occaVector_int16 reg;
+    struct {
+#endif
   union { int s0, x; };
   union { int s1, y; };
   union { int s2, z; };
@@ -6222,35 +7997,214 @@ public:
   int s13;
   int s14;
   int s15;
+#if OCCA_VECTOR_EXTENSIONS
+    };
+  };
+#endif
+
+#if OCCA_VECTOR_EXTENSIONS
+  inline occaFunction int16(const occaVector_int16 &reg_) : 
+    reg(reg_) {}
 
   inline occaFunction int16() : 
-    x(0),
-    y(0),
-    z(0),
-    w(0),
-    s4(0),
-    s5(0),
-    s6(0),
-    s7(0),
-    s8(0),
-    s9(0),
-    s10(0),
-    s11(0),
-    s12(0),
-    s13(0),
-    s14(0),
-    s15(0) {}
+    reg((occaVector_int16) {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}) {}
 
   inline occaFunction int16(const int &x_) : 
-    x(x_),
-    y(0),
-    z(0),
-    w(0),
-    s4(0),
-    s5(0),
-    s6(0),
-    s7(0),
-    s8(0),
+    reg((occaVector_int16) {x_, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}) {}
+
+  inline occaFunction int16(const int &x_,
+                            const int &y_) : 
+    reg((occaVector_int16) {x_, y_, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}) {}
+
+  inline occaFunction int16(const int &x_,
+                            const int &y_,
+                            const int &z_) : 
+    reg((occaVector_int16) {x_, y_, z_, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}) {}
+
+  inline occaFunction int16(const int &x_,
+                            const int &y_,
+                            const int &z_,
+                            const int &w_) : 
+    reg((occaVector_int16) {x_, y_, z_, w_, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}) {}
+
+  inline occaFunction int16(const int &x_,
+                            const int &y_,
+                            const int &z_,
+                            const int &w_,
+                            const int &s4_) : 
+    reg((occaVector_int16) {x_, y_, z_, w_, s4_, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}) {}
+
+  inline occaFunction int16(const int &x_,
+                            const int &y_,
+                            const int &z_,
+                            const int &w_,
+                            const int &s4_,
+                            const int &s5_) : 
+    reg((occaVector_int16) {x_, y_, z_, w_, s4_, s5_, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}) {}
+
+  inline occaFunction int16(const int &x_,
+                            const int &y_,
+                            const int &z_,
+                            const int &w_,
+                            const int &s4_,
+                            const int &s5_,
+                            const int &s6_) : 
+    reg((occaVector_int16) {x_, y_, z_, w_, s4_, s5_, s6_, 0, 0, 0, 0, 0, 0, 0, 0, 0}) {}
+
+  inline occaFunction int16(const int &x_,
+                            const int &y_,
+                            const int &z_,
+                            const int &w_,
+                            const int &s4_,
+                            const int &s5_,
+                            const int &s6_,
+                            const int &s7_) : 
+    reg((occaVector_int16) {x_, y_, z_, w_, s4_, s5_, s6_, s7_, 0, 0, 0, 0, 0, 0, 0, 0}) {}
+
+  inline occaFunction int16(const int &x_,
+                            const int &y_,
+                            const int &z_,
+                            const int &w_,
+                            const int &s4_,
+                            const int &s5_,
+                            const int &s6_,
+                            const int &s7_,
+                            const int &s8_) : 
+    reg((occaVector_int16) {x_, y_, z_, w_, s4_, s5_, s6_, s7_, s8_, 0, 0, 0, 0, 0, 0, 0}) {}
+
+  inline occaFunction int16(const int &x_,
+                            const int &y_,
+                            const int &z_,
+                            const int &w_,
+                            const int &s4_,
+                            const int &s5_,
+                            const int &s6_,
+                            const int &s7_,
+                            const int &s8_,
+                            const int &s9_) : 
+    reg((occaVector_int16) {x_, y_, z_, w_, s4_, s5_, s6_, s7_, s8_, s9_, 0, 0, 0, 0, 0, 0}) {}
+
+  inline occaFunction int16(const int &x_,
+                            const int &y_,
+                            const int &z_,
+                            const int &w_,
+                            const int &s4_,
+                            const int &s5_,
+                            const int &s6_,
+                            const int &s7_,
+                            const int &s8_,
+                            const int &s9_,
+                            const int &s10_) : 
+    reg((occaVector_int16) {x_, y_, z_, w_, s4_, s5_, s6_, s7_, s8_, s9_, s10_, 0, 0, 0, 0, 0}) {}
+
+  inline occaFunction int16(const int &x_,
+                            const int &y_,
+                            const int &z_,
+                            const int &w_,
+                            const int &s4_,
+                            const int &s5_,
+                            const int &s6_,
+                            const int &s7_,
+                            const int &s8_,
+                            const int &s9_,
+                            const int &s10_,
+                            const int &s11_) : 
+    reg((occaVector_int16) {x_, y_, z_, w_, s4_, s5_, s6_, s7_, s8_, s9_, s10_, s11_, 0, 0, 0, 0}) {}
+
+  inline occaFunction int16(const int &x_,
+                            const int &y_,
+                            const int &z_,
+                            const int &w_,
+                            const int &s4_,
+                            const int &s5_,
+                            const int &s6_,
+                            const int &s7_,
+                            const int &s8_,
+                            const int &s9_,
+                            const int &s10_,
+                            const int &s11_,
+                            const int &s12_) : 
+    reg((occaVector_int16) {x_, y_, z_, w_, s4_, s5_, s6_, s7_, s8_, s9_, s10_, s11_, s12_, 0, 0, 0}) {}
+
+  inline occaFunction int16(const int &x_,
+                            const int &y_,
+                            const int &z_,
+                            const int &w_,
+                            const int &s4_,
+                            const int &s5_,
+                            const int &s6_,
+                            const int &s7_,
+                            const int &s8_,
+                            const int &s9_,
+                            const int &s10_,
+                            const int &s11_,
+                            const int &s12_,
+                            const int &s13_) : 
+    reg((occaVector_int16) {x_, y_, z_, w_, s4_, s5_, s6_, s7_, s8_, s9_, s10_, s11_, s12_, s13_, 0, 0}) {}
+
+  inline occaFunction int16(const int &x_,
+                            const int &y_,
+                            const int &z_,
+                            const int &w_,
+                            const int &s4_,
+                            const int &s5_,
+                            const int &s6_,
+                            const int &s7_,
+                            const int &s8_,
+                            const int &s9_,
+                            const int &s10_,
+                            const int &s11_,
+                            const int &s12_,
+                            const int &s13_,
+                            const int &s14_) : 
+    reg((occaVector_int16) {x_, y_, z_, w_, s4_, s5_, s6_, s7_, s8_, s9_, s10_, s11_, s12_, s13_, s14_, 0}) {}
+
+  inline occaFunction int16(const int &x_,
+                            const int &y_,
+                            const int &z_,
+                            const int &w_,
+                            const int &s4_,
+                            const int &s5_,
+                            const int &s6_,
+                            const int &s7_,
+                            const int &s8_,
+                            const int &s9_,
+                            const int &s10_,
+                            const int &s11_,
+                            const int &s12_,
+                            const int &s13_,
+                            const int &s14_,
+                            const int &s15_) : 
+    reg((occaVector_int16) {x_, y_, z_, w_, s4_, s5_, s6_, s7_, s8_, s9_, s10_, s11_, s12_, s13_, s14_, s15_}) {}
+#else
+  inline occaFunction int16() : 
+    x(0),
+    y(0),
+    z(0),
+    w(0),
+    s4(0),
+    s5(0),
+    s6(0),
+    s7(0),
+    s8(0),
+    s9(0),
+    s10(0),
+    s11(0),
+    s12(0),
+    s13(0),
+    s14(0),
+    s15(0) {}
+
+  inline occaFunction int16(const int &x_) : 
+    x(x_),
+    y(0),
+    z(0),
+    w(0),
+    s4(0),
+    s5(0),
+    s6(0),
+    s7(0),
+    s8(0),
     s9(0),
     s10(0),
     s11(0),
@@ -6648,9 +8602,13 @@ public:
     s13(s13_),
     s14(s14_),
     s15(s15_) {}
+#endif
 };
 
 occaFunction inline int16 operator + (const int16 &a){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_INT16(+a.reg);
+#else
   return OCCA_INT16(+a.x,
                     +a.y,
                     +a.z,
@@ -6667,6 +8625,7 @@ occaFunction inline int16 operator + (const int16 &a){
                     +a.s13,
                     +a.s14,
                     +a.s15);
+#endif
 }
 
 occaFunction inline int16 operator ++ (int16 &a, int){
@@ -6708,6 +8667,9 @@ occaFunction inline int16& operator ++ (int16 &a){
   return a;
 }
 occaFunction inline int16 operator - (const int16 &a){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_INT16(-a.reg);
+#else
   return OCCA_INT16(-a.x,
                     -a.y,
                     -a.z,
@@ -6724,6 +8686,7 @@ occaFunction inline int16 operator - (const int16 &a){
                     -a.s13,
                     -a.s14,
                     -a.s15);
+#endif
 }
 
 occaFunction inline int16 operator -- (int16 &a, int){
@@ -6765,6 +8728,9 @@ occaFunction inline int16& operator -- (int16 &a){
   return a;
 }
 occaFunction inline int16  operator +  (const int16 &a, const int16 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_INT16(a.reg + b.reg);
+#else
   return OCCA_INT16(a.x + b.x,
                     a.y + b.y,
                     a.z + b.z,
@@ -6781,9 +8747,13 @@ occaFunction inline int16  operator +  (const int16 &a, const int16 &b){
                     a.s13 + b.s13,
                     a.s14 + b.s14,
                     a.s15 + b.s15);
+#endif
 }
 
 occaFunction inline int16  operator +  (const int &a, const int16 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_INT16(a + b.reg);
+#else
   return OCCA_INT16(a + b.x,
                     a + b.y,
                     a + b.z,
@@ -6800,9 +8770,13 @@ occaFunction inline int16  operator +  (const int &a, const int16 &b){
                     a + b.s13,
                     a + b.s14,
                     a + b.s15);
+#endif
 }
 
 occaFunction inline int16  operator +  (const int16 &a, const int &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_INT16(a.reg + b);
+#else
   return OCCA_INT16(a.x + b,
                     a.y + b,
                     a.z + b,
@@ -6819,9 +8793,13 @@ occaFunction inline int16  operator +  (const int16 &a, const int &b){
                     a.s13 + b,
                     a.s14 + b,
                     a.s15 + b);
+#endif
 }
 
 occaFunction inline int16& operator += (      int16 &a, const int16 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.reg += b.reg;
+#else
   a.x += b.x;
   a.y += b.y;
   a.z += b.z;
@@ -6838,10 +8816,14 @@ occaFunction inline int16& operator += (      int16 &a, const int16 &b){
   a.s13 += b.s13;
   a.s14 += b.s14;
   a.s15 += b.s15;
+#endif
   return a;
 }
 
 occaFunction inline int16& operator += (      int16 &a, const int &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.reg += b;
+#else
   a.x += b;
   a.y += b;
   a.z += b;
@@ -6858,9 +8840,13 @@ occaFunction inline int16& operator += (      int16 &a, const int &b){
   a.s13 += b;
   a.s14 += b;
   a.s15 += b;
+#endif
   return a;
 }
 occaFunction inline int16  operator -  (const int16 &a, const int16 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_INT16(a.reg - b.reg);
+#else
   return OCCA_INT16(a.x - b.x,
                     a.y - b.y,
                     a.z - b.z,
@@ -6877,9 +8863,13 @@ occaFunction inline int16  operator -  (const int16 &a, const int16 &b){
                     a.s13 - b.s13,
                     a.s14 - b.s14,
                     a.s15 - b.s15);
+#endif
 }
 
 occaFunction inline int16  operator -  (const int &a, const int16 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_INT16(a - b.reg);
+#else
   return OCCA_INT16(a - b.x,
                     a - b.y,
                     a - b.z,
@@ -6896,9 +8886,13 @@ occaFunction inline int16  operator -  (const int &a, const int16 &b){
                     a - b.s13,
                     a - b.s14,
                     a - b.s15);
+#endif
 }
 
 occaFunction inline int16  operator -  (const int16 &a, const int &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_INT16(a.reg - b);
+#else
   return OCCA_INT16(a.x - b,
                     a.y - b,
                     a.z - b,
@@ -6915,9 +8909,13 @@ occaFunction inline int16  operator -  (const int16 &a, const int &b){
                     a.s13 - b,
                     a.s14 - b,
                     a.s15 - b);
+#endif
 }
 
 occaFunction inline int16& operator -= (      int16 &a, const int16 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.reg -= b.reg;
+#else
   a.x -= b.x;
   a.y -= b.y;
   a.z -= b.z;
@@ -6934,10 +8932,14 @@ occaFunction inline int16& operator -= (      int16 &a, const int16 &b){
   a.s13 -= b.s13;
   a.s14 -= b.s14;
   a.s15 -= b.s15;
+#endif
   return a;
 }
 
 occaFunction inline int16& operator -= (      int16 &a, const int &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.reg -= b;
+#else
   a.x -= b;
   a.y -= b;
   a.z -= b;
@@ -6954,9 +8956,13 @@ occaFunction inline int16& operator -= (      int16 &a, const int &b){
   a.s13 -= b;
   a.s14 -= b;
   a.s15 -= b;
+#endif
   return a;
 }
 occaFunction inline int16  operator *  (const int16 &a, const int16 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_INT16(a.reg * b.reg);
+#else
   return OCCA_INT16(a.x * b.x,
                     a.y * b.y,
                     a.z * b.z,
@@ -6973,9 +8979,13 @@ occaFunction inline int16  operator *  (const int16 &a, const int16 &b){
                     a.s13 * b.s13,
                     a.s14 * b.s14,
                     a.s15 * b.s15);
+#endif
 }
 
 occaFunction inline int16  operator *  (const int &a, const int16 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_INT16(a * b.reg);
+#else
   return OCCA_INT16(a * b.x,
                     a * b.y,
                     a * b.z,
@@ -6992,9 +9002,13 @@ occaFunction inline int16  operator *  (const int &a, const int16 &b){
                     a * b.s13,
                     a * b.s14,
                     a * b.s15);
+#endif
 }
 
 occaFunction inline int16  operator *  (const int16 &a, const int &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_INT16(a.reg * b);
+#else
   return OCCA_INT16(a.x * b,
                     a.y * b,
                     a.z * b,
@@ -7011,9 +9025,13 @@ occaFunction inline int16  operator *  (const int16 &a, const int &b){
                     a.s13 * b,
                     a.s14 * b,
                     a.s15 * b);
+#endif
 }
 
 occaFunction inline int16& operator *= (      int16 &a, const int16 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.reg *= b.reg;
+#else
   a.x *= b.x;
   a.y *= b.y;
   a.z *= b.z;
@@ -7030,10 +9048,14 @@ occaFunction inline int16& operator *= (      int16 &a, const int16 &b){
   a.s13 *= b.s13;
   a.s14 *= b.s14;
   a.s15 *= b.s15;
+#endif
   return a;
 }
 
 occaFunction inline int16& operator *= (      int16 &a, const int &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.reg *= b;
+#else
   a.x *= b;
   a.y *= b;
   a.z *= b;
@@ -7050,9 +9072,13 @@ occaFunction inline int16& operator *= (      int16 &a, const int &b){
   a.s13 *= b;
   a.s14 *= b;
   a.s15 *= b;
+#endif
   return a;
 }
 occaFunction inline int16  operator /  (const int16 &a, const int16 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_INT16(a.reg / b.reg);
+#else
   return OCCA_INT16(a.x / b.x,
                     a.y / b.y,
                     a.z / b.z,
@@ -7069,9 +9095,13 @@ occaFunction inline int16  operator /  (const int16 &a, const int16 &b){
                     a.s13 / b.s13,
                     a.s14 / b.s14,
                     a.s15 / b.s15);
+#endif
 }
 
 occaFunction inline int16  operator /  (const int &a, const int16 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_INT16(a / b.reg);
+#else
   return OCCA_INT16(a / b.x,
                     a / b.y,
                     a / b.z,
@@ -7088,9 +9118,13 @@ occaFunction inline int16  operator /  (const int &a, const int16 &b){
                     a / b.s13,
                     a / b.s14,
                     a / b.s15);
+#endif
 }
 
 occaFunction inline int16  operator /  (const int16 &a, const int &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_INT16(a.reg / b);
+#else
   return OCCA_INT16(a.x / b,
                     a.y / b,
                     a.z / b,
@@ -7107,9 +9141,13 @@ occaFunction inline int16  operator /  (const int16 &a, const int &b){
                     a.s13 / b,
                     a.s14 / b,
                     a.s15 / b);
+#endif
 }
 
 occaFunction inline int16& operator /= (      int16 &a, const int16 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.reg /= b.reg;
+#else
   a.x /= b.x;
   a.y /= b.y;
   a.z /= b.z;
@@ -7126,10 +9164,14 @@ occaFunction inline int16& operator /= (      int16 &a, const int16 &b){
   a.s13 /= b.s13;
   a.s14 /= b.s14;
   a.s15 /= b.s15;
+#endif
   return a;
 }
 
 occaFunction inline int16& operator /= (      int16 &a, const int &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.reg /= b;
+#else
   a.x /= b;
   a.y /= b;
   a.z /= b;
@@ -7146,6 +9188,7 @@ occaFunction inline int16& operator /= (      int16 &a, const int &b){
   a.s13 /= b;
   a.s14 /= b;
   a.s15 /= b;
+#endif
   return a;
 }
 
@@ -7183,11 +9226,37 @@ inline std::ostream& operator << (std::ostream &out, const int16& a){
 #  define OCCA_LONG2 long2
 #endif
 #if (!defined(OCCA_IN_KERNEL) || (OCCA_USING_CUDA == 0))
+#if OCCA_VECTOR_EXTENSIONS
+typedef OCCA_VECTOR_EXT_TYPE(long, 2) occaVector_long2;
+#endif
 class long2{
 public:
+#if OCCA_VECTOR_EXTENSIONS
+  union {
+    occaVector_long2 reg;
+    struct {
+#endif
   union { long s0, x; };
   union { long s1, y; };
+#if OCCA_VECTOR_EXTENSIONS
+    };
+  };
+#endif
+
+#if OCCA_VECTOR_EXTENSIONS
+  inline occaFunction long2(const occaVector_long2 &reg_) : 
+    reg(reg_) {}
+
+  inline occaFunction long2() : 
+    reg((occaVector_long2) {0, 0}) {}
 
+  inline occaFunction long2(const long &x_) : 
+    reg((occaVector_long2) {x_, 0}) {}
+
+  inline occaFunction long2(const long &x_,
+                            const long &y_) : 
+    reg((occaVector_long2) {x_, y_}) {}
+#else
   inline occaFunction long2() : 
     x(0),
     y(0) {}
@@ -7200,12 +9269,17 @@ public:
                             const long &y_) : 
     x(x_),
     y(y_) {}
+#endif
 };
 #endif
 
 occaFunction inline long2 operator + (const long2 &a){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_LONG2(+a.reg);
+#else
   return OCCA_LONG2(+a.x,
                     +a.y);
+#endif
 }
 
 occaFunction inline long2 operator ++ (long2 &a, int){
@@ -7219,8 +9293,12 @@ occaFunction inline long2& operator ++ (long2 &a){
   return a;
 }
 occaFunction inline long2 operator - (const long2 &a){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_LONG2(-a.reg);
+#else
   return OCCA_LONG2(-a.x,
                     -a.y);
+#endif
 }
 
 occaFunction inline long2 operator -- (long2 &a, int){
@@ -7234,107 +9312,187 @@ occaFunction inline long2& operator -- (long2 &a){
   return a;
 }
 occaFunction inline long2  operator +  (const long2 &a, const long2 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_LONG2(a.reg + b.reg);
+#else
   return OCCA_LONG2(a.x + b.x,
                     a.y + b.y);
+#endif
 }
 
 occaFunction inline long2  operator +  (const long &a, const long2 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_LONG2(a + b.reg);
+#else
   return OCCA_LONG2(a + b.x,
                     a + b.y);
+#endif
 }
 
 occaFunction inline long2  operator +  (const long2 &a, const long &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_LONG2(a.reg + b);
+#else
   return OCCA_LONG2(a.x + b,
                     a.y + b);
+#endif
 }
 
 occaFunction inline long2& operator += (      long2 &a, const long2 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.reg += b.reg;
+#else
   a.x += b.x;
   a.y += b.y;
+#endif
   return a;
 }
 
 occaFunction inline long2& operator += (      long2 &a, const long &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.reg += b;
+#else
   a.x += b;
   a.y += b;
+#endif
   return a;
 }
 occaFunction inline long2  operator -  (const long2 &a, const long2 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_LONG2(a.reg - b.reg);
+#else
   return OCCA_LONG2(a.x - b.x,
                     a.y - b.y);
+#endif
 }
 
 occaFunction inline long2  operator -  (const long &a, const long2 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_LONG2(a - b.reg);
+#else
   return OCCA_LONG2(a - b.x,
                     a - b.y);
+#endif
 }
 
 occaFunction inline long2  operator -  (const long2 &a, const long &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_LONG2(a.reg - b);
+#else
   return OCCA_LONG2(a.x - b,
                     a.y - b);
+#endif
 }
 
 occaFunction inline long2& operator -= (      long2 &a, const long2 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.reg -= b.reg;
+#else
   a.x -= b.x;
   a.y -= b.y;
+#endif
   return a;
 }
 
 occaFunction inline long2& operator -= (      long2 &a, const long &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.reg -= b;
+#else
   a.x -= b;
   a.y -= b;
+#endif
   return a;
 }
 occaFunction inline long2  operator *  (const long2 &a, const long2 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_LONG2(a.reg * b.reg);
+#else
   return OCCA_LONG2(a.x * b.x,
                     a.y * b.y);
+#endif
 }
 
 occaFunction inline long2  operator *  (const long &a, const long2 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_LONG2(a * b.reg);
+#else
   return OCCA_LONG2(a * b.x,
                     a * b.y);
+#endif
 }
 
 occaFunction inline long2  operator *  (const long2 &a, const long &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_LONG2(a.reg * b);
+#else
   return OCCA_LONG2(a.x * b,
                     a.y * b);
+#endif
 }
 
 occaFunction inline long2& operator *= (      long2 &a, const long2 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.reg *= b.reg;
+#else
   a.x *= b.x;
   a.y *= b.y;
+#endif
   return a;
 }
 
 occaFunction inline long2& operator *= (      long2 &a, const long &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.reg *= b;
+#else
   a.x *= b;
   a.y *= b;
+#endif
   return a;
 }
 occaFunction inline long2  operator /  (const long2 &a, const long2 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_LONG2(a.reg / b.reg);
+#else
   return OCCA_LONG2(a.x / b.x,
                     a.y / b.y);
+#endif
 }
 
 occaFunction inline long2  operator /  (const long &a, const long2 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_LONG2(a / b.reg);
+#else
   return OCCA_LONG2(a / b.x,
                     a / b.y);
+#endif
 }
 
 occaFunction inline long2  operator /  (const long2 &a, const long &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_LONG2(a.reg / b);
+#else
   return OCCA_LONG2(a.x / b,
                     a.y / b);
+#endif
 }
 
 occaFunction inline long2& operator /= (      long2 &a, const long2 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.reg /= b.reg;
+#else
   a.x /= b.x;
   a.y /= b.y;
+#endif
   return a;
 }
 
 occaFunction inline long2& operator /= (      long2 &a, const long &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.reg /= b;
+#else
   a.x /= b;
   a.y /= b;
+#endif
   return a;
 }
 
@@ -7358,13 +9516,50 @@ inline std::ostream& operator << (std::ostream &out, const long2& a){
 #  define OCCA_LONG4 long4
 #endif
 #if (!defined(OCCA_IN_KERNEL) || (OCCA_USING_CUDA == 0))
+#if OCCA_VECTOR_EXTENSIONS
+typedef OCCA_VECTOR_EXT_TYPE(long, 4) occaVector_long4;
+#endif
 class long4{
 public:
+#if OCCA_VECTOR_EXTENSIONS
+  union {
+    occaVector_long4 reg;
+    struct {
+#endif
   union { long s0, x; };
   union { long s1, y; };
   union { long s2, z; };
   union { long s3, w; };
+#if OCCA_VECTOR_EXTENSIONS
+    };
+  };
+#endif
+
+#if OCCA_VECTOR_EXTENSIONS
+  inline occaFunction long4(const occaVector_long4 &reg_) : 
+    reg(reg_) {}
 
+  inline occaFunction long4() : 
+    reg((occaVector_long4) {0, 0, 0, 0}) {}
+
+  inline occaFunction long4(const long &x_) : 
+    reg((occaVector_long4) {x_, 0, 0, 0}) {}
+
+  inline occaFunction long4(const long &x_,
+                            const long &y_) : 
+    reg((occaVector_long4) {x_, y_, 0, 0}) {}
+
+  inline occaFunction long4(const long &x_,
+                            const long &y_,
+                            const long &z_) : 
+    reg((occaVector_long4) {x_, y_, z_, 0}) {}
+
+  inline occaFunction long4(const long &x_,
+                            const long &y_,
+                            const long &z_,
+                            const long &w_) : 
+    reg((occaVector_long4) {x_, y_, z_, w_}) {}
+#else
   inline occaFunction long4() : 
     x(0),
     y(0),
@@ -7400,14 +9595,19 @@ public:
     y(y_),
     z(z_),
     w(w_) {}
+#endif
 };
 #endif
 
 occaFunction inline long4 operator + (const long4 &a){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_LONG4(+a.reg);
+#else
   return OCCA_LONG4(+a.x,
                     +a.y,
                     +a.z,
                     +a.w);
+#endif
 }
 
 occaFunction inline long4 operator ++ (long4 &a, int){
@@ -7425,10 +9625,14 @@ occaFunction inline long4& operator ++ (long4 &a){
   return a;
 }
 occaFunction inline long4 operator - (const long4 &a){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_LONG4(-a.reg);
+#else
   return OCCA_LONG4(-a.x,
                     -a.y,
                     -a.z,
                     -a.w);
+#endif
 }
 
 occaFunction inline long4 operator -- (long4 &a, int){
@@ -7446,147 +9650,227 @@ occaFunction inline long4& operator -- (long4 &a){
   return a;
 }
 occaFunction inline long4  operator +  (const long4 &a, const long4 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_LONG4(a.reg + b.reg);
+#else
   return OCCA_LONG4(a.x + b.x,
                     a.y + b.y,
                     a.z + b.z,
                     a.w + b.w);
+#endif
 }
 
 occaFunction inline long4  operator +  (const long &a, const long4 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_LONG4(a + b.reg);
+#else
   return OCCA_LONG4(a + b.x,
                     a + b.y,
                     a + b.z,
                     a + b.w);
+#endif
 }
 
 occaFunction inline long4  operator +  (const long4 &a, const long &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_LONG4(a.reg + b);
+#else
   return OCCA_LONG4(a.x + b,
                     a.y + b,
                     a.z + b,
                     a.w + b);
+#endif
 }
 
 occaFunction inline long4& operator += (      long4 &a, const long4 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.reg += b.reg;
+#else
   a.x += b.x;
   a.y += b.y;
   a.z += b.z;
   a.w += b.w;
+#endif
   return a;
 }
 
 occaFunction inline long4& operator += (      long4 &a, const long &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.reg += b;
+#else
   a.x += b;
   a.y += b;
   a.z += b;
   a.w += b;
+#endif
   return a;
 }
 occaFunction inline long4  operator -  (const long4 &a, const long4 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_LONG4(a.reg - b.reg);
+#else
   return OCCA_LONG4(a.x - b.x,
                     a.y - b.y,
                     a.z - b.z,
                     a.w - b.w);
+#endif
 }
 
 occaFunction inline long4  operator -  (const long &a, const long4 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_LONG4(a - b.reg);
+#else
   return OCCA_LONG4(a - b.x,
                     a - b.y,
                     a - b.z,
                     a - b.w);
+#endif
 }
 
 occaFunction inline long4  operator -  (const long4 &a, const long &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_LONG4(a.reg - b);
+#else
   return OCCA_LONG4(a.x - b,
                     a.y - b,
                     a.z - b,
                     a.w - b);
+#endif
 }
 
 occaFunction inline long4& operator -= (      long4 &a, const long4 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.reg -= b.reg;
+#else
   a.x -= b.x;
   a.y -= b.y;
   a.z -= b.z;
   a.w -= b.w;
+#endif
   return a;
 }
 
 occaFunction inline long4& operator -= (      long4 &a, const long &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.reg -= b;
+#else
   a.x -= b;
   a.y -= b;
   a.z -= b;
   a.w -= b;
+#endif
   return a;
 }
 occaFunction inline long4  operator *  (const long4 &a, const long4 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_LONG4(a.reg * b.reg);
+#else
   return OCCA_LONG4(a.x * b.x,
                     a.y * b.y,
                     a.z * b.z,
                     a.w * b.w);
+#endif
 }
 
 occaFunction inline long4  operator *  (const long &a, const long4 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_LONG4(a * b.reg);
+#else
   return OCCA_LONG4(a * b.x,
                     a * b.y,
                     a * b.z,
                     a * b.w);
+#endif
 }
 
 occaFunction inline long4  operator *  (const long4 &a, const long &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_LONG4(a.reg * b);
+#else
   return OCCA_LONG4(a.x * b,
                     a.y * b,
                     a.z * b,
                     a.w * b);
+#endif
 }
 
 occaFunction inline long4& operator *= (      long4 &a, const long4 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.reg *= b.reg;
+#else
   a.x *= b.x;
   a.y *= b.y;
   a.z *= b.z;
   a.w *= b.w;
+#endif
   return a;
 }
 
 occaFunction inline long4& operator *= (      long4 &a, const long &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.reg *= b;
+#else
   a.x *= b;
   a.y *= b;
   a.z *= b;
   a.w *= b;
+#endif
   return a;
 }
 occaFunction inline long4  operator /  (const long4 &a, const long4 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_LONG4(a.reg / b.reg);
+#else
   return OCCA_LONG4(a.x / b.x,
                     a.y / b.y,
                     a.z / b.z,
                     a.w / b.w);
+#endif
 }
 
 occaFunction inline long4  operator /  (const long &a, const long4 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_LONG4(a / b.reg);
+#else
   return OCCA_LONG4(a / b.x,
                     a / b.y,
                     a / b.z,
                     a / b.w);
+#endif
 }
 
 occaFunction inline long4  operator /  (const long4 &a, const long &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_LONG4(a.reg / b);
+#else
   return OCCA_LONG4(a.x / b,
                     a.y / b,
                     a.z / b,
                     a.w / b);
+#endif
 }
 
 occaFunction inline long4& operator /= (      long4 &a, const long4 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.reg /= b.reg;
+#else
   a.x /= b.x;
   a.y /= b.y;
   a.z /= b.z;
   a.w /= b.w;
+#endif
   return a;
 }
 
 occaFunction inline long4& operator /= (      long4 &a, const long &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.reg /= b;
+#else
   a.x /= b;
   a.y /= b;
   a.z /= b;
   a.w /= b;
+#endif
   return a;
 }
 
@@ -7619,8 +9903,16 @@ typedef long4 long3;
 
 //---[ long8 ]--------------------------
 #define OCCA_LONG8 long8
+#if OCCA_VECTOR_EXTENSIONS
+typedef OCCA_VECTOR_EXT_TYPE(long, 8) occaVector_long8;
+#endif
 class long8{
 public:
+#if OCCA_VECTOR_EXTENSIONS
+  union {
+    occaVector_long8 reg;
+    struct {
+#endif
   union { long s0, x; };
   union { long s1, y; };
   union { long s2, z; };
@@ -7629,7 +9921,70 @@ public:
   long s5;
   long s6;
   long s7;
+#if OCCA_VECTOR_EXTENSIONS
+    };
+  };
+#endif
+
+#if OCCA_VECTOR_EXTENSIONS
+  inline occaFunction long8(const occaVector_long8 &reg_) : 
+    reg(reg_) {}
+
+  inline occaFunction long8() : 
+    reg((occaVector_long8) {0, 0, 0, 0, 0, 0, 0, 0}) {}
+
+  inline occaFunction long8(const long &x_) : 
+    reg((occaVector_long8) {x_, 0, 0, 0, 0, 0, 0, 0}) {}
+
+  inline occaFunction long8(const long &x_,
+                            const long &y_) : 
+    reg((occaVector_long8) {x_, y_, 0, 0, 0, 0, 0, 0}) {}
+
+  inline occaFunction long8(const long &x_,
+                            const long &y_,
+                            const long &z_) : 
+    reg((occaVector_long8) {x_, y_, z_, 0, 0, 0, 0, 0}) {}
+
+  inline occaFunction long8(const long &x_,
+                            const long &y_,
+                            const long &z_,
+                            const long &w_) : 
+    reg((occaVector_long8) {x_, y_, z_, w_, 0, 0, 0, 0}) {}
+
+  inline occaFunction long8(const long &x_,
+                            const long &y_,
+                            const long &z_,
+                            const long &w_,
+                            const long &s4_) : 
+    reg((occaVector_long8) {x_, y_, z_, w_, s4_, 0, 0, 0}) {}
+
+  inline occaFunction long8(const long &x_,
+                            const long &y_,
+                            const long &z_,
+                            const long &w_,
+                            const long &s4_,
+                            const long &s5_) : 
+    reg((occaVector_long8) {x_, y_, z_, w_, s4_, s5_, 0, 0}) {}
 
+  inline occaFunction long8(const long &x_,
+                            const long &y_,
+                            const long &z_,
+                            const long &w_,
+                            const long &s4_,
+                            const long &s5_,
+                            const long &s6_) : 
+    reg((occaVector_long8) {x_, y_, z_, w_, s4_, s5_, s6_, 0}) {}
+
+  inline occaFunction long8(const long &x_,
+                            const long &y_,
+                            const long &z_,
+                            const long &w_,
+                            const long &s4_,
+                            const long &s5_,
+                            const long &s6_,
+                            const long &s7_) : 
+    reg((occaVector_long8) {x_, y_, z_, w_, s4_, s5_, s6_, s7_}) {}
+#else
   inline occaFunction long8() : 
     x(0),
     y(0),
@@ -7747,9 +10102,13 @@ public:
     s5(s5_),
     s6(s6_),
     s7(s7_) {}
+#endif
 };
 
 occaFunction inline long8 operator + (const long8 &a){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_LONG8(+a.reg);
+#else
   return OCCA_LONG8(+a.x,
                     +a.y,
                     +a.z,
@@ -7758,6 +10117,7 @@ occaFunction inline long8 operator + (const long8 &a){
                     +a.s5,
                     +a.s6,
                     +a.s7);
+#endif
 }
 
 occaFunction inline long8 operator ++ (long8 &a, int){
@@ -7783,6 +10143,9 @@ occaFunction inline long8& operator ++ (long8 &a){
   return a;
 }
 occaFunction inline long8 operator - (const long8 &a){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_LONG8(-a.reg);
+#else
   return OCCA_LONG8(-a.x,
                     -a.y,
                     -a.z,
@@ -7791,6 +10154,7 @@ occaFunction inline long8 operator - (const long8 &a){
                     -a.s5,
                     -a.s6,
                     -a.s7);
+#endif
 }
 
 occaFunction inline long8 operator -- (long8 &a, int){
@@ -7816,6 +10180,9 @@ occaFunction inline long8& operator -- (long8 &a){
   return a;
 }
 occaFunction inline long8  operator +  (const long8 &a, const long8 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_LONG8(a.reg + b.reg);
+#else
   return OCCA_LONG8(a.x + b.x,
                     a.y + b.y,
                     a.z + b.z,
@@ -7824,9 +10191,13 @@ occaFunction inline long8  operator +  (const long8 &a, const long8 &b){
                     a.s5 + b.s5,
                     a.s6 + b.s6,
                     a.s7 + b.s7);
+#endif
 }
 
 occaFunction inline long8  operator +  (const long &a, const long8 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_LONG8(a + b.reg);
+#else
   return OCCA_LONG8(a + b.x,
                     a + b.y,
                     a + b.z,
@@ -7835,9 +10206,13 @@ occaFunction inline long8  operator +  (const long &a, const long8 &b){
                     a + b.s5,
                     a + b.s6,
                     a + b.s7);
+#endif
 }
 
 occaFunction inline long8  operator +  (const long8 &a, const long &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_LONG8(a.reg + b);
+#else
   return OCCA_LONG8(a.x + b,
                     a.y + b,
                     a.z + b,
@@ -7846,9 +10221,13 @@ occaFunction inline long8  operator +  (const long8 &a, const long &b){
                     a.s5 + b,
                     a.s6 + b,
                     a.s7 + b);
+#endif
 }
 
 occaFunction inline long8& operator += (      long8 &a, const long8 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.reg += b.reg;
+#else
   a.x += b.x;
   a.y += b.y;
   a.z += b.z;
@@ -7857,10 +10236,14 @@ occaFunction inline long8& operator += (      long8 &a, const long8 &b){
   a.s5 += b.s5;
   a.s6 += b.s6;
   a.s7 += b.s7;
+#endif
   return a;
 }
 
 occaFunction inline long8& operator += (      long8 &a, const long &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.reg += b;
+#else
   a.x += b;
   a.y += b;
   a.z += b;
@@ -7869,9 +10252,13 @@ occaFunction inline long8& operator += (      long8 &a, const long &b){
   a.s5 += b;
   a.s6 += b;
   a.s7 += b;
+#endif
   return a;
 }
 occaFunction inline long8  operator -  (const long8 &a, const long8 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_LONG8(a.reg - b.reg);
+#else
   return OCCA_LONG8(a.x - b.x,
                     a.y - b.y,
                     a.z - b.z,
@@ -7880,9 +10267,13 @@ occaFunction inline long8  operator -  (const long8 &a, const long8 &b){
                     a.s5 - b.s5,
                     a.s6 - b.s6,
                     a.s7 - b.s7);
+#endif
 }
 
 occaFunction inline long8  operator -  (const long &a, const long8 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_LONG8(a - b.reg);
+#else
   return OCCA_LONG8(a - b.x,
                     a - b.y,
                     a - b.z,
@@ -7891,9 +10282,13 @@ occaFunction inline long8  operator -  (const long &a, const long8 &b){
                     a - b.s5,
                     a - b.s6,
                     a - b.s7);
+#endif
 }
 
 occaFunction inline long8  operator -  (const long8 &a, const long &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_LONG8(a.reg - b);
+#else
   return OCCA_LONG8(a.x - b,
                     a.y - b,
                     a.z - b,
@@ -7902,9 +10297,13 @@ occaFunction inline long8  operator -  (const long8 &a, const long &b){
                     a.s5 - b,
                     a.s6 - b,
                     a.s7 - b);
+#endif
 }
 
 occaFunction inline long8& operator -= (      long8 &a, const long8 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.reg -= b.reg;
+#else
   a.x -= b.x;
   a.y -= b.y;
   a.z -= b.z;
@@ -7913,10 +10312,14 @@ occaFunction inline long8& operator -= (      long8 &a, const long8 &b){
   a.s5 -= b.s5;
   a.s6 -= b.s6;
   a.s7 -= b.s7;
+#endif
   return a;
 }
 
 occaFunction inline long8& operator -= (      long8 &a, const long &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.reg -= b;
+#else
   a.x -= b;
   a.y -= b;
   a.z -= b;
@@ -7925,9 +10328,13 @@ occaFunction inline long8& operator -= (      long8 &a, const long &b){
   a.s5 -= b;
   a.s6 -= b;
   a.s7 -= b;
+#endif
   return a;
 }
 occaFunction inline long8  operator *  (const long8 &a, const long8 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_LONG8(a.reg * b.reg);
+#else
   return OCCA_LONG8(a.x * b.x,
                     a.y * b.y,
                     a.z * b.z,
@@ -7936,9 +10343,13 @@ occaFunction inline long8  operator *  (const long8 &a, const long8 &b){
                     a.s5 * b.s5,
                     a.s6 * b.s6,
                     a.s7 * b.s7);
+#endif
 }
 
 occaFunction inline long8  operator *  (const long &a, const long8 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_LONG8(a * b.reg);
+#else
   return OCCA_LONG8(a * b.x,
                     a * b.y,
                     a * b.z,
@@ -7947,9 +10358,13 @@ occaFunction inline long8  operator *  (const long &a, const long8 &b){
                     a * b.s5,
                     a * b.s6,
                     a * b.s7);
+#endif
 }
 
 occaFunction inline long8  operator *  (const long8 &a, const long &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_LONG8(a.reg * b);
+#else
   return OCCA_LONG8(a.x * b,
                     a.y * b,
                     a.z * b,
@@ -7958,9 +10373,13 @@ occaFunction inline long8  operator *  (const long8 &a, const long &b){
                     a.s5 * b,
                     a.s6 * b,
                     a.s7 * b);
+#endif
 }
 
 occaFunction inline long8& operator *= (      long8 &a, const long8 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.reg *= b.reg;
+#else
   a.x *= b.x;
   a.y *= b.y;
   a.z *= b.z;
@@ -7969,10 +10388,14 @@ occaFunction inline long8& operator *= (      long8 &a, const long8 &b){
   a.s5 *= b.s5;
   a.s6 *= b.s6;
   a.s7 *= b.s7;
+#endif
   return a;
 }
 
 occaFunction inline long8& operator *= (      long8 &a, const long &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.reg *= b;
+#else
   a.x *= b;
   a.y *= b;
   a.z *= b;
@@ -7981,9 +10404,13 @@ occaFunction inline long8& operator *= (      long8 &a, const long &b){
   a.s5 *= b;
   a.s6 *= b;
   a.s7 *= b;
+#endif
   return a;
 }
 occaFunction inline long8  operator /  (const long8 &a, const long8 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_LONG8(a.reg / b.reg);
+#else
   return OCCA_LONG8(a.x / b.x,
                     a.y / b.y,
                     a.z / b.z,
@@ -7992,9 +10419,13 @@ occaFunction inline long8  operator /  (const long8 &a, const long8 &b){
                     a.s5 / b.s5,
                     a.s6 / b.s6,
                     a.s7 / b.s7);
+#endif
 }
 
 occaFunction inline long8  operator /  (const long &a, const long8 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_LONG8(a / b.reg);
+#else
   return OCCA_LONG8(a / b.x,
                     a / b.y,
                     a / b.z,
@@ -8003,9 +10434,13 @@ occaFunction inline long8  operator /  (const long &a, const long8 &b){
                     a / b.s5,
                     a / b.s6,
                     a / b.s7);
+#endif
 }
 
 occaFunction inline long8  operator /  (const long8 &a, const long &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_LONG8(a.reg / b);
+#else
   return OCCA_LONG8(a.x / b,
                     a.y / b,
                     a.z / b,
@@ -8014,9 +10449,13 @@ occaFunction inline long8  operator /  (const long8 &a, const long &b){
                     a.s5 / b,
                     a.s6 / b,
                     a.s7 / b);
+#endif
 }
 
 occaFunction inline long8& operator /= (      long8 &a, const long8 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.reg /= b.reg;
+#else
   a.x /= b.x;
   a.y /= b.y;
   a.z /= b.z;
@@ -8025,10 +10464,14 @@ occaFunction inline long8& operator /= (      long8 &a, const long8 &b){
   a.s5 /= b.s5;
   a.s6 /= b.s6;
   a.s7 /= b.s7;
+#endif
   return a;
 }
 
 occaFunction inline long8& operator /= (      long8 &a, const long &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.reg /= b;
+#else
   a.x /= b;
   a.y /= b;
   a.z /= b;
@@ -8037,6 +10480,7 @@ occaFunction inline long8& operator /= (      long8 &a, const long &b){
   a.s5 /= b;
   a.s6 /= b;
   a.s7 /= b;
+#endif
   return a;
 }
 
@@ -8061,8 +10505,16 @@ inline std::ostream& operator << (std::ostream &out, const long8& a){
 
 //---[ long16 ]-------------------------
 #define OCCA_LONG16 long16
+#if OCCA_VECTOR_EXTENSIONS
+typedef OCCA_VECTOR_EXT_TYPE(long, 16) occaVector_long16;
+#endif
 class long16{
 public:
+#if OCCA_VECTOR_EXTENSIONS
+  union {
+    occaVector_long16 reg;
+    struct {
+#endif
   union { long s0, x; };
   union { long s1, y; };
   union { long s2, z; };
@@ -8079,77 +10531,256 @@ public:
   long s13;
   long s14;
   long s15;
+#if OCCA_VECTOR_EXTENSIONS
+    };
+  };
+#endif
+
+#if OCCA_VECTOR_EXTENSIONS
+  inline occaFunction long16(const occaVector_long16 &reg_) : 
+    reg(reg_) {}
 
   inline occaFunction long16() : 
-    x(0),
-    y(0),
-    z(0),
-    w(0),
-    s4(0),
-    s5(0),
-    s6(0),
-    s7(0),
-    s8(0),
-    s9(0),
-    s10(0),
-    s11(0),
-    s12(0),
-    s13(0),
-    s14(0),
-    s15(0) {}
+    reg((occaVector_long16) {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}) {}
 
   inline occaFunction long16(const long &x_) : 
-    x(x_),
-    y(0),
-    z(0),
-    w(0),
-    s4(0),
-    s5(0),
-    s6(0),
-    s7(0),
-    s8(0),
-    s9(0),
-    s10(0),
-    s11(0),
-    s12(0),
-    s13(0),
-    s14(0),
-    s15(0) {}
+    reg((occaVector_long16) {x_, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}) {}
 
   inline occaFunction long16(const long &x_,
                              const long &y_) : 
-    x(x_),
-    y(y_),
-    z(0),
-    w(0),
-    s4(0),
-    s5(0),
-    s6(0),
-    s7(0),
-    s8(0),
-    s9(0),
-    s10(0),
-    s11(0),
-    s12(0),
-    s13(0),
-    s14(0),
-    s15(0) {}
+    reg((occaVector_long16) {x_, y_, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}) {}
 
   inline occaFunction long16(const long &x_,
                              const long &y_,
                              const long &z_) : 
-    x(x_),
-    y(y_),
-    z(z_),
-    w(0),
-    s4(0),
-    s5(0),
-    s6(0),
-    s7(0),
-    s8(0),
-    s9(0),
-    s10(0),
-    s11(0),
+    reg((occaVector_long16) {x_, y_, z_, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}) {}
+
+  inline occaFunction long16(const long &x_,
+                             const long &y_,
+                             const long &z_,
+                             const long &w_) : 
+    reg((occaVector_long16) {x_, y_, z_, w_, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}) {}
+
+  inline occaFunction long16(const long &x_,
+                             const long &y_,
+                             const long &z_,
+                             const long &w_,
+                             const long &s4_) : 
+    reg((occaVector_long16) {x_, y_, z_, w_, s4_, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}) {}
+
+  inline occaFunction long16(const long &x_,
+                             const long &y_,
+                             const long &z_,
+                             const long &w_,
+                             const long &s4_,
+                             const long &s5_) : 
+    reg((occaVector_long16) {x_, y_, z_, w_, s4_, s5_, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}) {}
+
+  inline occaFunction long16(const long &x_,
+                             const long &y_,
+                             const long &z_,
+                             const long &w_,
+                             const long &s4_,
+                             const long &s5_,
+                             const long &s6_) : 
+    reg((occaVector_long16) {x_, y_, z_, w_, s4_, s5_, s6_, 0, 0, 0, 0, 0, 0, 0, 0, 0}) {}
+
+  inline occaFunction long16(const long &x_,
+                             const long &y_,
+                             const long &z_,
+                             const long &w_,
+                             const long &s4_,
+                             const long &s5_,
+                             const long &s6_,
+                             const long &s7_) : 
+    reg((occaVector_long16) {x_, y_, z_, w_, s4_, s5_, s6_, s7_, 0, 0, 0, 0, 0, 0, 0, 0}) {}
+
+  inline occaFunction long16(const long &x_,
+                             const long &y_,
+                             const long &z_,
+                             const long &w_,
+                             const long &s4_,
+                             const long &s5_,
+                             const long &s6_,
+                             const long &s7_,
+                             const long &s8_) : 
+    reg((occaVector_long16) {x_, y_, z_, w_, s4_, s5_, s6_, s7_, s8_, 0, 0, 0, 0, 0, 0, 0}) {}
+
+  inline occaFunction long16(const long &x_,
+                             const long &y_,
+                             const long &z_,
+                             const long &w_,
+                             const long &s4_,
+                             const long &s5_,
+                             const long &s6_,
+                             const long &s7_,
+                             const long &s8_,
+                             const long &s9_) : 
+    reg((occaVector_long16) {x_, y_, z_, w_, s4_, s5_, s6_, s7_, s8_, s9_, 0, 0, 0, 0, 0, 0}) {}
+
+  inline occaFunction long16(const long &x_,
+                             const long &y_,
+                             const long &z_,
+                             const long &w_,
+                             const long &s4_,
+                             const long &s5_,
+                             const long &s6_,
+                             const long &s7_,
+                             const long &s8_,
+                             const long &s9_,
+                             const long &s10_) : 
+    reg((occaVector_long16) {x_, y_, z_, w_, s4_, s5_, s6_, s7_, s8_, s9_, s10_, 0, 0, 0, 0, 0}) {}
+
+  inline occaFunction long16(const long &x_,
+                             const long &y_,
+                             const long &z_,
+                             const long &w_,
+                             const long &s4_,
+                             const long &s5_,
+                             const long &s6_,
+                             const long &s7_,
+                             const long &s8_,
+                             const long &s9_,
+                             const long &s10_,
+                             const long &s11_) : 
+    reg((occaVector_long16) {x_, y_, z_, w_, s4_, s5_, s6_, s7_, s8_, s9_, s10_, s11_, 0, 0, 0, 0}) {}
+
+  inline occaFunction long16(const long &x_,
+                             const long &y_,
+                             const long &z_,
+                             const long &w_,
+                             const long &s4_,
+                             const long &s5_,
+                             const long &s6_,
+                             const long &s7_,
+                             const long &s8_,
+                             const long &s9_,
+                             const long &s10_,
+                             const long &s11_,
+                             const long &s12_) : 
+    reg((occaVector_long16) {x_, y_, z_, w_, s4_, s5_, s6_, s7_, s8_, s9_, s10_, s11_, s12_, 0, 0, 0}) {}
+
+  inline occaFunction long16(const long &x_,
+                             const long &y_,
+                             const long &z_,
+                             const long &w_,
+                             const long &s4_,
+                             const long &s5_,
+                             const long &s6_,
+                             const long &s7_,
+                             const long &s8_,
+                             const long &s9_,
+                             const long &s10_,
+                             const long &s11_,
+                             const long &s12_,
+                             const long &s13_) : 
+    reg((occaVector_long16) {x_, y_, z_, w_, s4_, s5_, s6_, s7_, s8_, s9_, s10_, s11_, s12_, s13_, 0, 0}) {}
+
+  inline occaFunction long16(const long &x_,
+                             const long &y_,
+                             const long &z_,
+                             const long &w_,
+                             const long &s4_,
+                             const long &s5_,
+                             const long &s6_,
+                             const long &s7_,
+                             const long &s8_,
+                             const long &s9_,
+                             const long &s10_,
+                             const long &s11_,
+                             const long &s12_,
+                             const long &s13_,
+                             const long &s14_) : 
+    reg((occaVector_long16) {x_, y_, z_, w_, s4_, s5_, s6_, s7_, s8_, s9_, s10_, s11_, s12_, s13_, s14_, 0}) {}
+
+  inline occaFunction long16(const long &x_,
+                             const long &y_,
+                             const long &z_,
+                             const long &w_,
+                             const long &s4_,
+                             const long &s5_,
+                             const long &s6_,
+                             const long &s7_,
+                             const long &s8_,
+                             const long &s9_,
+                             const long &s10_,
+                             const long &s11_,
+                             const long &s12_,
+                             const long &s13_,
+                             const long &s14_,
+                             const long &s15_) : 
+    reg((occaVector_long16) {x_, y_, z_, w_, s4_, s5_, s6_, s7_, s8_, s9_, s10_, s11_, s12_, s13_, s14_, s15_}) {}
+#else
+  inline occaFunction long16() : 
+    x(0),
+    y(0),
+    z(0),
+    w(0),
+    s4(0),
+    s5(0),
+    s6(0),
+    s7(0),
+    s8(0),
+    s9(0),
+    s10(0),
+    s11(0),
+    s12(0),
+    s13(0),
+    s14(0),
+    s15(0) {}
+
+  inline occaFunction long16(const long &x_) : 
+    x(x_),
+    y(0),
+    z(0),
+    w(0),
+    s4(0),
+    s5(0),
+    s6(0),
+    s7(0),
+    s8(0),
+    s9(0),
+    s10(0),
+    s11(0),
+    s12(0),
+    s13(0),
+    s14(0),
+    s15(0) {}
+
+  inline occaFunction long16(const long &x_,
+                             const long &y_) : 
+    x(x_),
+    y(y_),
+    z(0),
+    w(0),
+    s4(0),
+    s5(0),
+    s6(0),
+    s7(0),
+    s8(0),
+    s9(0),
+    s10(0),
+    s11(0),
+    s12(0),
+    s13(0),
+    s14(0),
+    s15(0) {}
+
+  inline occaFunction long16(const long &x_,
+                             const long &y_,
+                             const long &z_) : 
+    x(x_),
+    y(y_),
+    z(z_),
+    w(0),
+    s4(0),
+    s5(0),
+    s6(0),
+    s7(0),
+    s8(0),
+    s9(0),
+    s10(0),
+    s11(0),
     s12(0),
     s13(0),
     s14(0),
@@ -8505,9 +11136,13 @@ public:
     s13(s13_),
     s14(s14_),
     s15(s15_) {}
+#endif
 };
 
 occaFunction inline long16 operator + (const long16 &a){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_LONG16(+a.reg);
+#else
   return OCCA_LONG16(+a.x,
                      +a.y,
                      +a.z,
@@ -8524,6 +11159,7 @@ occaFunction inline long16 operator + (const long16 &a){
                      +a.s13,
                      +a.s14,
                      +a.s15);
+#endif
 }
 
 occaFunction inline long16 operator ++ (long16 &a, int){
@@ -8565,6 +11201,9 @@ occaFunction inline long16& operator ++ (long16 &a){
   return a;
 }
 occaFunction inline long16 operator - (const long16 &a){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_LONG16(-a.reg);
+#else
   return OCCA_LONG16(-a.x,
                      -a.y,
                      -a.z,
@@ -8581,6 +11220,7 @@ occaFunction inline long16 operator - (const long16 &a){
                      -a.s13,
                      -a.s14,
                      -a.s15);
+#endif
 }
 
 occaFunction inline long16 operator -- (long16 &a, int){
@@ -8622,6 +11262,9 @@ occaFunction inline long16& operator -- (long16 &a){
   return a;
 }
 occaFunction inline long16  operator +  (const long16 &a, const long16 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_LONG16(a.reg + b.reg);
+#else
   return OCCA_LONG16(a.x + b.x,
                      a.y + b.y,
                      a.z + b.z,
@@ -8638,9 +11281,13 @@ occaFunction inline long16  operator +  (const long16 &a, const long16 &b){
                      a.s13 + b.s13,
                      a.s14 + b.s14,
                      a.s15 + b.s15);
+#endif
 }
 
 occaFunction inline long16  operator +  (const long &a, const long16 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_LONG16(a + b.reg);
+#else
   return OCCA_LONG16(a + b.x,
                      a + b.y,
                      a + b.z,
@@ -8657,9 +11304,13 @@ occaFunction inline long16  operator +  (const long &a, const long16 &b){
                      a + b.s13,
                      a + b.s14,
                      a + b.s15);
+#endif
 }
 
 occaFunction inline long16  operator +  (const long16 &a, const long &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_LONG16(a.reg + b);
+#else
   return OCCA_LONG16(a.x + b,
                      a.y + b,
                      a.z + b,
@@ -8676,9 +11327,13 @@ occaFunction inline long16  operator +  (const long16 &a, const long &b){
                      a.s13 + b,
                      a.s14 + b,
                      a.s15 + b);
+#endif
 }
 
 occaFunction inline long16& operator += (      long16 &a, const long16 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.reg += b.reg;
+#else
   a.x += b.x;
   a.y += b.y;
   a.z += b.z;
@@ -8695,10 +11350,14 @@ occaFunction inline long16& operator += (      long16 &a, const long16 &b){
   a.s13 += b.s13;
   a.s14 += b.s14;
   a.s15 += b.s15;
+#endif
   return a;
 }
 
 occaFunction inline long16& operator += (      long16 &a, const long &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.reg += b;
+#else
   a.x += b;
   a.y += b;
   a.z += b;
@@ -8715,9 +11374,13 @@ occaFunction inline long16& operator += (      long16 &a, const long &b){
   a.s13 += b;
   a.s14 += b;
   a.s15 += b;
+#endif
   return a;
 }
 occaFunction inline long16  operator -  (const long16 &a, const long16 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_LONG16(a.reg - b.reg);
+#else
   return OCCA_LONG16(a.x - b.x,
                      a.y - b.y,
                      a.z - b.z,
@@ -8734,9 +11397,13 @@ occaFunction inline long16  operator -  (const long16 &a, const long16 &b){
                      a.s13 - b.s13,
                      a.s14 - b.s14,
                      a.s15 - b.s15);
+#endif
 }
 
 occaFunction inline long16  operator -  (const long &a, const long16 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_LONG16(a - b.reg);
+#else
   return OCCA_LONG16(a - b.x,
                      a - b.y,
                      a - b.z,
@@ -8753,9 +11420,13 @@ occaFunction inline long16  operator -  (const long &a, const long16 &b){
                      a - b.s13,
                      a - b.s14,
                      a - b.s15);
+#endif
 }
 
 occaFunction inline long16  operator -  (const long16 &a, const long &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_LONG16(a.reg - b);
+#else
   return OCCA_LONG16(a.x - b,
                      a.y - b,
                      a.z - b,
@@ -8772,9 +11443,13 @@ occaFunction inline long16  operator -  (const long16 &a, const long &b){
                      a.s13 - b,
                      a.s14 - b,
                      a.s15 - b);
+#endif
 }
 
 occaFunction inline long16& operator -= (      long16 &a, const long16 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.reg -= b.reg;
+#else
   a.x -= b.x;
   a.y -= b.y;
   a.z -= b.z;
@@ -8791,10 +11466,14 @@ occaFunction inline long16& operator -= (      long16 &a, const long16 &b){
   a.s13 -= b.s13;
   a.s14 -= b.s14;
   a.s15 -= b.s15;
+#endif
   return a;
 }
 
 occaFunction inline long16& operator -= (      long16 &a, const long &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.reg -= b;
+#else
   a.x -= b;
   a.y -= b;
   a.z -= b;
@@ -8811,9 +11490,13 @@ occaFunction inline long16& operator -= (      long16 &a, const long &b){
   a.s13 -= b;
   a.s14 -= b;
   a.s15 -= b;
+#endif
   return a;
 }
 occaFunction inline long16  operator *  (const long16 &a, const long16 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_LONG16(a.reg * b.reg);
+#else
   return OCCA_LONG16(a.x * b.x,
                      a.y * b.y,
                      a.z * b.z,
@@ -8830,9 +11513,13 @@ occaFunction inline long16  operator *  (const long16 &a, const long16 &b){
                      a.s13 * b.s13,
                      a.s14 * b.s14,
                      a.s15 * b.s15);
+#endif
 }
 
 occaFunction inline long16  operator *  (const long &a, const long16 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_LONG16(a * b.reg);
+#else
   return OCCA_LONG16(a * b.x,
                      a * b.y,
                      a * b.z,
@@ -8849,9 +11536,13 @@ occaFunction inline long16  operator *  (const long &a, const long16 &b){
                      a * b.s13,
                      a * b.s14,
                      a * b.s15);
+#endif
 }
 
 occaFunction inline long16  operator *  (const long16 &a, const long &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_LONG16(a.reg * b);
+#else
   return OCCA_LONG16(a.x * b,
                      a.y * b,
                      a.z * b,
@@ -8868,9 +11559,13 @@ occaFunction inline long16  operator *  (const long16 &a, const long &b){
                      a.s13 * b,
                      a.s14 * b,
                      a.s15 * b);
+#endif
 }
 
 occaFunction inline long16& operator *= (      long16 &a, const long16 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.reg *= b.reg;
+#else
   a.x *= b.x;
   a.y *= b.y;
   a.z *= b.z;
@@ -8887,10 +11582,14 @@ occaFunction inline long16& operator *= (      long16 &a, const long16 &b){
   a.s13 *= b.s13;
   a.s14 *= b.s14;
   a.s15 *= b.s15;
+#endif
   return a;
 }
 
 occaFunction inline long16& operator *= (      long16 &a, const long &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.reg *= b;
+#else
   a.x *= b;
   a.y *= b;
   a.z *= b;
@@ -8907,9 +11606,13 @@ occaFunction inline long16& operator *= (      long16 &a, const long &b){
   a.s13 *= b;
   a.s14 *= b;
   a.s15 *= b;
+#endif
   return a;
 }
 occaFunction inline long16  operator /  (const long16 &a, const long16 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_LONG16(a.reg / b.reg);
+#else
   return OCCA_LONG16(a.x / b.x,
                      a.y / b.y,
                      a.z / b.z,
@@ -8926,9 +11629,13 @@ occaFunction inline long16  operator /  (const long16 &a, const long16 &b){
                      a.s13 / b.s13,
                      a.s14 / b.s14,
                      a.s15 / b.s15);
+#endif
 }
 
 occaFunction inline long16  operator /  (const long &a, const long16 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_LONG16(a / b.reg);
+#else
   return OCCA_LONG16(a / b.x,
                      a / b.y,
                      a / b.z,
@@ -8945,9 +11652,13 @@ occaFunction inline long16  operator /  (const long &a, const long16 &b){
                      a / b.s13,
                      a / b.s14,
                      a / b.s15);
+#endif
 }
 
 occaFunction inline long16  operator /  (const long16 &a, const long &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_LONG16(a.reg / b);
+#else
   return OCCA_LONG16(a.x / b,
                      a.y / b,
                      a.z / b,
@@ -8964,9 +11675,13 @@ occaFunction inline long16  operator /  (const long16 &a, const long &b){
                      a.s13 / b,
                      a.s14 / b,
                      a.s15 / b);
+#endif
 }
 
 occaFunction inline long16& operator /= (      long16 &a, const long16 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.reg /= b.reg;
+#else
   a.x /= b.x;
   a.y /= b.y;
   a.z /= b.z;
@@ -8983,10 +11698,14 @@ occaFunction inline long16& operator /= (      long16 &a, const long16 &b){
   a.s13 /= b.s13;
   a.s14 /= b.s14;
   a.s15 /= b.s15;
+#endif
   return a;
 }
 
 occaFunction inline long16& operator /= (      long16 &a, const long &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.reg /= b;
+#else
   a.x /= b;
   a.y /= b;
   a.z /= b;
@@ -9003,6 +11722,7 @@ occaFunction inline long16& operator /= (      long16 &a, const long &b){
   a.s13 /= b;
   a.s14 /= b;
   a.s15 /= b;
+#endif
   return a;
 }
 
@@ -9040,11 +11760,37 @@ inline std::ostream& operator << (std::ostream &out, const long16& a){
 #  define OCCA_FLOAT2 float2
 #endif
 #if (!defined(OCCA_IN_KERNEL) || (OCCA_USING_CUDA == 0))
+#if OCCA_VECTOR_EXTENSIONS
+typedef OCCA_VECTOR_EXT_TYPE(float, 2) occaVector_float2;
+#endif
 class float2{
 public:
+#if OCCA_VECTOR_EXTENSIONS
+  union {
+    occaVector_float2 reg;
+    struct {
+#endif
   union { float s0, x; };
   union { float s1, y; };
+#if OCCA_VECTOR_EXTENSIONS
+    };
+  };
+#endif
+
+#if OCCA_VECTOR_EXTENSIONS
+  inline occaFunction float2(const occaVector_float2 &reg_) : 
+    reg(reg_) {}
+
+  inline occaFunction float2() : 
+    reg((occaVector_float2) {0, 0}) {}
 
+  inline occaFunction float2(const float &x_) : 
+    reg((occaVector_float2) {x_, 0}) {}
+
+  inline occaFunction float2(const float &x_,
+                             const float &y_) : 
+    reg((occaVector_float2) {x_, y_}) {}
+#else
   inline occaFunction float2() : 
     x(0),
     y(0) {}
@@ -9057,119 +11803,208 @@ public:
                              const float &y_) : 
     x(x_),
     y(y_) {}
+#endif
 };
 #endif
 
 occaFunction inline float2 operator + (const float2 &a){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_FLOAT2(+a.reg);
+#else
   return OCCA_FLOAT2(+a.x,
                      +a.y);
+#endif
 }
 occaFunction inline float2 operator - (const float2 &a){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_FLOAT2(-a.reg);
+#else
   return OCCA_FLOAT2(-a.x,
                      -a.y);
+#endif
 }
 occaFunction inline float2  operator +  (const float2 &a, const float2 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_FLOAT2(a.reg + b.reg);
+#else
   return OCCA_FLOAT2(a.x + b.x,
                      a.y + b.y);
+#endif
 }
 
 occaFunction inline float2  operator +  (const float &a, const float2 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_FLOAT2(a + b.reg);
+#else
   return OCCA_FLOAT2(a + b.x,
                      a + b.y);
+#endif
 }
 
 occaFunction inline float2  operator +  (const float2 &a, const float &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_FLOAT2(a.reg + b);
+#else
   return OCCA_FLOAT2(a.x + b,
                      a.y + b);
+#endif
 }
 
 occaFunction inline float2& operator += (      float2 &a, const float2 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.reg += b.reg;
+#else
   a.x += b.x;
   a.y += b.y;
+#endif
   return a;
 }
 
 occaFunction inline float2& operator += (      float2 &a, const float &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.reg += b;
+#else
   a.x += b;
   a.y += b;
+#endif
   return a;
 }
 occaFunction inline float2  operator -  (const float2 &a, const float2 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_FLOAT2(a.reg - b.reg);
+#else
   return OCCA_FLOAT2(a.x - b.x,
                      a.y - b.y);
+#endif
 }
 
 occaFunction inline float2  operator -  (const float &a, const float2 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_FLOAT2(a - b.reg);
+#else
   return OCCA_FLOAT2(a - b.x,
                      a - b.y);
+#endif
 }
 
 occaFunction inline float2  operator -  (const float2 &a, const float &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_FLOAT2(a.reg - b);
+#else
   return OCCA_FLOAT2(a.x - b,
                      a.y - b);
+#endif
 }
 
 occaFunction inline float2& operator -= (      float2 &a, const float2 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.reg -= b.reg;
+#else
   a.x -= b.x;
   a.y -= b.y;
+#endif
   return a;
 }
 
 occaFunction inline float2& operator -= (      float2 &a, const float &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.reg -= b;
+#else
   a.x -= b;
   a.y -= b;
+#endif
   return a;
 }
 occaFunction inline float2  operator *  (const float2 &a, const float2 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_FLOAT2(a.reg * b.reg);
+#else
   return OCCA_FLOAT2(a.x * b.x,
                      a.y * b.y);
+#endif
 }
 
 occaFunction inline float2  operator *  (const float &a, const float2 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_FLOAT2(a * b.reg);
+#else
   return OCCA_FLOAT2(a * b.x,
                      a * b.y);
+#endif
 }
 
 occaFunction inline float2  operator *  (const float2 &a, const float &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_FLOAT2(a.reg * b);
+#else
   return OCCA_FLOAT2(a.x * b,
                      a.y * b);
+#endif
 }
 
 occaFunction inline float2& operator *= (      float2 &a, const float2 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.reg *= b.reg;
+#else
   a.x *= b.x;
   a.y *= b.y;
+#endif
   return a;
 }
 
 occaFunction inline float2& operator *= (      float2 &a, const float &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.reg *= b;
+#else
   a.x *= b;
   a.y *= b;
+#endif
   return a;
 }
 occaFunction inline float2  operator /  (const float2 &a, const float2 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_FLOAT2(a.reg / b.reg);
+#else
   return OCCA_FLOAT2(a.x / b.x,
                      a.y / b.y);
+#endif
 }
 
 occaFunction inline float2  operator /  (const float &a, const float2 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_FLOAT2(a / b.reg);
+#else
   return OCCA_FLOAT2(a / b.x,
                      a / b.y);
+#endif
 }
 
 occaFunction inline float2  operator /  (const float2 &a, const float &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_FLOAT2(a.reg / b);
+#else
   return OCCA_FLOAT2(a.x / b,
                      a.y / b);
+#endif
 }
 
 occaFunction inline float2& operator /= (      float2 &a, const float2 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.reg /= b.reg;
+#else
   a.x /= b.x;
   a.y /= b.y;
+#endif
   return a;
 }
 
 occaFunction inline float2& operator /= (      float2 &a, const float &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.reg /= b;
+#else
   a.x /= b;
   a.y /= b;
+#endif
   return a;
 }
 
@@ -9193,13 +12028,50 @@ inline std::ostream& operator << (std::ostream &out, const float2& a){
 #  define OCCA_FLOAT4 float4
 #endif
 #if (!defined(OCCA_IN_KERNEL) || (OCCA_USING_CUDA == 0))
+#if OCCA_VECTOR_EXTENSIONS
+typedef OCCA_VECTOR_EXT_TYPE(float, 4) occaVector_float4;
+#endif
 class float4{
 public:
+#if OCCA_VECTOR_EXTENSIONS
+  union {
+    occaVector_float4 reg;
+    struct {
+#endif
   union { float s0, x; };
   union { float s1, y; };
   union { float s2, z; };
   union { float s3, w; };
+#if OCCA_VECTOR_EXTENSIONS
+    };
+  };
+#endif
+
+#if OCCA_VECTOR_EXTENSIONS
+  inline occaFunction float4(const occaVector_float4 &reg_) : 
+    reg(reg_) {}
 
+  inline occaFunction float4() : 
+    reg((occaVector_float4) {0, 0, 0, 0}) {}
+
+  inline occaFunction float4(const float &x_) : 
+    reg((occaVector_float4) {x_, 0, 0, 0}) {}
+
+  inline occaFunction float4(const float &x_,
+                             const float &y_) : 
+    reg((occaVector_float4) {x_, y_, 0, 0}) {}
+
+  inline occaFunction float4(const float &x_,
+                             const float &y_,
+                             const float &z_) : 
+    reg((occaVector_float4) {x_, y_, z_, 0}) {}
+
+  inline occaFunction float4(const float &x_,
+                             const float &y_,
+                             const float &z_,
+                             const float &w_) : 
+    reg((occaVector_float4) {x_, y_, z_, w_}) {}
+#else
   inline occaFunction float4() : 
     x(0),
     y(0),
@@ -9235,163 +12107,252 @@ public:
     y(y_),
     z(z_),
     w(w_) {}
+#endif
 };
 #endif
 
 occaFunction inline float4 operator + (const float4 &a){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_FLOAT4(+a.reg);
+#else
   return OCCA_FLOAT4(+a.x,
                      +a.y,
                      +a.z,
                      +a.w);
+#endif
 }
 occaFunction inline float4 operator - (const float4 &a){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_FLOAT4(-a.reg);
+#else
   return OCCA_FLOAT4(-a.x,
                      -a.y,
                      -a.z,
                      -a.w);
+#endif
 }
 occaFunction inline float4  operator +  (const float4 &a, const float4 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_FLOAT4(a.reg + b.reg);
+#else
   return OCCA_FLOAT4(a.x + b.x,
                      a.y + b.y,
                      a.z + b.z,
                      a.w + b.w);
+#endif
 }
 
 occaFunction inline float4  operator +  (const float &a, const float4 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_FLOAT4(a + b.reg);
+#else
   return OCCA_FLOAT4(a + b.x,
                      a + b.y,
                      a + b.z,
                      a + b.w);
+#endif
 }
 
 occaFunction inline float4  operator +  (const float4 &a, const float &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_FLOAT4(a.reg + b);
+#else
   return OCCA_FLOAT4(a.x + b,
                      a.y + b,
                      a.z + b,
                      a.w + b);
+#endif
 }
 
 occaFunction inline float4& operator += (      float4 &a, const float4 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.reg += b.reg;
+#else
   a.x += b.x;
   a.y += b.y;
   a.z += b.z;
   a.w += b.w;
+#endif
   return a;
 }
 
 occaFunction inline float4& operator += (      float4 &a, const float &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.reg += b;
+#else
   a.x += b;
   a.y += b;
   a.z += b;
   a.w += b;
+#endif
   return a;
 }
 occaFunction inline float4  operator -  (const float4 &a, const float4 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_FLOAT4(a.reg - b.reg);
+#else
   return OCCA_FLOAT4(a.x - b.x,
                      a.y - b.y,
                      a.z - b.z,
                      a.w - b.w);
+#endif
 }
 
 occaFunction inline float4  operator -  (const float &a, const float4 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_FLOAT4(a - b.reg);
+#else
   return OCCA_FLOAT4(a - b.x,
                      a - b.y,
                      a - b.z,
                      a - b.w);
+#endif
 }
 
 occaFunction inline float4  operator -  (const float4 &a, const float &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_FLOAT4(a.reg - b);
+#else
   return OCCA_FLOAT4(a.x - b,
                      a.y - b,
                      a.z - b,
                      a.w - b);
+#endif
 }
 
 occaFunction inline float4& operator -= (      float4 &a, const float4 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.reg -= b.reg;
+#else
   a.x -= b.x;
   a.y -= b.y;
   a.z -= b.z;
   a.w -= b.w;
+#endif
   return a;
 }
 
 occaFunction inline float4& operator -= (      float4 &a, const float &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.reg -= b;
+#else
   a.x -= b;
   a.y -= b;
   a.z -= b;
   a.w -= b;
+#endif
   return a;
 }
 occaFunction inline float4  operator *  (const float4 &a, const float4 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_FLOAT4(a.reg * b.reg);
+#else
   return OCCA_FLOAT4(a.x * b.x,
                      a.y * b.y,
                      a.z * b.z,
                      a.w * b.w);
+#endif
 }
 
 occaFunction inline float4  operator *  (const float &a, const float4 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_FLOAT4(a * b.reg);
+#else
   return OCCA_FLOAT4(a * b.x,
                      a * b.y,
                      a * b.z,
                      a * b.w);
+#endif
 }
 
 occaFunction inline float4  operator *  (const float4 &a, const float &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_FLOAT4(a.reg * b);
+#else
   return OCCA_FLOAT4(a.x * b,
                      a.y * b,
                      a.z * b,
                      a.w * b);
+#endif
 }
 
 occaFunction inline float4& operator *= (      float4 &a, const float4 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.reg *= b.reg;
+#else
   a.x *= b.x;
   a.y *= b.y;
   a.z *= b.z;
   a.w *= b.w;
+#endif
   return a;
 }
 
 occaFunction inline float4& operator *= (      float4 &a, const float &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.reg *= b;
+#else
   a.x *= b;
   a.y *= b;
   a.z *= b;
   a.w *= b;
+#endif
   return a;
 }
 occaFunction inline float4  operator /  (const float4 &a, const float4 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_FLOAT4(a.reg / b.reg);
+#else
   return OCCA_FLOAT4(a.x / b.x,
                      a.y / b.y,
                      a.z / b.z,
                      a.w / b.w);
+#endif
 }
 
 occaFunction inline float4  operator /  (const float &a, const float4 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_FLOAT4(a / b.reg);
+#else
   return OCCA_FLOAT4(a / b.x,
                      a / b.y,
                      a / b.z,
                      a / b.w);
+#endif
 }
 
 occaFunction inline float4  operator /  (const float4 &a, const float &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_FLOAT4(a.reg / b);
+#else
   return OCCA_FLOAT4(a.x / b,
                      a.y / b,
                      a.z / b,
                      a.w / b);
+#endif
 }
 
 occaFunction inline float4& operator /= (      float4 &a, const float4 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.reg /= b.reg;
+#else
   a.x /= b.x;
   a.y /= b.y;
   a.z /= b.z;
   a.w /= b.w;
+#endif
   return a;
 }
 
 occaFunction inline float4& operator /= (      float4 &a, const float &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.reg /= b;
+#else
   a.x /= b;
   a.y /= b;
   a.z /= b;
   a.w /= b;
+#endif
   return a;
 }
 
@@ -9424,8 +12385,16 @@ typedef float4 float3;
 
 //---[ float8 ]-------------------------
 #define OCCA_FLOAT8 float8
+#if OCCA_VECTOR_EXTENSIONS
+typedef OCCA_VECTOR_EXT_TYPE(float, 8) occaVector_float8;
+#endif
 class float8{
 public:
+#if OCCA_VECTOR_EXTENSIONS
+  union {
+    occaVector_float8 reg;
+    struct {
+#endif
   union { float s0, x; };
   union { float s1, y; };
   union { float s2, z; };
@@ -9434,7 +12403,70 @@ public:
   float s5;
   float s6;
   float s7;
+#if OCCA_VECTOR_EXTENSIONS
+    };
+  };
+#endif
+
+#if OCCA_VECTOR_EXTENSIONS
+  inline occaFunction float8(const occaVector_float8 &reg_) : 
+    reg(reg_) {}
 
+  inline occaFunction float8() : 
+    reg((occaVector_float8) {0, 0, 0, 0, 0, 0, 0, 0}) {}
+
+  inline occaFunction float8(const float &x_) : 
+    reg((occaVector_float8) {x_, 0, 0, 0, 0, 0, 0, 0}) {}
+
+  inline occaFunction float8(const float &x_,
+                             const float &y_) : 
+    reg((occaVector_float8) {x_, y_, 0, 0, 0, 0, 0, 0}) {}
+
+  inline occaFunction float8(const float &x_,
+                             const float &y_,
+                             const float &z_) : 
+    reg((occaVector_float8) {x_, y_, z_, 0, 0, 0, 0, 0}) {}
+
+  inline occaFunction float8(const float &x_,
+                             const float &y_,
+                             const float &z_,
+                             const float &w_) : 
+    reg((occaVector_float8) {x_, y_, z_, w_, 0, 0, 0, 0}) {}
+
+  inline occaFunction float8(const float &x_,
+                             const float &y_,
+                             const float &z_,
+                             const float &w_,
+                             const float &s4_) : 
+    reg((occaVector_float8) {x_, y_, z_, w_, s4_, 0, 0, 0}) {}
+
+  inline occaFunction float8(const float &x_,
+                             const float &y_,
+                             const float &z_,
+                             const float &w_,
+                             const float &s4_,
+                             const float &s5_) : 
+    reg((occaVector_float8) {x_, y_, z_, w_, s4_, s5_, 0, 0}) {}
+
+  inline occaFunction float8(const float &x_,
+                             const float &y_,
+                             const float &z_,
+                             const float &w_,
+                             const float &s4_,
+                             const float &s5_,
+                             const float &s6_) : 
+    reg((occaVector_float8) {x_, y_, z_, w_, s4_, s5_, s6_, 0}) {}
+
+  inline occaFunction float8(const float &x_,
+                             const float &y_,
+                             const float &z_,
+                             const float &w_,
+                             const float &s4_,
+                             const float &s5_,
+                             const float &s6_,
+                             const float &s7_) : 
+    reg((occaVector_float8) {x_, y_, z_, w_, s4_, s5_, s6_, s7_}) {}
+#else
   inline occaFunction float8() : 
     x(0),
     y(0),
@@ -9552,9 +12584,13 @@ public:
     s5(s5_),
     s6(s6_),
     s7(s7_) {}
+#endif
 };
 
 occaFunction inline float8 operator + (const float8 &a){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_FLOAT8(+a.reg);
+#else
   return OCCA_FLOAT8(+a.x,
                      +a.y,
                      +a.z,
@@ -9563,8 +12599,12 @@ occaFunction inline float8 operator + (const float8 &a){
                      +a.s5,
                      +a.s6,
                      +a.s7);
+#endif
 }
 occaFunction inline float8 operator - (const float8 &a){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_FLOAT8(-a.reg);
+#else
   return OCCA_FLOAT8(-a.x,
                      -a.y,
                      -a.z,
@@ -9573,8 +12613,12 @@ occaFunction inline float8 operator - (const float8 &a){
                      -a.s5,
                      -a.s6,
                      -a.s7);
+#endif
 }
 occaFunction inline float8  operator +  (const float8 &a, const float8 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_FLOAT8(a.reg + b.reg);
+#else
   return OCCA_FLOAT8(a.x + b.x,
                      a.y + b.y,
                      a.z + b.z,
@@ -9583,9 +12627,13 @@ occaFunction inline float8  operator +  (const float8 &a, const float8 &b){
                      a.s5 + b.s5,
                      a.s6 + b.s6,
                      a.s7 + b.s7);
+#endif
 }
 
 occaFunction inline float8  operator +  (const float &a, const float8 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_FLOAT8(a + b.reg);
+#else
   return OCCA_FLOAT8(a + b.x,
                      a + b.y,
                      a + b.z,
@@ -9594,9 +12642,13 @@ occaFunction inline float8  operator +  (const float &a, const float8 &b){
                      a + b.s5,
                      a + b.s6,
                      a + b.s7);
+#endif
 }
 
 occaFunction inline float8  operator +  (const float8 &a, const float &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_FLOAT8(a.reg + b);
+#else
   return OCCA_FLOAT8(a.x + b,
                      a.y + b,
                      a.z + b,
@@ -9605,9 +12657,13 @@ occaFunction inline float8  operator +  (const float8 &a, const float &b){
                      a.s5 + b,
                      a.s6 + b,
                      a.s7 + b);
+#endif
 }
 
 occaFunction inline float8& operator += (      float8 &a, const float8 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.reg += b.reg;
+#else
   a.x += b.x;
   a.y += b.y;
   a.z += b.z;
@@ -9616,10 +12672,14 @@ occaFunction inline float8& operator += (      float8 &a, const float8 &b){
   a.s5 += b.s5;
   a.s6 += b.s6;
   a.s7 += b.s7;
+#endif
   return a;
 }
 
 occaFunction inline float8& operator += (      float8 &a, const float &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.reg += b;
+#else
   a.x += b;
   a.y += b;
   a.z += b;
@@ -9628,9 +12688,13 @@ occaFunction inline float8& operator += (      float8 &a, const float &b){
   a.s5 += b;
   a.s6 += b;
   a.s7 += b;
+#endif
   return a;
 }
 occaFunction inline float8  operator -  (const float8 &a, const float8 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_FLOAT8(a.reg - b.reg);
+#else
   return OCCA_FLOAT8(a.x - b.x,
                      a.y - b.y,
                      a.z - b.z,
@@ -9639,9 +12703,13 @@ occaFunction inline float8  operator -  (const float8 &a, const float8 &b){
                      a.s5 - b.s5,
                      a.s6 - b.s6,
                      a.s7 - b.s7);
+#endif
 }
 
 occaFunction inline float8  operator -  (const float &a, const float8 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_FLOAT8(a - b.reg);
+#else
   return OCCA_FLOAT8(a - b.x,
                      a - b.y,
                      a - b.z,
@@ -9650,9 +12718,13 @@ occaFunction inline float8  operator -  (const float &a, const float8 &b){
                      a - b.s5,
                      a - b.s6,
                      a - b.s7);
+#endif
 }
 
 occaFunction inline float8  operator -  (const float8 &a, const float &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_FLOAT8(a.reg - b);
+#else
   return OCCA_FLOAT8(a.x - b,
                      a.y - b,
                      a.z - b,
@@ -9661,9 +12733,13 @@ occaFunction inline float8  operator -  (const float8 &a, const float &b){
                      a.s5 - b,
                      a.s6 - b,
                      a.s7 - b);
+#endif
 }
 
 occaFunction inline float8& operator -= (      float8 &a, const float8 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.reg -= b.reg;
+#else
   a.x -= b.x;
   a.y -= b.y;
   a.z -= b.z;
@@ -9672,10 +12748,14 @@ occaFunction inline float8& operator -= (      float8 &a, const float8 &b){
   a.s5 -= b.s5;
   a.s6 -= b.s6;
   a.s7 -= b.s7;
+#endif
   return a;
 }
 
 occaFunction inline float8& operator -= (      float8 &a, const float &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.reg -= b;
+#else
   a.x -= b;
   a.y -= b;
   a.z -= b;
@@ -9684,9 +12764,13 @@ occaFunction inline float8& operator -= (      float8 &a, const float &b){
   a.s5 -= b;
   a.s6 -= b;
   a.s7 -= b;
+#endif
   return a;
 }
 occaFunction inline float8  operator *  (const float8 &a, const float8 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_FLOAT8(a.reg * b.reg);
+#else
   return OCCA_FLOAT8(a.x * b.x,
                      a.y * b.y,
                      a.z * b.z,
@@ -9695,9 +12779,13 @@ occaFunction inline float8  operator *  (const float8 &a, const float8 &b){
                      a.s5 * b.s5,
                      a.s6 * b.s6,
                      a.s7 * b.s7);
+#endif
 }
 
 occaFunction inline float8  operator *  (const float &a, const float8 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_FLOAT8(a * b.reg);
+#else
   return OCCA_FLOAT8(a * b.x,
                      a * b.y,
                      a * b.z,
@@ -9706,9 +12794,13 @@ occaFunction inline float8  operator *  (const float &a, const float8 &b){
                      a * b.s5,
                      a * b.s6,
                      a * b.s7);
+#endif
 }
 
 occaFunction inline float8  operator *  (const float8 &a, const float &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_FLOAT8(a.reg * b);
+#else
   return OCCA_FLOAT8(a.x * b,
                      a.y * b,
                      a.z * b,
@@ -9717,9 +12809,13 @@ occaFunction inline float8  operator *  (const float8 &a, const float &b){
                      a.s5 * b,
                      a.s6 * b,
                      a.s7 * b);
+#endif
 }
 
 occaFunction inline float8& operator *= (      float8 &a, const float8 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.reg *= b.reg;
+#else
   a.x *= b.x;
   a.y *= b.y;
   a.z *= b.z;
@@ -9728,10 +12824,14 @@ occaFunction inline float8& operator *= (      float8 &a, const float8 &b){
   a.s5 *= b.s5;
   a.s6 *= b.s6;
   a.s7 *= b.s7;
+#endif
   return a;
 }
 
 occaFunction inline float8& operator *= (      float8 &a, const float &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.reg *= b;
+#else
   a.x *= b;
   a.y *= b;
   a.z *= b;
@@ -9740,9 +12840,13 @@ occaFunction inline float8& operator *= (      float8 &a, const float &b){
   a.s5 *= b;
   a.s6 *= b;
   a.s7 *= b;
+#endif
   return a;
 }
 occaFunction inline float8  operator /  (const float8 &a, const float8 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_FLOAT8(a.reg / b.reg);
+#else
   return OCCA_FLOAT8(a.x / b.x,
                      a.y / b.y,
                      a.z / b.z,
@@ -9751,9 +12855,13 @@ occaFunction inline float8  operator /  (const float8 &a, const float8 &b){
                      a.s5 / b.s5,
                      a.s6 / b.s6,
                      a.s7 / b.s7);
+#endif
 }
 
 occaFunction inline float8  operator /  (const float &a, const float8 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_FLOAT8(a / b.reg);
+#else
   return OCCA_FLOAT8(a / b.x,
                      a / b.y,
                      a / b.z,
@@ -9762,9 +12870,13 @@ occaFunction inline float8  operator /  (const float &a, const float8 &b){
                      a / b.s5,
                      a / b.s6,
                      a / b.s7);
+#endif
 }
 
 occaFunction inline float8  operator /  (const float8 &a, const float &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_FLOAT8(a.reg / b);
+#else
   return OCCA_FLOAT8(a.x / b,
                      a.y / b,
                      a.z / b,
@@ -9773,9 +12885,13 @@ occaFunction inline float8  operator /  (const float8 &a, const float &b){
                      a.s5 / b,
                      a.s6 / b,
                      a.s7 / b);
+#endif
 }
 
 occaFunction inline float8& operator /= (      float8 &a, const float8 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.reg /= b.reg;
+#else
   a.x /= b.x;
   a.y /= b.y;
   a.z /= b.z;
@@ -9784,10 +12900,14 @@ occaFunction inline float8& operator /= (      float8 &a, const float8 &b){
   a.s5 /= b.s5;
   a.s6 /= b.s6;
   a.s7 /= b.s7;
+#endif
   return a;
 }
 
 occaFunction inline float8& operator /= (      float8 &a, const float &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.reg /= b;
+#else
   a.x /= b;
   a.y /= b;
   a.z /= b;
@@ -9796,6 +12916,7 @@ occaFunction inline float8& operator /= (      float8 &a, const float &b){
   a.s5 /= b;
   a.s6 /= b;
   a.s7 /= b;
+#endif
   return a;
 }
 
@@ -9820,8 +12941,16 @@ inline std::ostream& operator << (std::ostream &out, const float8& a){
 
 //---[ float16 ]------------------------
 #define OCCA_FLOAT16 float16
+#if OCCA_VECTOR_EXTENSIONS
+typedef OCCA_VECTOR_EXT_TYPE(float, 16) occaVector_float16;
+#endif
 class float16{
 public:
+#if OCCA_VECTOR_EXTENSIONS
+  union {
+    occaVector_float16 reg;
+    struct {
+#endif
   union { float s0, x; };
   union { float s1, y; };
   union { float s2, z; };
@@ -9838,7 +12967,186 @@ public:
   float s13;
   float s14;
   float s15;
+#if OCCA_VECTOR_EXTENSIONS
+    };
+  };
+#endif
+
+#if OCCA_VECTOR_EXTENSIONS
+  inline occaFunction float16(const occaVector_float16 &reg_) : 
+    reg(reg_) {}
+
+  inline occaFunction float16() : 
+    reg((occaVector_float16) {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}) {}
+
+  inline occaFunction float16(const float &x_) : 
+    reg((occaVector_float16) {x_, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}) {}
+
+  inline occaFunction float16(const float &x_,
+                              const float &y_) : 
+    reg((occaVector_float16) {x_, y_, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}) {}
+
+  inline occaFunction float16(const float &x_,
+                              const float &y_,
+                              const float &z_) : 
+    reg((occaVector_float16) {x_, y_, z_, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}) {}
+
+  inline occaFunction float16(const float &x_,
+                              const float &y_,
+                              const float &z_,
+                              const float &w_) : 
+    reg((occaVector_float16) {x_, y_, z_, w_, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}) {}
+
+  inline occaFunction float16(const float &x_,
+                              const float &y_,
+                              const float &z_,
+                              const float &w_,
+                              const float &s4_) : 
+    reg((occaVector_float16) {x_, y_, z_, w_, s4_, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}) {}
+
+  inline occaFunction float16(const float &x_,
+                              const float &y_,
+                              const float &z_,
+                              const float &w_,
+                              const float &s4_,
+                              const float &s5_) : 
+    reg((occaVector_float16) {x_, y_, z_, w_, s4_, s5_, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}) {}
+
+  inline occaFunction float16(const float &x_,
+                              const float &y_,
+                              const float &z_,
+                              const float &w_,
+                              const float &s4_,
+                              const float &s5_,
+                              const float &s6_) : 
+    reg((occaVector_float16) {x_, y_, z_, w_, s4_, s5_, s6_, 0, 0, 0, 0, 0, 0, 0, 0, 0}) {}
+
+  inline occaFunction float16(const float &x_,
+                              const float &y_,
+                              const float &z_,
+                              const float &w_,
+                              const float &s4_,
+                              const float &s5_,
+                              const float &s6_,
+                              const float &s7_) : 
+    reg((occaVector_float16) {x_, y_, z_, w_, s4_, s5_, s6_, s7_, 0, 0, 0, 0, 0, 0, 0, 0}) {}
+
+  inline occaFunction float16(const float &x_,
+                              const float &y_,
+                              const float &z_,
+                              const float &w_,
+                              const float &s4_,
+                              const float &s5_,
+                              const float &s6_,
+                              const float &s7_,
+                              const float &s8_) : 
+    reg((occaVector_float16) {x_, y_, z_, w_, s4_, s5_, s6_, s7_, s8_, 0, 0, 0, 0, 0, 0, 0}) {}
+
+  inline occaFunction float16(const float &x_,
+                              const float &y_,
+                              const float &z_,
+                              const float &w_,
+                              const float &s4_,
+                              const float &s5_,
+                              const float &s6_,
+                              const float &s7_,
+                              const float &s8_,
+                              const float &s9_) : 
+    reg((occaVector_float16) {x_, y_, z_, w_, s4_, s5_, s6_, s7_, s8_, s9_, 0, 0, 0, 0, 0, 0}) {}
+
+  inline occaFunction float16(const float &x_,
+                              const float &y_,
+                              const float &z_,
+                              const float &w_,
+                              const float &s4_,
+                              const float &s5_,
+                              const float &s6_,
+                              const float &s7_,
+                              const float &s8_,
+                              const float &s9_,
+                              const float &s10_) : 
+    reg((occaVector_float16) {x_, y_, z_, w_, s4_, s5_, s6_, s7_, s8_, s9_, s10_, 0, 0, 0, 0, 0}) {}
+
+  inline occaFunction float16(const float &x_,
+                              const float &y_,
+                              const float &z_,
+                              const float &w_,
+                              const float &s4_,
+                              const float &s5_,
+                              const float &s6_,
+                              const float &s7_,
+                              const float &s8_,
+                              const float &s9_,
+                              const float &s10_,
+                              const float &s11_) : 
+    reg((occaVector_float16) {x_, y_, z_, w_, s4_, s5_, s6_, s7_, s8_, s9_, s10_, s11_, 0, 0, 0, 0}) {}
+
+  inline occaFunction float16(const float &x_,
+                              const float &y_,
+                              const float &z_,
+                              const float &w_,
+                              const float &s4_,
+                              const float &s5_,
+                              const float &s6_,
+                              const float &s7_,
+                              const float &s8_,
+                              const float &s9_,
+                              const float &s10_,
+                              const float &s11_,
+                              const float &s12_) : 
+    reg((occaVector_float16) {x_, y_, z_, w_, s4_, s5_, s6_, s7_, s8_, s9_, s10_, s11_, s12_, 0, 0, 0}) {}
+
+  inline occaFunction float16(const float &x_,
+                              const float &y_,
+                              const float &z_,
+                              const float &w_,
+                              const float &s4_,
+                              const float &s5_,
+                              const float &s6_,
+                              const float &s7_,
+                              const float &s8_,
+                              const float &s9_,
+                              const float &s10_,
+                              const float &s11_,
+                              const float &s12_,
+                              const float &s13_) : 
+    reg((occaVector_float16) {x_, y_, z_, w_, s4_, s5_, s6_, s7_, s8_, s9_, s10_, s11_, s12_, s13_, 0, 0}) {}
+
+  inline occaFunction float16(const float &x_,
+                              const float &y_,
+                              const float &z_,
+                              const float &w_,
+                              const float &s4_,
+                              const float &s5_,
+                              const float &s6_,
+                              const float &s7_,
+                              const float &s8_,
+                              const float &s9_,
+                              const float &s10_,
+                              const float &s11_,
+                              const float &s12_,
+                              const float &s13_,
+                              const float &s14_) : 
+    reg((occaVector_float16) {x_, y_, z_, w_, s4_, s5_, s6_, s7_, s8_, s9_, s10_, s11_, s12_, s13_, s14_, 0}) {}
 
+  inline occaFunction float16(const float &x_,
+                              const float &y_,
+                              const float &z_,
+                              const float &w_,
+                              const float &s4_,
+                              const float &s5_,
+                              const float &s6_,
+                              const float &s7_,
+                              const float &s8_,
+                              const float &s9_,
+                              const float &s10_,
+                              const float &s11_,
+                              const float &s12_,
+                              const float &s13_,
+                              const float &s14_,
+                              const float &s15_) : 
+    reg((occaVector_float16) {x_, y_, z_, w_, s4_, s5_, s6_, s7_, s8_, s9_, s10_, s11_, s12_, s13_, s14_, s15_}) {}
+#else
   inline occaFunction float16() : 
     x(0),
     y(0),
@@ -10264,9 +13572,13 @@ public:
     s13(s13_),
     s14(s14_),
     s15(s15_) {}
+#endif
 };
 
 occaFunction inline float16 operator + (const float16 &a){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_FLOAT16(+a.reg);
+#else
   return OCCA_FLOAT16(+a.x,
                       +a.y,
                       +a.z,
@@ -10283,8 +13595,12 @@ occaFunction inline float16 operator + (const float16 &a){
                       +a.s13,
                       +a.s14,
                       +a.s15);
+#endif
 }
 occaFunction inline float16 operator - (const float16 &a){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_FLOAT16(-a.reg);
+#else
   return OCCA_FLOAT16(-a.x,
                       -a.y,
                       -a.z,
@@ -10301,8 +13617,12 @@ occaFunction inline float16 operator - (const float16 &a){
                       -a.s13,
                       -a.s14,
                       -a.s15);
+#endif
 }
 occaFunction inline float16  operator +  (const float16 &a, const float16 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_FLOAT16(a.reg + b.reg);
+#else
   return OCCA_FLOAT16(a.x + b.x,
                       a.y + b.y,
                       a.z + b.z,
@@ -10319,9 +13639,13 @@ occaFunction inline float16  operator +  (const float16 &a, const float16 &b){
                       a.s13 + b.s13,
                       a.s14 + b.s14,
                       a.s15 + b.s15);
+#endif
 }
 
 occaFunction inline float16  operator +  (const float &a, const float16 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_FLOAT16(a + b.reg);
+#else
   return OCCA_FLOAT16(a + b.x,
                       a + b.y,
                       a + b.z,
@@ -10338,9 +13662,13 @@ occaFunction inline float16  operator +  (const float &a, const float16 &b){
                       a + b.s13,
                       a + b.s14,
                       a + b.s15);
+#endif
 }
 
 occaFunction inline float16  operator +  (const float16 &a, const float &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_FLOAT16(a.reg + b);
+#else
   return OCCA_FLOAT16(a.x + b,
                       a.y + b,
                       a.z + b,
@@ -10357,9 +13685,13 @@ occaFunction inline float16  operator +  (const float16 &a, const float &b){
                       a.s13 + b,
                       a.s14 + b,
                       a.s15 + b);
+#endif
 }
 
 occaFunction inline float16& operator += (      float16 &a, const float16 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.reg += b.reg;
+#else
   a.x += b.x;
   a.y += b.y;
   a.z += b.z;
@@ -10376,10 +13708,14 @@ occaFunction inline float16& operator += (      float16 &a, const float16 &b){
   a.s13 += b.s13;
   a.s14 += b.s14;
   a.s15 += b.s15;
+#endif
   return a;
 }
 
 occaFunction inline float16& operator += (      float16 &a, const float &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.reg += b;
+#else
   a.x += b;
   a.y += b;
   a.z += b;
@@ -10396,9 +13732,13 @@ occaFunction inline float16& operator += (      float16 &a, const float &b){
   a.s13 += b;
   a.s14 += b;
   a.s15 += b;
+#endif
   return a;
 }
 occaFunction inline float16  operator -  (const float16 &a, const float16 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_FLOAT16(a.reg - b.reg);
+#else
   return OCCA_FLOAT16(a.x - b.x,
                       a.y - b.y,
                       a.z - b.z,
@@ -10415,9 +13755,13 @@ occaFunction inline float16  operator -  (const float16 &a, const float16 &b){
                       a.s13 - b.s13,
                       a.s14 - b.s14,
                       a.s15 - b.s15);
+#endif
 }
 
 occaFunction inline float16  operator -  (const float &a, const float16 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_FLOAT16(a - b.reg);
+#else
   return OCCA_FLOAT16(a - b.x,
                       a - b.y,
                       a - b.z,
@@ -10434,9 +13778,13 @@ occaFunction inline float16  operator -  (const float &a, const float16 &b){
                       a - b.s13,
                       a - b.s14,
                       a - b.s15);
+#endif
 }
 
 occaFunction inline float16  operator -  (const float16 &a, const float &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_FLOAT16(a.reg - b);
+#else
   return OCCA_FLOAT16(a.x - b,
                       a.y - b,
                       a.z - b,
@@ -10453,9 +13801,13 @@ occaFunction inline float16  operator -  (const float16 &a, const float &b){
                       a.s13 - b,
                       a.s14 - b,
                       a.s15 - b);
+#endif
 }
 
 occaFunction inline float16& operator -= (      float16 &a, const float16 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.reg -= b.reg;
+#else
   a.x -= b.x;
   a.y -= b.y;
   a.z -= b.z;
@@ -10472,10 +13824,14 @@ occaFunction inline float16& operator -= (      float16 &a, const float16 &b){
   a.s13 -= b.s13;
   a.s14 -= b.s14;
   a.s15 -= b.s15;
+#endif
   return a;
 }
 
 occaFunction inline float16& operator -= (      float16 &a, const float &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.reg -= b;
+#else
   a.x -= b;
   a.y -= b;
   a.z -= b;
@@ -10492,9 +13848,13 @@ occaFunction inline float16& operator -= (      float16 &a, const float &b){
   a.s13 -= b;
   a.s14 -= b;
   a.s15 -= b;
+#endif
   return a;
 }
 occaFunction inline float16  operator *  (const float16 &a, const float16 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_FLOAT16(a.reg * b.reg);
+#else
   return OCCA_FLOAT16(a.x * b.x,
                       a.y * b.y,
                       a.z * b.z,
@@ -10511,9 +13871,13 @@ occaFunction inline float16  operator *  (const float16 &a, const float16 &b){
                       a.s13 * b.s13,
                       a.s14 * b.s14,
                       a.s15 * b.s15);
+#endif
 }
 
 occaFunction inline float16  operator *  (const float &a, const float16 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_FLOAT16(a * b.reg);
+#else
   return OCCA_FLOAT16(a * b.x,
                       a * b.y,
                       a * b.z,
@@ -10530,9 +13894,13 @@ occaFunction inline float16  operator *  (const float &a, const float16 &b){
                       a * b.s13,
                       a * b.s14,
                       a * b.s15);
+#endif
 }
 
 occaFunction inline float16  operator *  (const float16 &a, const float &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_FLOAT16(a.reg * b);
+#else
   return OCCA_FLOAT16(a.x * b,
                       a.y * b,
                       a.z * b,
@@ -10549,9 +13917,13 @@ occaFunction inline float16  operator *  (const float16 &a, const float &b){
                       a.s13 * b,
                       a.s14 * b,
                       a.s15 * b);
+#endif
 }
 
 occaFunction inline float16& operator *= (      float16 &a, const float16 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.reg *= b.reg;
+#else
   a.x *= b.x;
   a.y *= b.y;
   a.z *= b.z;
@@ -10568,10 +13940,14 @@ occaFunction inline float16& operator *= (      float16 &a, const float16 &b){
   a.s13 *= b.s13;
   a.s14 *= b.s14;
   a.s15 *= b.s15;
+#endif
   return a;
 }
 
 occaFunction inline float16& operator *= (      float16 &a, const float &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.reg *= b;
+#else
   a.x *= b;
   a.y *= b;
   a.z *= b;
@@ -10588,9 +13964,13 @@ occaFunction inline float16& operator *= (      float16 &a, const float &b){
   a.s13 *= b;
   a.s14 *= b;
   a.s15 *= b;
+#endif
   return a;
 }
 occaFunction inline float16  operator /  (const float16 &a, const float16 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_FLOAT16(a.reg / b.reg);
+#else
   return OCCA_FLOAT16(a.x / b.x,
                       a.y / b.y,
                       a.z / b.z,
@@ -10607,9 +13987,13 @@ occaFunction inline float16  operator /  (const float16 &a, const float16 &b){
                       a.s13 / b.s13,
                       a.s14 / b.s14,
                       a.s15 / b.s15);
+#endif
 }
 
 occaFunction inline float16  operator /  (const float &a, const float16 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_FLOAT16(a / b.reg);
+#else
   return OCCA_FLOAT16(a / b.x,
                       a / b.y,
                       a / b.z,
@@ -10626,9 +14010,13 @@ occaFunction inline float16  operator /  (const float &a, const float16 &b){
                       a / b.s13,
                       a / b.s14,
                       a / b.s15);
+#endif
 }
 
 occaFunction inline float16  operator /  (const float16 &a, const float &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_FLOAT16(a.reg / b);
+#else
   return OCCA_FLOAT16(a.x / b,
                       a.y / b,
                       a.z / b,
@@ -10645,9 +14033,13 @@ occaFunction inline float16  operator /  (const float16 &a, const float &b){
                       a.s13 / b,
                       a.s14 / b,
                       a.s15 / b);
+#endif
 }
 
 occaFunction inline float16& operator /= (      float16 &a, const float16 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.reg /= b.reg;
+#else
   a.x /= b.x;
   a.y /= b.y;
   a.z /= b.z;
@@ -10664,10 +14056,14 @@ occaFunction inline float16& operator /= (      float16 &a, const float16 &b){
   a.s13 /= b.s13;
   a.s14 /= b.s14;
   a.s15 /= b.s15;
+#endif
   return a;
 }
 
 occaFunction inline float16& operator /= (      float16 &a, const float &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.reg /= b;
+#else
   a.x /= b;
   a.y /= b;
   a.z /= b;
@@ -10684,6 +14080,7 @@ occaFunction inline float16& operator /= (      float16 &a, const float &b){
   a.s13 /= b;
   a.s14 /= b;
   a.s15 /= b;
+#endif
   return a;
 }
 
@@ -10721,11 +14118,37 @@ inline std::ostream& operator << (std::ostream &out, const float16& a){
 #  define OCCA_DOUBLE2 double2
 #endif
 #if (!defined(OCCA_IN_KERNEL) || (OCCA_USING_CUDA == 0))
+#if OCCA_VECTOR_EXTENSIONS
+typedef OCCA_VECTOR_EXT_TYPE(double, 2) occaVector_double2;
+#endif
 class double2{
 public:
+#if OCCA_VECTOR_EXTENSIONS
+  union {
+    occaVector_double2 reg;
+    struct {
+#endif
   union { double s0, x; };
   union { double s1, y; };
+#if OCCA_VECTOR_EXTENSIONS
+    };
+  };
+#endif
+
+#if OCCA_VECTOR_EXTENSIONS
+  inline occaFunction double2(const occaVector_double2 &reg_) : 
+    reg(reg_) {}
+
+  inline occaFunction double2() : 
+    reg((occaVector_double2) {0, 0}) {}
+
+  inline occaFunction double2(const double &x_) : 
+    reg((occaVector_double2) {x_, 0}) {}
 
+  inline occaFunction double2(const double &x_,
+                              const double &y_) : 
+    reg((occaVector_double2) {x_, y_}) {}
+#else
   inline occaFunction double2() : 
     x(0),
     y(0) {}
@@ -10738,119 +14161,208 @@ public:
                               const double &y_) : 
     x(x_),
     y(y_) {}
+#endif
 };
 #endif
 
 occaFunction inline double2 operator + (const double2 &a){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_DOUBLE2(+a.reg);
+#else
   return OCCA_DOUBLE2(+a.x,
                       +a.y);
+#endif
 }
 occaFunction inline double2 operator - (const double2 &a){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_DOUBLE2(-a.reg);
+#else
   return OCCA_DOUBLE2(-a.x,
                       -a.y);
+#endif
 }
 occaFunction inline double2  operator +  (const double2 &a, const double2 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_DOUBLE2(a.reg + b.reg);
+#else
   return OCCA_DOUBLE2(a.x + b.x,
                       a.y + b.y);
+#endif
 }
 
 occaFunction inline double2  operator +  (const double &a, const double2 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_DOUBLE2(a + b.reg);
+#else
   return OCCA_DOUBLE2(a + b.x,
                       a + b.y);
+#endif
 }
 
 occaFunction inline double2  operator +  (const double2 &a, const double &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_DOUBLE2(a.reg + b);
+#else
   return OCCA_DOUBLE2(a.x + b,
                       a.y + b);
+#endif
 }
 
 occaFunction inline double2& operator += (      double2 &a, const double2 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.reg += b.reg;
+#else
   a.x += b.x;
   a.y += b.y;
+#endif
   return a;
 }
 
 occaFunction inline double2& operator += (      double2 &a, const double &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.reg += b;
+#else
   a.x += b;
   a.y += b;
+#endif
   return a;
 }
 occaFunction inline double2  operator -  (const double2 &a, const double2 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_DOUBLE2(a.reg - b.reg);
+#else
   return OCCA_DOUBLE2(a.x - b.x,
                       a.y - b.y);
+#endif
 }
 
 occaFunction inline double2  operator -  (const double &a, const double2 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_DOUBLE2(a - b.reg);
+#else
   return OCCA_DOUBLE2(a - b.x,
                       a - b.y);
+#endif
 }
 
 occaFunction inline double2  operator -  (const double2 &a, const double &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_DOUBLE2(a.reg - b);
+#else
   return OCCA_DOUBLE2(a.x - b,
                       a.y - b);
+#endif
 }
 
 occaFunction inline double2& operator -= (      double2 &a, const double2 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.reg -= b.reg;
+#else
   a.x -= b.x;
   a.y -= b.y;
+#endif
   return a;
 }
 
 occaFunction inline double2& operator -= (      double2 &a, const double &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.reg -= b;
+#else
   a.x -= b;
   a.y -= b;
+#endif
   return a;
 }
 occaFunction inline double2  operator *  (const double2 &a, const double2 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_DOUBLE2(a.reg * b.reg);
+#else
   return OCCA_DOUBLE2(a.x * b.x,
                       a.y * b.y);
+#endif
 }
 
 occaFunction inline double2  operator *  (const double &a, const double2 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_DOUBLE2(a * b.reg);
+#else
   return OCCA_DOUBLE2(a * b.x,
                       a * b.y);
+#endif
 }
 
 occaFunction inline double2  operator *  (const double2 &a, const double &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_DOUBLE2(a.reg * b);
+#else
   return OCCA_DOUBLE2(a.x * b,
                       a.y * b);
+#endif
 }
 
 occaFunction inline double2& operator *= (      double2 &a, const double2 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.reg *= b.reg;
+#else
   a.x *= b.x;
   a.y *= b.y;
+#endif
   return a;
 }
 
 occaFunction inline double2& operator *= (      double2 &a, const double &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.reg *= b;
+#else
   a.x *= b;
   a.y *= b;
+#endif
   return a;
 }
 occaFunction inline double2  operator /  (const double2 &a, const double2 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_DOUBLE2(a.reg / b.reg);
+#else
   return OCCA_DOUBLE2(a.x / b.x,
                       a.y / b.y);
+#endif
 }
 
 occaFunction inline double2  operator /  (const double &a, const double2 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_DOUBLE2(a / b.reg);
+#else
   return OCCA_DOUBLE2(a / b.x,
                       a / b.y);
+#endif
 }
 
 occaFunction inline double2  operator /  (const double2 &a, const double &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_DOUBLE2(a.reg / b);
+#else
   return OCCA_DOUBLE2(a.x / b,
                       a.y / b);
+#endif
 }
 
 occaFunction inline double2& operator /= (      double2 &a, const double2 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.reg /= b.reg;
+#else
   a.x /= b.x;
   a.y /= b.y;
+#endif
   return a;
 }
 
 occaFunction inline double2& operator /= (      double2 &a, const double &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.reg /= b;
+#else
   a.x /= b;
   a.y /= b;
+#endif
   return a;
 }
 
@@ -10874,13 +14386,50 @@ inline std::ostream& operator << (std::ostream &out, const double2& a){
 #  define OCCA_DOUBLE4 double4
 #endif
 #if (!defined(OCCA_IN_KERNEL) || (OCCA_USING_CUDA == 0))
+#if OCCA_VECTOR_EXTENSIONS
+typedef OCCA_VECTOR_EXT_TYPE(double, 4) occaVector_double4;
+#endif
 class double4{
 public:
+#if OCCA_VECTOR_EXTENSIONS
+  union {
+    occaVector_double4 reg;
+    struct {
+#endif
   union { double s0, x; };
   union { double s1, y; };
   union { double s2, z; };
   union { double s3, w; };
+#if OCCA_VECTOR_EXTENSIONS
+    };
+  };
+#endif
+
+#if OCCA_VECTOR_EXTENSIONS
+  inline occaFunction double4(const occaVector_double4 &reg_) : 
+    reg(reg_) {}
+
+  inline occaFunction double4() : 
+    reg((occaVector_double4) {0, 0, 0, 0}) {}
+
+  inline occaFunction double4(const double &x_) : 
+    reg((occaVector_double4) {x_, 0, 0, 0}) {}
+
+  inline occaFunction double4(const double &x_,
+                              const double &y_) : 
+    reg((occaVector_double4) {x_, y_, 0, 0}) {}
+
+  inline occaFunction double4(const double &x_,
+                              const double &y_,
+                              const double &z_) : 
+    reg((occaVector_double4) {x_, y_, z_, 0}) {}
 
+  inline occaFunction double4(const double &x_,
+                              const double &y_,
+                              const double &z_,
+                              const double &w_) : 
+    reg((occaVector_double4) {x_, y_, z_, w_}) {}
+#else
   inline occaFunction double4() : 
     x(0),
     y(0),
@@ -10916,163 +14465,252 @@ public:
     y(y_),
     z(z_),
     w(w_) {}
+#endif
 };
 #endif
 
 occaFunction inline double4 operator + (const double4 &a){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_DOUBLE4(+a.reg);
+#else
   return OCCA_DOUBLE4(+a.x,
                       +a.y,
                       +a.z,
                       +a.w);
+#endif
 }
 occaFunction inline double4 operator - (const double4 &a){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_DOUBLE4(-a.reg);
+#else
   return OCCA_DOUBLE4(-a.x,
                       -a.y,
                       -a.z,
                       -a.w);
+#endif
 }
 occaFunction inline double4  operator +  (const double4 &a, const double4 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_DOUBLE4(a.reg + b.reg);
+#else
   return OCCA_DOUBLE4(a.x + b.x,
                       a.y + b.y,
                       a.z + b.z,
                       a.w + b.w);
+#endif
 }
 
 occaFunction inline double4  operator +  (const double &a, const double4 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_DOUBLE4(a + b.reg);
+#else
   return OCCA_DOUBLE4(a + b.x,
                       a + b.y,
                       a + b.z,
                       a + b.w);
+#endif
 }
 
 occaFunction inline double4  operator +  (const double4 &a, const double &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_DOUBLE4(a.reg + b);
+#else
   return OCCA_DOUBLE4(a.x + b,
                       a.y + b,
                       a.z + b,
                       a.w + b);
+#endif
 }
 
 occaFunction inline double4& operator += (      double4 &a, const double4 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.reg += b.reg;
+#else
   a.x += b.x;
   a.y += b.y;
   a.z += b.z;
   a.w += b.w;
+#endif
   return a;
 }
 
 occaFunction inline double4& operator += (      double4 &a, const double &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.reg += b;
+#else
   a.x += b;
   a.y += b;
   a.z += b;
   a.w += b;
+#endif
   return a;
 }
 occaFunction inline double4  operator -  (const double4 &a, const double4 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_DOUBLE4(a.reg - b.reg);
+#else
   return OCCA_DOUBLE4(a.x - b.x,
                       a.y - b.y,
                       a.z - b.z,
                       a.w - b.w);
+#endif
 }
 
 occaFunction inline double4  operator -  (const double &a, const double4 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_DOUBLE4(a - b.reg);
+#else
   return OCCA_DOUBLE4(a - b.x,
                       a - b.y,
                       a - b.z,
                       a - b.w);
+#endif
 }
 
 occaFunction inline double4  operator -  (const double4 &a, const double &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_DOUBLE4(a.reg - b);
+#else
   return OCCA_DOUBLE4(a.x - b,
                       a.y - b,
                       a.z - b,
                       a.w - b);
+#endif
 }
 
 occaFunction inline double4& operator -= (      double4 &a, const double4 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.reg -= b.reg;
+#else
   a.x -= b.x;
   a.y -= b.y;
   a.z -= b.z;
   a.w -= b.w;
+#endif
   return a;
 }
 
 occaFunction inline double4& operator -= (      double4 &a, const double &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.reg -= b;
+#else
   a.x -= b;
   a.y -= b;
   a.z -= b;
   a.w -= b;
+#endif
   return a;
 }
 occaFunction inline double4  operator *  (const double4 &a, const double4 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_DOUBLE4(a.reg * b.reg);
+#else
   return OCCA_DOUBLE4(a.x * b.x,
                       a.y * b.y,
                       a.z * b.z,
                       a.w * b.w);
+#endif
 }
 
 occaFunction inline double4  operator *  (const double &a, const double4 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_DOUBLE4(a * b.reg);
+#else
   return OCCA_DOUBLE4(a * b.x,
                       a * b.y,
                       a * b.z,
                       a * b.w);
+#endif
 }
 
 occaFunction inline double4  operator *  (const double4 &a, const double &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_DOUBLE4(a.reg * b);
+#else
   return OCCA_DOUBLE4(a.x * b,
                       a.y * b,
                       a.z * b,
                       a.w * b);
+#endif
 }
 
 occaFunction inline double4& operator *= (      double4 &a, const double4 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.reg *= b.reg;
+#else
   a.x *= b.x;
   a.y *= b.y;
   a.z *= b.z;
   a.w *= b.w;
+#endif
   return a;
 }
 
 occaFunction inline double4& operator *= (      double4 &a, const double &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.reg *= b;
+#else
   a.x *= b;
   a.y *= b;
   a.z *= b;
   a.w *= b;
+#endif
   return a;
 }
 occaFunction inline double4  operator /  (const double4 &a, const double4 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_DOUBLE4(a.reg / b.reg);
+#else
   return OCCA_DOUBLE4(a.x / b.x,
                       a.y / b.y,
                       a.z / b.z,
                       a.w / b.w);
+#endif
 }
 
 occaFunction inline double4  operator /  (const double &a, const double4 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_DOUBLE4(a / b.reg);
+#else
   return OCCA_DOUBLE4(a / b.x,
                       a / b.y,
                       a / b.z,
                       a / b.w);
+#endif
 }
 
 occaFunction inline double4  operator /  (const double4 &a, const double &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_DOUBLE4(a.reg / b);
+#else
   return OCCA_DOUBLE4(a.x / b,
                       a.y / b,
                       a.z / b,
                       a.w / b);
+#endif
 }
 
 occaFunction inline double4& operator /= (      double4 &a, const double4 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.reg /= b.reg;
+#else
   a.x /= b.x;
   a.y /= b.y;
   a.z /= b.z;
   a.w /= b.w;
+#endif
   return a;
 }
 
 occaFunction inline double4& operator /= (      double4 &a, const double &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.reg /= b;
+#else
   a.x /= b;
   a.y /= b;
   a.z /= b;
   a.w /= b;
+#endif
   return a;
 }
 
@@ -11105,8 +14743,16 @@ typedef double4 double3;
 
 //---[ double8 ]------------------------
 #define OCCA_DOUBLE8 double8
+#if OCCA_VECTOR_EXTENSIONS
+typedef OCCA_VECTOR_EXT_TYPE(double, 8) occaVector_double8;
+#endif
 class double8{
 public:
+#if OCCA_VECTOR_EXTENSIONS
+  union {
+    occaVector_double8 reg;
+    struct {
+#endif
   union { double s0, x; };
   union { double s1, y; };
   union { double s2, z; };
@@ -11115,7 +14761,70 @@ public:
   double s5;
   double s6;
   double s7;
+#if OCCA_VECTOR_EXTENSIONS
+    };
+  };
+#endif
+
+#if OCCA_VECTOR_EXTENSIONS
+  inline occaFunction double8(const occaVector_double8 &reg_) : 
+    reg(reg_) {}
+
+  inline occaFunction double8() : 
+    reg((occaVector_double8) {0, 0, 0, 0, 0, 0, 0, 0}) {}
+
+  inline occaFunction double8(const double &x_) : 
+    reg((occaVector_double8) {x_, 0, 0, 0, 0, 0, 0, 0}) {}
+
+  inline occaFunction double8(const double &x_,
+                              const double &y_) : 
+    reg((occaVector_double8) {x_, y_, 0, 0, 0, 0, 0, 0}) {}
+
+  inline occaFunction double8(const double &x_,
+                              const double &y_,
+                              const double &z_) : 
+    reg((occaVector_double8) {x_, y_, z_, 0, 0, 0, 0, 0}) {}
+
+  inline occaFunction double8(const double &x_,
+                              const double &y_,
+                              const double &z_,
+                              const double &w_) : 
+    reg((occaVector_double8) {x_, y_, z_, w_, 0, 0, 0, 0}) {}
+
+  inline occaFunction double8(const double &x_,
+                              const double &y_,
+                              const double &z_,
+                              const double &w_,
+                              const double &s4_) : 
+    reg((occaVector_double8) {x_, y_, z_, w_, s4_, 0, 0, 0}) {}
+
+  inline occaFunction double8(const double &x_,
+                              const double &y_,
+                              const double &z_,
+                              const double &w_,
+                              const double &s4_,
+                              const double &s5_) : 
+    reg((occaVector_double8) {x_, y_, z_, w_, s4_, s5_, 0, 0}) {}
+
+  inline occaFunction double8(const double &x_,
+                              const double &y_,
+                              const double &z_,
+                              const double &w_,
+                              const double &s4_,
+                              const double &s5_,
+                              const double &s6_) : 
+    reg((occaVector_double8) {x_, y_, z_, w_, s4_, s5_, s6_, 0}) {}
 
+  inline occaFunction double8(const double &x_,
+                              const double &y_,
+                              const double &z_,
+                              const double &w_,
+                              const double &s4_,
+                              const double &s5_,
+                              const double &s6_,
+                              const double &s7_) : 
+    reg((occaVector_double8) {x_, y_, z_, w_, s4_, s5_, s6_, s7_}) {}
+#else
   inline occaFunction double8() : 
     x(0),
     y(0),
@@ -11233,9 +14942,13 @@ public:
     s5(s5_),
     s6(s6_),
     s7(s7_) {}
+#endif
 };
 
 occaFunction inline double8 operator + (const double8 &a){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_DOUBLE8(+a.reg);
+#else
   return OCCA_DOUBLE8(+a.x,
                       +a.y,
                       +a.z,
@@ -11244,8 +14957,12 @@ occaFunction inline double8 operator + (const double8 &a){
                       +a.s5,
                       +a.s6,
                       +a.s7);
+#endif
 }
 occaFunction inline double8 operator - (const double8 &a){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_DOUBLE8(-a.reg);
+#else
   return OCCA_DOUBLE8(-a.x,
                       -a.y,
                       -a.z,
@@ -11254,8 +14971,12 @@ occaFunction inline double8 operator - (const double8 &a){
                       -a.s5,
                       -a.s6,
                       -a.s7);
+#endif
 }
 occaFunction inline double8  operator +  (const double8 &a, const double8 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_DOUBLE8(a.reg + b.reg);
+#else
   return OCCA_DOUBLE8(a.x + b.x,
                       a.y + b.y,
                       a.z + b.z,
@@ -11264,9 +14985,13 @@ occaFunction inline double8  operator +  (const double8 &a, const double8 &b){
                       a.s5 + b.s5,
                       a.s6 + b.s6,
                       a.s7 + b.s7);
+#endif
 }
 
 occaFunction inline double8  operator +  (const double &a, const double8 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_DOUBLE8(a + b.reg);
+#else
   return OCCA_DOUBLE8(a + b.x,
                       a + b.y,
                       a + b.z,
@@ -11275,9 +15000,13 @@ occaFunction inline double8  operator +  (const double &a, const double8 &b){
                       a + b.s5,
                       a + b.s6,
                       a + b.s7);
+#endif
 }
 
 occaFunction inline double8  operator +  (const double8 &a, const double &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_DOUBLE8(a.reg + b);
+#else
   return OCCA_DOUBLE8(a.x + b,
                       a.y + b,
                       a.z + b,
@@ -11286,9 +15015,13 @@ occaFunction inline double8  operator +  (const double8 &a, const double &b){
                       a.s5 + b,
                       a.s6 + b,
                       a.s7 + b);
+#endif
 }
 
 occaFunction inline double8& operator += (      double8 &a, const double8 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.reg += b.reg;
+#else
   a.x += b.x;
   a.y += b.y;
   a.z += b.z;
@@ -11297,10 +15030,14 @@ occaFunction inline double8& operator += (      double8 &a, const double8 &b){
   a.s5 += b.s5;
   a.s6 += b.s6;
   a.s7 += b.s7;
+#endif
   return a;
 }
 
 occaFunction inline double8& operator += (      double8 &a, const double &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.reg += b;
+#else
   a.x += b;
   a.y += b;
   a.z += b;
@@ -11309,9 +15046,13 @@ occaFunction inline double8& operator += (      double8 &a, const double &b){
   a.s5 += b;
   a.s6 += b;
   a.s7 += b;
+#endif
   return a;
 }
 occaFunction inline double8  operator -  (const double8 &a, const double8 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_DOUBLE8(a.reg - b.reg);
+#else
   return OCCA_DOUBLE8(a.x - b.x,
                       a.y - b.y,
                       a.z - b.z,
@@ -11320,9 +15061,13 @@ occaFunction inline double8  operator -  (const double8 &a, const double8 &b){
                       a.s5 - b.s5,
                       a.s6 - b.s6,
                       a.s7 - b.s7);
+#endif
 }
 
 occaFunction inline double8  operator -  (const double &a, const double8 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_DOUBLE8(a - b.reg);
+#else
   return OCCA_DOUBLE8(a - b.x,
                       a - b.y,
                       a - b.z,
@@ -11331,9 +15076,13 @@ occaFunction inline double8  operator -  (const double &a, const double8 &b){
                       a - b.s5,
                       a - b.s6,
                       a - b.s7);
+#endif
 }
 
 occaFunction inline double8  operator -  (const double8 &a, const double &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_DOUBLE8(a.reg - b);
+#else
   return OCCA_DOUBLE8(a.x - b,
                       a.y - b,
                       a.z - b,
@@ -11342,9 +15091,13 @@ occaFunction inline double8  operator -  (const double8 &a, const double &b){
                       a.s5 - b,
                       a.s6 - b,
                       a.s7 - b);
+#endif
 }
 
 occaFunction inline double8& operator -= (      double8 &a, const double8 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.reg -= b.reg;
+#else
   a.x -= b.x;
   a.y -= b.y;
   a.z -= b.z;
@@ -11353,10 +15106,14 @@ occaFunction inline double8& operator -= (      double8 &a, const double8 &b){
   a.s5 -= b.s5;
   a.s6 -= b.s6;
   a.s7 -= b.s7;
+#endif
   return a;
 }
 
 occaFunction inline double8& operator -= (      double8 &a, const double &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.reg -= b;
+#else
   a.x -= b;
   a.y -= b;
   a.z -= b;
@@ -11365,9 +15122,13 @@ occaFunction inline double8& operator -= (      double8 &a, const double &b){
   a.s5 -= b;
   a.s6 -= b;
   a.s7 -= b;
+#endif
   return a;
 }
 occaFunction inline double8  operator *  (const double8 &a, const double8 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_DOUBLE8(a.reg * b.reg);
+#else
   return OCCA_DOUBLE8(a.x * b.x,
                       a.y * b.y,
                       a.z * b.z,
@@ -11376,9 +15137,13 @@ occaFunction inline double8  operator *  (const double8 &a, const double8 &b){
                       a.s5 * b.s5,
                       a.s6 * b.s6,
                       a.s7 * b.s7);
+#endif
 }
 
 occaFunction inline double8  operator *  (const double &a, const double8 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_DOUBLE8(a * b.reg);
+#else
   return OCCA_DOUBLE8(a * b.x,
                       a * b.y,
                       a * b.z,
@@ -11387,9 +15152,13 @@ occaFunction inline double8  operator *  (const double &a, const double8 &b){
                       a * b.s5,
                       a * b.s6,
                       a * b.s7);
+#endif
 }
 
 occaFunction inline double8  operator *  (const double8 &a, const double &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_DOUBLE8(a.reg * b);
+#else
   return OCCA_DOUBLE8(a.x * b,
                       a.y * b,
                       a.z * b,
@@ -11398,9 +15167,13 @@ occaFunction inline double8  operator *  (const double8 &a, const double &b){
                       a.s5 * b,
                       a.s6 * b,
                       a.s7 * b);
+#endif
 }
 
 occaFunction inline double8& operator *= (      double8 &a, const double8 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.reg *= b.reg;
+#else
   a.x *= b.x;
   a.y *= b.y;
   a.z *= b.z;
@@ -11409,10 +15182,14 @@ occaFunction inline double8& operator *= (      double8 &a, const double8 &b){
   a.s5 *= b.s5;
   a.s6 *= b.s6;
   a.s7 *= b.s7;
+#endif
   return a;
 }
 
 occaFunction inline double8& operator *= (      double8 &a, const double &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.reg *= b;
+#else
   a.x *= b;
   a.y *= b;
   a.z *= b;
@@ -11421,9 +15198,13 @@ occaFunction inline double8& operator *= (      double8 &a, const double &b){
   a.s5 *= b;
   a.s6 *= b;
   a.s7 *= b;
+#endif
   return a;
 }
 occaFunction inline double8  operator /  (const double8 &a, const double8 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_DOUBLE8(a.reg / b.reg);
+#else
   return OCCA_DOUBLE8(a.x / b.x,
                       a.y / b.y,
                       a.z / b.z,
@@ -11432,9 +15213,13 @@ occaFunction inline double8  operator /  (const double8 &a, const double8 &b){
                       a.s5 / b.s5,
                       a.s6 / b.s6,
                       a.s7 / b.s7);
+#endif
 }
 
 occaFunction inline double8  operator /  (const double &a, const double8 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_DOUBLE8(a / b.reg);
+#else
   return OCCA_DOUBLE8(a / b.x,
                       a / b.y,
                       a / b.z,
@@ -11443,9 +15228,13 @@ occaFunction inline double8  operator /  (const double &a, const double8 &b){
                       a / b.s5,
                       a / b.s6,
                       a / b.s7);
+#endif
 }
 
 occaFunction inline double8  operator /  (const double8 &a, const double &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_DOUBLE8(a.reg / b);
+#else
   return OCCA_DOUBLE8(a.x / b,
                       a.y / b,
                       a.z / b,
@@ -11454,9 +15243,13 @@ occaFunction inline double8  operator /  (const double8 &a, const double &b){
                       a.s5 / b,
                       a.s6 / b,
                       a.s7 / b);
+#endif
 }
 
 occaFunction inline double8& operator /= (      double8 &a, const double8 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.reg /= b.reg;
+#else
   a.x /= b.x;
   a.y /= b.y;
   a.z /= b.z;
@@ -11465,10 +15258,14 @@ occaFunction inline double8& operator /= (      double8 &a, const double8 &b){
   a.s5 /= b.s5;
   a.s6 /= b.s6;
   a.s7 /= b.s7;
+#endif
   return a;
 }
 
 occaFunction inline double8& operator /= (      double8 &a, const double &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.reg /= b;
+#else
   a.x /= b;
   a.y /= b;
   a.z /= b;
@@ -11477,6 +15274,7 @@ occaFunction inline double8& operator /= (      double8 &a, const double &b){
   a.s5 /= b;
   a.s6 /= b;
   a.s7 /= b;
+#endif
   return a;
 }
 
@@ -11501,8 +15299,16 @@ inline std::ostream& operator << (std::ostream &out, const double8& a){
 
 //---[ double16 ]-----------------------
 #define OCCA_DOUBLE16 double16
+#if OCCA_VECTOR_EXTENSIONS
+typedef OCCA_VECTOR_EXT_TYPE(double, 16) occaVector_double16;
+#endif
 class double16{
 public:
+#if OCCA_VECTOR_EXTENSIONS
+  union {
+    occaVector_double16 reg;
+    struct {
+#endif
   union { double s0, x; };
   union { double s1, y; };
   union { double s2, z; };
@@ -11519,7 +15325,186 @@ public:
   double s13;
   double s14;
   double s15;
+#if OCCA_VECTOR_EXTENSIONS
+    };
+  };
+#endif
+
+#if OCCA_VECTOR_EXTENSIONS
+  inline occaFunction double16(const occaVector_double16 &reg_) : 
+    reg(reg_) {}
+
+  inline occaFunction double16() : 
+    reg((occaVector_double16) {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}) {}
+
+  inline occaFunction double16(const double &x_) : 
+    reg((occaVector_double16) {x_, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}) {}
+
+  inline occaFunction double16(const double &x_,
+                               const double &y_) : 
+    reg((occaVector_double16) {x_, y_, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}) {}
+
+  inline occaFunction double16(const double &x_,
+                               const double &y_,
+                               const double &z_) : 
+    reg((occaVector_double16) {x_, y_, z_, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}) {}
+
+  inline occaFunction double16(const double &x_,
+                               const double &y_,
+                               const double &z_,
+                               const double &w_) : 
+    reg((occaVector_double16) {x_, y_, z_, w_, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}) {}
+
+  inline occaFunction double16(const double &x_,
+                               const double &y_,
+                               const double &z_,
+                               const double &w_,
+                               const double &s4_) : 
+    reg((occaVector_double16) {x_, y_, z_, w_, s4_, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}) {}
+
+  inline occaFunction double16(const double &x_,
+                               const double &y_,
+                               const double &z_,
+                               const double &w_,
+                               const double &s4_,
+                               const double &s5_) : 
+    reg((occaVector_double16) {x_, y_, z_, w_, s4_, s5_, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}) {}
+
+  inline occaFunction double16(const double &x_,
+                               const double &y_,
+                               const double &z_,
+                               const double &w_,
+                               const double &s4_,
+                               const double &s5_,
+                               const double &s6_) : 
+    reg((occaVector_double16) {x_, y_, z_, w_, s4_, s5_, s6_, 0, 0, 0, 0, 0, 0, 0, 0, 0}) {}
+
+  inline occaFunction double16(const double &x_,
+                               const double &y_,
+                               const double &z_,
+                               const double &w_,
+                               const double &s4_,
+                               const double &s5_,
+                               const double &s6_,
+                               const double &s7_) : 
+    reg((occaVector_double16) {x_, y_, z_, w_, s4_, s5_, s6_, s7_, 0, 0, 0, 0, 0, 0, 0, 0}) {}
+
+  inline occaFunction double16(const double &x_,
+                               const double &y_,
+                               const double &z_,
+                               const double &w_,
+                               const double &s4_,
+                               const double &s5_,
+                               const double &s6_,
+                               const double &s7_,
+                               const double &s8_) : 
+    reg((occaVector_double16) {x_, y_, z_, w_, s4_, s5_, s6_, s7_, s8_, 0, 0, 0, 0, 0, 0, 0}) {}
+
+  inline occaFunction double16(const double &x_,
+                               const double &y_,
+                               const double &z_,
+                               const double &w_,
+                               const double &s4_,
+                               const double &s5_,
+                               const double &s6_,
+                               const double &s7_,
+                               const double &s8_,
+                               const double &s9_) : 
+    reg((occaVector_double16) {x_, y_, z_, w_, s4_, s5_, s6_, s7_, s8_, s9_, 0, 0, 0, 0, 0, 0}) {}
+
+  inline occaFunction double16(const double &x_,
+                               const double &y_,
+                               const double &z_,
+                               const double &w_,
+                               const double &s4_,
+                               const double &s5_,
+                               const double &s6_,
+                               const double &s7_,
+                               const double &s8_,
+                               const double &s9_,
+                               const double &s10_) : 
+    reg((occaVector_double16) {x_, y_, z_, w_, s4_, s5_, s6_, s7_, s8_, s9_, s10_, 0, 0, 0, 0, 0}) {}
+
+  inline occaFunction double16(const double &x_,
+                               const double &y_,
+                               const double &z_,
+                               const double &w_,
+                               const double &s4_,
+                               const double &s5_,
+                               const double &s6_,
+                               const double &s7_,
+                               const double &s8_,
+                               const double &s9_,
+                               const double &s10_,
+                               const double &s11_) : 
+    reg((occaVector_double16) {x_, y_, z_, w_, s4_, s5_, s6_, s7_, s8_, s9_, s10_, s11_, 0, 0, 0, 0}) {}
+
+  inline occaFunction double16(const double &x_,
+                               const double &y_,
+                               const double &z_,
+                               const double &w_,
+                               const double &s4_,
+                               const double &s5_,
+                               const double &s6_,
+                               const double &s7_,
+                               const double &s8_,
+                               const double &s9_,
+                               const double &s10_,
+                               const double &s11_,
+                               const double &s12_) : 
+    reg((occaVector_double16) {x_, y_, z_, w_, s4_, s5_, s6_, s7_, s8_, s9_, s10_, s11_, s12_, 0, 0, 0}) {}
+
+  inline occaFunction double16(const double &x_,
+                               const double &y_,
+                               const double &z_,
+                               const double &w_,
+                               const double &s4_,
+                               const double &s5_,
+                               const double &s6_,
+                               const double &s7_,
+                               const double &s8_,
+                               const double &s9_,
+                               const double &s10_,
+                               const double &s11_,
+                               const double &s12_,
+                               const double &s13_) : 
+    reg((occaVector_double16) {x_, y_, z_, w_, s4_, s5_, s6_, s7_, s8_, s9_, s10_, s11_, s12_, s13_, 0, 0}) {}
+
+  inline occaFunction double16(const double &x_,
+                               const double &y_,
+                               const double &z_,
+                               const double &w_,
+                               const double &s4_,
+                               const double &s5_,
+                               const double &s6_,
+                               const double &s7_,
+                               const double &s8_,
+                               const double &s9_,
+                               const double &s10_,
+                               const double &s11_,
+                               const double &s12_,
+                               const double &s13_,
+                               const double &s14_) : 
+    reg((occaVector_double16) {x_, y_, z_, w_, s4_, s5_, s6_, s7_, s8_, s9_, s10_, s11_, s12_, s13_, s14_, 0}) {}
 
+  inline occaFunction double16(const double &x_,
+                               const double &y_,
+                               const double &z_,
+                               const double &w_,
+                               const double &s4_,
+                               const double &s5_,
+                               const double &s6_,
+                               const double &s7_,
+                               const double &s8_,
+                               const double &s9_,
+                               const double &s10_,
+                               const double &s11_,
+                               const double &s12_,
+                               const double &s13_,
+                               const double &s14_,
+                               const double &s15_) : 
+    reg((occaVector_double16) {x_, y_, z_, w_, s4_, s5_, s6_, s7_, s8_, s9_, s10_, s11_, s12_, s13_, s14_, s15_}) {}
+#else
   inline occaFunction double16() : 
     x(0),
     y(0),
@@ -11945,9 +15930,13 @@ public:
     s13(s13_),
     s14(s14_),
     s15(s15_) {}
+#endif
 };
 
 occaFunction inline double16 operator + (const double16 &a){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_DOUBLE16(+a.reg);
+#else
   return OCCA_DOUBLE16(+a.x,
                        +a.y,
                        +a.z,
@@ -11964,8 +15953,12 @@ occaFunction inline double16 operator + (const double16 &a){
                        +a.s13,
                        +a.s14,
                        +a.s15);
+#endif
 }
 occaFunction inline double16 operator - (const double16 &a){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_DOUBLE16(-a.reg);
+#else
   return OCCA_DOUBLE16(-a.x,
                        -a.y,
                        -a.z,
@@ -11982,8 +15975,12 @@ occaFunction inline double16 operator - (const double16 &a){
                        -a.s13,
                        -a.s14,
                        -a.s15);
+#endif
 }
 occaFunction inline double16  operator +  (const double16 &a, const double16 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_DOUBLE16(a.reg + b.reg);
+#else
   return OCCA_DOUBLE16(a.x + b.x,
                        a.y + b.y,
                        a.z + b.z,
@@ -12000,9 +15997,13 @@ occaFunction inline double16  operator +  (const double16 &a, const double16 &b)
                        a.s13 + b.s13,
                        a.s14 + b.s14,
                        a.s15 + b.s15);
+#endif
 }
 
 occaFunction inline double16  operator +  (const double &a, const double16 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_DOUBLE16(a + b.reg);
+#else
   return OCCA_DOUBLE16(a + b.x,
                        a + b.y,
                        a + b.z,
@@ -12019,9 +16020,13 @@ occaFunction inline double16  operator +  (const double &a, const double16 &b){
                        a + b.s13,
                        a + b.s14,
                        a + b.s15);
+#endif
 }
 
 occaFunction inline double16  operator +  (const double16 &a, const double &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_DOUBLE16(a.reg + b);
+#else
   return OCCA_DOUBLE16(a.x + b,
                        a.y + b,
                        a.z + b,
@@ -12038,9 +16043,13 @@ occaFunction inline double16  operator +  (const double16 &a, const double &b){
                        a.s13 + b,
                        a.s14 + b,
                        a.s15 + b);
+#endif
 }
 
 occaFunction inline double16& operator += (      double16 &a, const double16 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.reg += b.reg;
+#else
   a.x += b.x;
   a.y += b.y;
   a.z += b.z;
@@ -12057,10 +16066,14 @@ occaFunction inline double16& operator += (      double16 &a, const double16 &b)
   a.s13 += b.s13;
   a.s14 += b.s14;
   a.s15 += b.s15;
+#endif
   return a;
 }
 
 occaFunction inline double16& operator += (      double16 &a, const double &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.reg += b;
+#else
   a.x += b;
   a.y += b;
   a.z += b;
@@ -12077,9 +16090,13 @@ occaFunction inline double16& operator += (      double16 &a, const double &b){
   a.s13 += b;
   a.s14 += b;
   a.s15 += b;
+#endif
   return a;
 }
 occaFunction inline double16  operator -  (const double16 &a, const double16 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_DOUBLE16(a.reg - b.reg);
+#else
   return OCCA_DOUBLE16(a.x - b.x,
                        a.y - b.y,
                        a.z - b.z,
@@ -12096,9 +16113,13 @@ occaFunction inline double16  operator -  (const double16 &a, const double16 &b)
                        a.s13 - b.s13,
                        a.s14 - b.s14,
                        a.s15 - b.s15);
+#endif
 }
 
 occaFunction inline double16  operator -  (const double &a, const double16 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_DOUBLE16(a - b.reg);
+#else
   return OCCA_DOUBLE16(a - b.x,
                        a - b.y,
                        a - b.z,
@@ -12115,9 +16136,13 @@ occaFunction inline double16  operator -  (const double &a, const double16 &b){
                        a - b.s13,
                        a - b.s14,
                        a - b.s15);
+#endif
 }
 
 occaFunction inline double16  operator -  (const double16 &a, const double &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_DOUBLE16(a.reg - b);
+#else
   return OCCA_DOUBLE16(a.x - b,
                        a.y - b,
                        a.z - b,
@@ -12134,9 +16159,13 @@ occaFunction inline double16  operator -  (const double16 &a, const double &b){
                        a.s13 - b,
                        a.s14 - b,
                        a.s15 - b);
+#endif
 }
 
 occaFunction inline double16& operator -= (      double16 &a, const double16 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.reg -= b.reg;
+#else
   a.x -= b.x;
   a.y -= b.y;
   a.z -= b.z;
@@ -12153,10 +16182,14 @@ occaFunction inline double16& operator -= (      double16 &a, const double16 &b)
   a.s13 -= b.s13;
   a.s14 -= b.s14;
   a.s15 -= b.s15;
+#endif
   return a;
 }
 
 occaFunction inline double16& operator -= (      double16 &a, const double &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.reg -= b;
+#else
   a.x -= b;
   a.y -= b;
   a.z -= b;
@@ -12173,9 +16206,13 @@ occaFunction inline double16& operator -= (      double16 &a, const double &b){
   a.s13 -= b;
   a.s14 -= b;
   a.s15 -= b;
+#endif
   return a;
 }
 occaFunction inline double16  operator *  (const double16 &a, const double16 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_DOUBLE16(a.reg * b.reg);
+#else
   return OCCA_DOUBLE16(a.x * b.x,
                        a.y * b.y,
                        a.z * b.z,
@@ -12192,9 +16229,13 @@ occaFunction inline double16  operator *  (const double16 &a, const double16 &b)
                        a.s13 * b.s13,
                        a.s14 * b.s14,
                        a.s15 * b.s15);
+#endif
 }
 
 occaFunction inline double16  operator *  (const double &a, const double16 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_DOUBLE16(a * b.reg);
+#else
   return OCCA_DOUBLE16(a * b.x,
                        a * b.y,
                        a * b.z,
@@ -12211,9 +16252,13 @@ occaFunction inline double16  operator *  (const double &a, const double16 &b){
                        a * b.s13,
                        a * b.s14,
                        a * b.s15);
+#endif
 }
 
 occaFunction inline double16  operator *  (const double16 &a, const double &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_DOUBLE16(a.reg * b);
+#else
   return OCCA_DOUBLE16(a.x * b,
                        a.y * b,
                        a.z * b,
@@ -12230,9 +16275,13 @@ occaFunction inline double16  operator *  (const double16 &a, const double &b){
                        a.s13 * b,
                        a.s14 * b,
                        a.s15 * b);
+#endif
 }
 
 occaFunction inline double16& operator *= (      double16 &a, const double16 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.reg *= b.reg;
+#else
   a.x *= b.x;
   a.y *= b.y;
   a.z *= b.z;
@@ -12249,10 +16298,14 @@ occaFunction inline double16& operator *= (      double16 &a, const double16 &b)
   a.s13 *= b.s13;
   a.s14 *= b.s14;
   a.s15 *= b.s15;
+#endif
   return a;
 }
 
 occaFunction inline double16& operator *= (      double16 &a, const double &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.reg *= b;
+#else
   a.x *= b;
   a.y *= b;
   a.z *= b;
@@ -12269,9 +16322,13 @@ occaFunction inline double16& operator *= (      double16 &a, const double &b){
   a.s13 *= b;
   a.s14 *= b;
   a.s15 *= b;
+#endif
   return a;
 }
 occaFunction inline double16  operator /  (const double16 &a, const double16 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_DOUBLE16(a.reg / b.reg);
+#else
   return OCCA_DOUBLE16(a.x / b.x,
                        a.y / b.y,
                        a.z / b.z,
@@ -12288,9 +16345,13 @@ occaFunction inline double16  operator /  (const double16 &a, const double16 &b)
                        a.s13 / b.s13,
                        a.s14 / b.s14,
                        a.s15 / b.s15);
+#endif
 }
 
 occaFunction inline double16  operator /  (const double &a, const double16 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_DOUBLE16(a / b.reg);
+#else
   return OCCA_DOUBLE16(a / b.x,
                        a / b.y,
                        a / b.z,
@@ -12307,9 +16368,13 @@ occaFunction inline double16  operator /  (const double &a, const double16 &b){
                        a / b.s13,
                        a / b.s14,
                        a / b.s15);
+#endif
 }
 
 occaFunction inline double16  operator /  (const double16 &a, const double &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return OCCA_DOUBLE16(a.reg / b);
+#else
   return OCCA_DOUBLE16(a.x / b,
                        a.y / b,
                        a.z / b,
@@ -12326,9 +16391,13 @@ occaFunction inline double16  operator /  (const double16 &a, const double &b){
                        a.s13 / b,
                        a.s14 / b,
                        a.s15 / b);
+#endif
 }
 
 occaFunction inline double16& operator /= (      double16 &a, const double16 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.reg /= b.reg;
+#else
   a.x /= b.x;
   a.y /= b.y;
   a.z /= b.z;
@@ -12345,10 +16414,14 @@ occaFunction inline double16& operator /= (      double16 &a, const double16 &b)
   a.s13 /= b.s13;
   a.s14 /= b.s14;
   a.s15 /= b.s15;
+#endif
   return a;
 }
 
 occaFunction inline double16& operator /= (      double16 &a, const double &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.reg /= b;
+#else
   a.x /= b;
   a.y /= b;
   a.z /= b;
@@ -12365,6 +16438,7 @@ occaFunction inline double16& operator /= (      double16 &a, const double &b){
   a.s13 /= b;
   a.s14 /= b;
   a.s15 /= b;
+#endif
   return a;
 }
 
@@ -26,6 +26,11 @@ namespace occa {
   }
 
   namespace library {
+    // Bundles start with [magic], then [version] and the parser version
+    //   their kernels were built with
+    extern const char magic[8];
+    extern const uint32_t version;
+
     class infoID_t {
     public:
       int modelID;
@@ -56,6 +61,13 @@ namespace occa {
       uint64_t kernelNameOffset, kernelNameBytes;
     };
 
+    // Loaded bundles stay mapped, kernels are read from them in place
+    class mappedFile_t {
+    public:
+      const char *ptr;
+      uint64_t bytes;
+    };
+
     typedef std::map<infoID_t,infoHeader_t> headerMap_t;
     typedef headerMap_t::iterator           headerMapIterator;
     typedef headerMap_t::const_iterator     cHeaderMapIterator;
@@ -68,21 +80,31 @@ namespace occa {
     typedef deviceModelMap_t::iterator       deviceModelMapIterator;
     typedef deviceModelMap_t::const_iterator cDeviceMapIterator;
 
+    typedef std::map<int,mappedFile_t>   mappedFileMap_t;
+    typedef mappedFileMap_t::iterator    mappedFileMapIterator;
+
     extern mutex_t headerMutex, kernelMutex;
     extern mutex_t deviceIDMutex, deviceModelMutex;
-    extern mutex_t scratchMutex;
+    extern mutex_t scratchMutex, fileMutex;
 
     extern headerMap_t headerMap;
     extern kernelMap_t kernelMap;
 
     extern deviceModelMap_t deviceModelMap;
 
+    extern mappedFileMap_t mappedFiles;
+
     extern std::string scratchPad;
 
     extern int currentDeviceID;
 
     size_t addToScratchPad(const std::string &s);
 
+    const mappedFile_t& mapFile(const int fileID);
+
+    // Where [h]'s offsets point to, the scratch pad or a loaded bundle
+    const char* getContents(const infoHeader_t &h);
+
     void load(const std::string &filename);
     void save(const std::string &filename);
 
@@ -95,6 +117,23 @@ namespace occa {
 
     occa::kernel loadKernel(occa::device_v *dHandle,
                             const std::string &kernelName);
+
+    //---[ CPU Modes ]------------------
+    // Kernel contents for Serial, OpenMP and Pthreads:
+    //   [uint64 bytes][shared object]  holds the kernel (or its nested kernels)
+    //   [uint64 bytes][shared object]  holds the launch kernel, empty if not parsed
+    //   parsedKernelInfo
+    void cacheCpuKernel(occa::device_v *dHandle,
+                        const std::string &filename,
+                        const std::string &functionName,
+                        const kernelInfo &info);
+
+    // Fails if the parts do not fit in [contentBytes]
+    occa::kernel loadCpuKernel(occa::device_v *dHandle,
+                               const char *contents,
+                               const uint64_t contentBytes,
+                               const std::string &kernelName);
+    //==================================
   }
 }
 
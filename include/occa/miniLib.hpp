@@ -1,3 +1,6 @@
+#ifndef OCCA_MINILIB_HEADER
+#define OCCA_MINILIB_HEADER
+
 #include "occa/base.hpp"
 
 namespace occa {
@@ -29,4 +32,76 @@ namespace occa {
 
   template <>
   void memset<double>(void *ptr, const double &value, uintptr_t count);
+
+  //---[ Reductions ]-----------------------------
+  // Operators are expressions of [a] and [b], reduce() also needs them
+  //   to be commutative since partials are combined in any order
+  namespace binaryOp {
+    static const std::string sum = "a + b";
+    static const std::string min = "((b < a) ? b : a)";
+    static const std::string max = "((a < b) ? b : a)";
+  }
+
+  template <class TM>
+  inline std::string reductionType() {
+    OCCA_CHECK(false,
+               "Reductions are only implemented for POD-type data (char, short, int, long, float, double)");
+    return "";
+  }
+
+  template <> inline std::string reductionType<char>()   { return "char";   }
+  template <> inline std::string reductionType<short>()  { return "short";  }
+  template <> inline std::string reductionType<int>()    { return "int";    }
+  template <> inline std::string reductionType<long>()   { return "long";   }
+  template <> inline std::string reductionType<float>()  { return "float";  }
+  template <> inline std::string reductionType<double>() { return "double"; }
+
+  // Reduces the first [entries] values of [in] into out[0]
+  void reduce(memory in, memory out,
+              const uintptr_t entries,
+              const std::string &type,
+              const std::string &op);
+
+  namespace reduction {
+    // Frees the kernels cached for [deviceID], called by device::free()
+    void forgetDevice(const int deviceID);
+  }
+
+  // Inclusive scan, [in] and [out] can be the same memory
+  void scan(memory in, memory out,
+            const uintptr_t entries,
+            const std::string &type,
+            const std::string &op);
+
+  template <class TM>
+  TM reduce(memory in,
+            const std::string &op,
+            uintptr_t entries = 0) {
+    if(entries == 0)
+      entries = (in.bytes() / sizeof(TM));
+
+    occa::device device(in.getDHandle());
+    occa::memory out = device.malloc(sizeof(TM));
+
+    reduce(in, out, entries, reductionType<TM>(), op);
+
+    TM ret;
+    out.copyTo(&ret, sizeof(TM));
+    out.free();
+
+    return ret;
+  }
+
+  template <class TM>
+  void scan(memory in, memory out,
+            const std::string &op,
+            uintptr_t entries = 0) {
+    if(entries == 0)
+      entries = (in.bytes() / sizeof(TM));
+
+    scan(in, out, entries, reductionType<TM>(), op);
+  }
+  //==============================================
 }
+
+#endif
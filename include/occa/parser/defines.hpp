@@ -7,6 +7,7 @@
 #include <vector>
 #include <stack>
 #include <map>
+#include <set>
 
 #include <string.h>
 #include <stdlib.h>
@@ -203,6 +204,51 @@ namespace occa {
     static const info_t insideCommentBlock   = 1;
     static const info_t finishedCommentBlock = 2;
     //==============================================
+
+
+    //---[ Parse Arena ]----------------------------
+    // Bump allocator for one parse's AST, released in one shot.
+    //   Deleted nodes go on per-size free lists since the parser
+    //   keeps creating and dropping temporary nodes, large leaf
+    //   arrays are regrown often and go back to the heap instead
+    class parseArena_t {
+    public:
+      std::vector<char*> blocks;
+      char *pos, *end;
+
+      std::vector<void*> freeLists;
+      std::set<void*> largeAllocs;
+
+      uintptr_t usedBytes, peakBytes, reservedBytes;
+
+      parseArena_t();
+      ~parseArena_t();
+
+      void* alloc(uintptr_t bytes);
+      void release(void *ptr, const uintptr_t bytes);
+
+    private:
+      parseArena_t(const parseArena_t &);
+      parseArena_t& operator = (const parseArena_t &);
+    };
+
+    // Set while a parser runs, nodes made outside a parse use the heap
+    extern parseArena_t *activeArena;
+
+    // Used by the AST classes' operator new/delete, deleting a node
+    //   that lives in an arena is a no-op
+    void* arenaNew(const size_t bytes);
+    void arenaDelete(void *ptr);
+
+#define OCCA_PARSER_ARENA_ALLOCATED                                   \
+    inline void* operator new(size_t bytes) {                         \
+      return ::occa::parserNS::arenaNew(bytes);                       \
+    }                                                                 \
+                                                                      \
+    inline void operator delete(void *ptr) {                          \
+      ::occa::parserNS::arenaDelete(ptr);                             \
+    }
+    //==============================================
   }
 }
 
@@ -12,6 +12,8 @@ namespace occa {
       node *left, *right, *up, *down;
       TM value;
 
+      OCCA_PARSER_ARENA_ALLOCATED
+
       node();
       node(const TM &t);
       node(const node<TM> &n);
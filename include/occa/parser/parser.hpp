@@ -24,6 +24,11 @@ namespace occa {
 
     class parserBase {
     public:
+      // Holds the AST, declared first so it outlives every member
+      //   that points into it
+      parseArena_t arena;
+      double parseTime;
+
       std::string filename;
 
       int parsingLanguage;
@@ -40,6 +45,8 @@ namespace occa {
       bool _warnForMissingBarriers;
       bool _warnForConditionalBarriers;
       bool _insertBarriersAutomatically;
+      bool _addSimdHints;
+      bool _localizeExclusives;
       //================================
 
       varOriginMap_t varOriginMap;
@@ -71,6 +78,8 @@ namespace occa {
       bool warnForMissingBarriers();
       bool warnForConditionalBarriers();
       bool insertBarriersAutomatically();
+      bool addSimdHints();
+      bool localizeExclusives();
       //================================
 
       //---[ Macro Parser Functions ]---
@@ -160,6 +169,14 @@ namespace occa {
 
       void labelNativeKernels();
 
+      void specializeKernelArguments();
+      std::string specializedArgValue(varInfo &arg,
+                                      const std::string &hexValue);
+      bool statementWritesVar(statement &s, varInfo &var);
+      bool expWritesVar(expNode &e, varInfo &var);
+      void setVarToValue(statement &s, varInfo &var, const std::string &value);
+      void setVarToValue(expNode &e, varInfo &var, const std::string &value);
+
       void setupCudaVariables(statement &s);
 
       void addFunctionPrototypes();
@@ -182,6 +199,14 @@ namespace occa {
                                                statementNode *snTail,
                                                bool isAppending = false);
 
+      void localizeExclusiveVariables(statement &s);
+      void findInnerLoopUsing(statement &sOuter,
+                              statement &s,
+                              statement &sDecl,
+                              statement *&sInner,
+                              bool &localizable);
+      bool expUsesVar(expNode &e, varInfo &var);
+
       void modifyExclusiveVariables(statement &s);
 
       void modifyTextureVariables();
@@ -238,6 +263,38 @@ namespace occa {
       void addNestedKernelArgTo(statement &sKernel);
       //   =============================
 
+      //   ---[ SIMD Hints ]------------
+      void addSimdHintsTo(statement &sKernel,
+                          statement &newSKernel,
+                          statement &omLoop);
+
+      bool innerLoopIsVectorizable(statement &s,
+                                   strToBoolMap_t &localVars,
+                                   strToBoolMap_t &innerVars,
+                                   const int seqDepth = 0);
+
+      bool expIsVectorizable(expNode &e,
+                             strToBoolMap_t &localVars,
+                             strToBoolMap_t &innerVars,
+                             const int seqDepth);
+
+      bool expUsesVars(expNode &e, strToBoolMap_t &vars);
+
+      void findWrittenArgs(statement &s,
+                           strToBoolMap_t &pointerArgs,
+                           strToBoolMap_t &writtenArgs,
+                           bool &argsMayAlias,
+                           const int seqDepth = 0);
+
+      void findArgAccesses(expNode &e,
+                           strToBoolMap_t &pointerArgs,
+                           strToBoolMap_t &readArgs,
+                           strToBoolMap_t &writtenArgs,
+                           bool &argsMayAlias);
+
+      void alignSharedArrays(statement &s);
+      //   =============================
+
       static int getKernelOuterDim(statement &s);
       static int getKernelInnerDim(statement &s);
       static int getKernelDimFor(statement &s, const std::string &tag);
@@ -93,6 +93,15 @@ namespace occa {
       static const info_t printSubStatements = (1 << 0);
     }
 
+    // Leaf arrays share the AST's arena
+    inline expNode** newLeafArray(const int count) {
+      return (expNode**) arenaNew(count * sizeof(expNode*));
+    }
+
+    inline void freeLeafArray(expNode **leaves) {
+      arenaDelete(leaves);
+    }
+
     class expNode {
     public:
       statement *sInfo;
@@ -105,6 +114,8 @@ namespace occa {
       int leafCount;
       expNode **leaves;
 
+      OCCA_PARSER_ARENA_ALLOCATED
+
       expNode();
       expNode(const char *c);
       expNode(const std::string &str);
@@ -520,6 +531,8 @@ namespace occa {
 
       attributeMap_t attributeMap;
 
+      OCCA_PARSER_ARENA_ALLOCATED
+
       statement(parserBase &pb);
       statement(const statement &s);
 
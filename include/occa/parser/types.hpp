@@ -249,6 +249,8 @@ namespace occa {
 
       opOverloadMaps_t opOverloadMaps;
 
+      OCCA_PARSER_ARENA_ALLOCATED
+
       typeInfo();
 
       typeInfo(const typeInfo &type);
@@ -374,6 +376,8 @@ namespace occa {
       int functionNestCount;
       varInfo *functionNests;
 
+      OCCA_PARSER_ARENA_ALLOCATED
+
       varInfo();
 
       varInfo(const varInfo &var);
@@ -162,6 +162,9 @@ static PyObject* py_occaMemoryGetMemoryHandle(PyObject *self, PyObject *args);
 static PyObject* py_occaMemoryGetMappedPointer(PyObject *self, PyObject *args);
 static PyObject* py_occaMemoryGetTextureHandle(PyObject *self, PyObject *args);
 
+static PyObject* py_occaMemoryBytes(PyObject *self, PyObject *args);
+static PyObject* py_occaMemoryHostPointer(PyObject *self, PyObject *args);
+
 static PyObject* py_occaMemcpy(PyObject *self, PyObject *args);
 static PyObject* py_occaAsyncMemcpy(PyObject *self, PyObject *args);
 
@@ -174,6 +177,7 @@ static PyObject* py_occaAsyncCopyPtrToMem(PyObject *self, PyObject *args);
 static PyObject* py_occaAsyncCopyMemToPtr(PyObject *self, PyObject *args);
 
 static PyObject* py_occaMemoryFree(PyObject *self, PyObject *args);
+static PyObject* py_occaMemoryDetach(PyObject *self, PyObject *args);
 //======================================
 
 // Init stuff
@@ -323,6 +327,9 @@ static PyMethodDef _C_occaMethods[] = {
   {"memoryGetMappedPointer", py_occaMemoryGetMappedPointer, METH_VARARGS},
   {"memoryGetTextureHandle", py_occaMemoryGetTextureHandle, METH_VARARGS},
 
+  {"memoryBytes"      , py_occaMemoryBytes      , METH_VARARGS},
+  {"memoryHostPointer", py_occaMemoryHostPointer, METH_VARARGS},
+
   {"memcpy"     , py_occaMemcpy     , METH_VARARGS},
   {"asyncMemcpy", py_occaAsyncMemcpy, METH_VARARGS},
 
@@ -334,14 +341,15 @@ static PyMethodDef _C_occaMethods[] = {
   {"asyncCopyPtrToMem", py_occaAsyncCopyPtrToMem, METH_VARARGS},
   {"asyncCopyMemToPtr", py_occaAsyncCopyMemToPtr, METH_VARARGS},
 
-  {"memoryFree", py_occaMemoryFree, METH_VARARGS}
+  {"memoryFree"  , py_occaMemoryFree  , METH_VARARGS},
+  {"memoryDetach", py_occaMemoryDetach, METH_VARARGS}
   //====================================
 };
 
 #if OCCA_PY == 3
-static struct PyModuleDef _occaModule = { PyModuleDef_HEAD_INIT, "occa", NULL, -1, _C_occaMethods };
+static struct PyModuleDef _occaModule = { PyModuleDef_HEAD_INIT, "_C_occa", NULL, -1, _C_occaMethods };
 
-PyMODINIT_FUNC init_C_occa(){
+PyMODINIT_FUNC PyInit__C_occa(){
   import_array();
   return PyModule_Create(&_occaModule);
 }
@@ -28,14 +28,101 @@ namespace occa {
     timerTraits();
   };
 
+  //---[ Profiler State ]-------------------------
+  // One call-tree node per (parent, region) pair, nodes only
+  //   point to their parent and children by index
+  class timerNode_t {
+  public:
+    int region, parent, treeDepth;
+
+    double timeTaken;
+    int    numCalls;
+    double flopCount;
+    double bandWidthCount;
+
+    // Calls timed with stream tags, kept apart from the host times
+    //   since they overlap with the host regions around them
+    double deviceTime;
+    int    deviceCalls;
+    double deviceFlopCount;
+    double deviceBandWidthCount;
+
+    std::vector<int> children;
+
+    timerNode_t(const int region_ = -1,
+                const int parent_ = -1,
+                const int treeDepth_ = 0);
+  };
+
+  // Completed regions, kept for trace export
+  class timerEvent_t {
+  public:
+    int region, treeDepth;
+    bool onDevice;
+    double startTime, timeTaken;
+  };
+
+  // Device regions are timed between two stream tags, resolved
+  //   when they're printed instead of finishing the device in toc()
+  //   (host regions around them no longer wait for the device)
+  class timerDeviceEvent_t {
+  public:
+    int node, event;
+    streamTag startTag, endTag;
+  };
+
+  // Only touched by its own thread while timing, so tic() and
+  //   toc() never lock
+  class timerThread_t {
+  public:
+    int threadID;
+
+    std::vector<timerNode_t> nodes;
+
+    std::vector<int> nodeStack;
+    std::vector<double> timeStack;
+
+    std::vector<streamTag> tagStack;
+    std::vector<char> hasTag;
+
+    std::vector<timerEvent_t> events;
+    std::vector<timerDeviceEvent_t> deviceEvents;
+
+    std::map<std::string, int> regionCache;
+
+    // Regions this thread closed with a kernel, tic() tags the stream for them
+    std::vector<char> deviceRegions;
+
+    timerThread_t(const int threadID_);
+  };
+  //==============================================
+
   class timer{
 
     bool profileKernels;
     bool profileApplication;
+    bool traceEvents;
     bool deviceInitialized;
 
     occa::device occaHandle;
 
+    mutex_t mutex;
+
+#if (OCCA_OS & (LINUX_OS | OSX_OS))
+    pthread_key_t threadKey;
+#else
+    DWORD threadKey;
+#endif
+
+    std::vector<timerThread_t*> threads;
+
+    // Interned region names, [regionIDs] maps back to indices in [regionNames]
+    std::map<std::string, int> regionIDs;
+    std::vector<std::string> regionNames;
+
+    // Set with OCCA_PROFILE_TRACE, printTimer() also exports the trace there
+    std::string traceFilename;
+
   public:
 
     timer();
@@ -45,39 +132,52 @@ namespace occa {
     // NBN: allow toggle from menu
     inline void setKernelProfiling(bool b) { profileKernels = b; }
     inline void setApplicationProfiling(bool b) { profileApplication = b; }
+    inline void setTracing(bool b) { traceEvents = b; }
 
-    std::stack<std::string> keyStack;
-    std::stack<double> timeStack;
-
-    std::map<std::stack<std::string>, timerTraits> times;
-
-    void tic(std::string key);
+    int regionID(const std::string &key);
+    std::string regionName(const int region);
 
-    double toc(std::string key);
+    timerThread_t& threadState();
 
-    double toc(std::string key, double flops);
+    void tic(const std::string &key);
+    void tic(const int region);
 
-    double toc(std::string key, occa::kernel &kernel);
+    double toc(const std::string &key);
+    double toc(const std::string &key, double flops);
+    double toc(const std::string &key, occa::kernel &kernel);
+    double toc(const std::string &key, occa::kernel &kernel, double flops);
+    double toc(const std::string &key, double flops, double bw);
+    double toc(const std::string &key, occa::kernel &kernel, double flops, double bw);
 
-    double toc(std::string key, occa::kernel &kernel, double flops);
+    double toc(const int region, occa::kernel *kernel, double flops, double bw);
 
-    double toc(std::string key, double flops, double bw);
+    // Waits on pending device tags and adds their times to the call trees
+    void resolveDeviceEvents(timerThread_t &t);
+    void resolveDeviceEvents();
 
-    double toc(std::string key, occa::kernel &kernel, double flops, double bw);
+    // Call trees of every thread merged by region path
+    void mergeTrees(std::vector<timerNode_t> &merged);
 
-    double print_recursively(std::vector<std::string> &childs,
+    double print_recursively(std::vector<timerNode_t> &merged,
+                             std::vector<double> &selfTimes,
+                             const std::vector<int> &childs,
                              double parentTime,
                              double overallTime);
 
-    // struct myclass {
-    //   bool operator() (std::pair<std::string, timerTraits> &a,
-    // 		     std::pair<std::string, timerTraits> &b){
-    //     return(a.second.selfTime > b.second.selfTime);
-    //   }
-    // } compareSelfTimes;
+    // Prints [tree] and returns its overall time, its top-level
+    //   regions are nested under [rootName] if it's given
+    double printTree(std::vector<timerNode_t> &tree,
+                     std::vector<double> &selfTimes,
+                     const std::string &rootName);
 
+    void printFlatProfile(const std::vector<timerNode_t> &tree,
+                          const std::vector<double> &selfTimes,
+                          const double overallTime);
 
     void printTimer();
+
+    // Chrome trace format (chrome://tracing, Perfetto)
+    void exportTrace(const std::string &filename);
   };
 
 
@@ -87,20 +187,30 @@ namespace occa {
 
   void initTimer(const occa::device &deviceHandle);
 
-  void tic(std::string key);
+  // Interned IDs skip the name lookup in tic() and toc()
+  int timerRegion(const std::string &key);
+
+  void tic(const std::string &key);
+  void tic(const int region);
 
-  double toc(std::string key);
+  double toc(const std::string &key);
 
-  double toc(std::string key, occa::kernel &kernel);
+  double toc(const std::string &key, occa::kernel &kernel);
 
-  double toc(std::string key, double fp);
+  double toc(const std::string &key, double fp);
 
-  double toc(std::string key, occa::kernel &kernel, double fp);
+  double toc(const std::string &key, occa::kernel &kernel, double fp);
 
-  double toc(std::string key, double fp, double bw);
+  double toc(const std::string &key, double fp, double bw);
 
-  double toc(std::string key, occa::kernel &kernel, double fp, double bw);
+  double toc(const std::string &key, occa::kernel &kernel, double fp, double bw);
+
+  double toc(const int region);
+  double toc(const int region, occa::kernel &kernel);
+  double toc(const int region, occa::kernel &kernel, double fp, double bw);
 
   void printTimer();
+
+  void exportTrace(const std::string &filename);
 }
 #endif
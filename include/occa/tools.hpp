@@ -19,6 +19,8 @@
 #if   (OCCA_OS & LINUX_OS)
 #  include <sys/time.h>
 #  include <unistd.h>
+#  include <fcntl.h>
+#  include <sys/file.h>
 #  include <sys/types.h>
 #  include <sys/dir.h>
 #elif (OCCA_OS & OSX_OS)
@@ -29,6 +31,9 @@
 #    include <mach/clock.h>
 #    include <mach/mach.h>
 #  endif
+#  include <unistd.h>
+#  include <fcntl.h>
+#  include <sys/file.h>
 #  include <sys/types.h>
 #  include <sys/dir.h>
 #else
@@ -38,12 +43,15 @@
 #  include <windows.h>
 #  include <string>
 #  include <direct.h>    // NBN: rmdir _rmdir
+#  include <io.h>
+#  include <fcntl.h>
 #endif
 
 namespace occa {
   class kernelInfo;
 
-  extern strToBoolMap_t fileLocks;
+  // Lock file -> flock()'d descriptor, or -1 for owner-file locks
+  extern std::map<std::string, int> fileLocks;
 
   //---[ Helper Info ]----------------
   namespace env {
@@ -54,6 +62,8 @@ namespace occa {
 
     extern std::string OCCA_DIR, OCCA_CACHE_DIR;
     extern size_t OCCA_MEM_BYTE_ALIGN;
+    extern int OCCA_MAX_BUILDS;
+    extern std::string OCCA_NODE_LOCK_DIR;
     extern stringVector_t OCCA_INCLUDE_PATH;
 
     void initialize();
@@ -82,6 +92,12 @@ namespace occa {
     int mkdir(const std::string &dir);
     void mkpath(const std::string &dir);
 
+    std::string hostname();
+
+    // Unique per host, process and call, for renaming into [filename]
+    std::string tmpFilename(const std::string &filename);
+    int rename(const std::string &from, const std::string &to);
+
     bool dirExists(const std::string &dir_);
     bool fileExists(const std::string &filename_,
                     const int flags = 0);
@@ -116,6 +132,83 @@ namespace occa {
     void unlock();
   };
 
+  class condition_t {
+  public:
+#if (OCCA_OS & (LINUX_OS | OSX_OS))
+    pthread_cond_t condHandle;
+#endif
+
+    condition_t();
+    void free();
+
+    // [mutex] must be locked by the caller
+    void wait(mutex_t &mutex);
+
+    void signal();
+    void broadcast();
+  };
+
+  //---[ Atomics ]--------------------
+  inline unsigned int atomicLoad(volatile unsigned int *ptr) {
+#if (OCCA_OS & (LINUX_OS | OSX_OS))
+    return __atomic_load_n(ptr, __ATOMIC_SEQ_CST);
+#else
+    MemoryBarrier();
+    const unsigned int ret = *ptr;
+    MemoryBarrier();
+    return ret;
+#endif
+  }
+
+  inline unsigned int atomicAdd(volatile unsigned int *ptr,
+                                const unsigned int value) {
+#if (OCCA_OS & (LINUX_OS | OSX_OS))
+    return __atomic_add_fetch(ptr, value, __ATOMIC_SEQ_CST);
+#else
+    return (InterlockedExchangeAdd((volatile LONG*) ptr, (LONG) value) + value);
+#endif
+  }
+
+  inline uint64_t atomicLoad(volatile uint64_t *ptr) {
+#if (OCCA_OS & (LINUX_OS | OSX_OS))
+    return __atomic_load_n(ptr, __ATOMIC_SEQ_CST);
+#else
+    return (uint64_t) InterlockedCompareExchange64((volatile LONGLONG*) ptr, 0, 0);
+#endif
+  }
+
+  inline void atomicStore(volatile uint64_t *ptr,
+                          const uint64_t value) {
+#if (OCCA_OS & (LINUX_OS | OSX_OS))
+    __atomic_store_n(ptr, value, __ATOMIC_SEQ_CST);
+#else
+    InterlockedExchange64((volatile LONGLONG*) ptr, (LONGLONG) value);
+#endif
+  }
+
+  // Returns true if [ptr] held [expected] and was swapped to [value]
+  inline bool atomicCAS(volatile uint64_t *ptr,
+                        uint64_t expected,
+                        const uint64_t value) {
+#if (OCCA_OS & (LINUX_OS | OSX_OS))
+    return __atomic_compare_exchange_n(ptr, &expected, value,
+                                       false,
+                                       __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST);
+#else
+    return (InterlockedCompareExchange64((volatile LONGLONG*) ptr,
+                                         (LONGLONG) value,
+                                         (LONGLONG) expected) == (LONGLONG) expected);
+#endif
+  }
+
+  // Counters wrap around, [a] is considered past [b] if it is
+  //   less than half the counter range ahead of it
+  inline bool counterReached(const unsigned int counter,
+                             const unsigned int target) {
+    return ((int) (counter - target) >= 0);
+  }
+  //==================================
+
   class fnvOutput_t {
   public:
     int h[8];
@@ -130,6 +223,25 @@ namespace occa {
     operator std::string ();
   };
 
+  // Streaming 128-bit hash for cache names, xxHash64-style with
+  //   four independent lanes over 32-byte stripes
+  class hash_t {
+  public:
+    uint64_t lanes[4];
+    uint64_t seed, bytes;
+
+    unsigned char buffer[32];
+    int bufferedBytes;
+
+    hash_t(const uint64_t seed_ = 0);
+
+    void update(const void *ptr, const uintptr_t bytes_);
+    void update(const std::string &str);
+
+    // 32 hex characters
+    std::string digest() const;
+  };
+
   double currentTime();
 
   //---[ File Functions ]-------------------------
@@ -144,15 +256,21 @@ namespace occa {
                        const bool readingBinary = false);
 
   void writeToFile(const std::string &filename,
-                   const std::string &content);
+                   const std::string &content,
+                   const bool writingBinary = false);
 
   std::string getFileLock(const std::string &filename, const int n);
   void clearLocks();
 
+  // Returns true if the caller now holds the lock and has to build
   bool haveHash(const std::string &hash, const int depth = 0);
-  void waitForHash(const std::string &hash, const int depth = 0);
+
+  // Blocks until the owner releases the lock, returns true if the
+  //   owner died and the caller took over its lock
+  bool waitForHash(const std::string &hash, const int depth = 0);
+
   void releaseHash(const std::string &hash, const int depth = 0);
-  void releaseHashLock(const std::string &lockDir);
+  void releaseHashLock(const std::string &lockFile);
 
   bool fileNeedsParser(const std::string &filename);
 
@@ -162,6 +280,13 @@ namespace occa {
                                         const std::string &functionName,
                                         const kernelInfo &info);
 
+  // One parse (or sidecar read) for every kernel in [functionNames]
+  std::vector<parsedKernelInfo> parseFileForFunctions(const std::string &deviceMode,
+                                                      const std::string &filename,
+                                                      const std::string &cachedBinary,
+                                                      const std::vector<std::string> &functionNames,
+                                                      const kernelInfo &info);
+
   std::string removeSlashes(const std::string &str);
 
   void setupOccaHeaders(const kernelInfo &info);
@@ -198,6 +323,12 @@ namespace occa {
   std::string getFileContentHash(const std::string &content,
                                  const std::string &salt);
 
+  // Cache path for [OCCA_DIR]/include/occa/defines/[header], named after
+  //   its contents (and the OCCA headers it includes) so copies left
+  //   by another OCCA version are never picked up
+  std::string getCachedOccaHeader(const std::string &header,
+                                  const std::string &cachedName);
+
   std::string getLibraryName(const std::string &filename);
 
   std::string hashFrom(const std::string &filename);
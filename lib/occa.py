@@ -349,7 +349,11 @@ def wrapMemory(handle, type_, entries):
         sys.exit()
     #=========================
 
-    return memory(_C_occa.wrapMemory(handle, entries, sizeof(type_)))
+    # The array is used in place, [base] keeps it alive
+    mem      = memory(_C_occa.wrapMemory(handle, entries, sizeof(type_)), type_)
+    mem.base = handle
+
+    return mem
 
 def wrapManagedMemory(handle, type_, entries):
     #---[ Arg Testing ]-------
@@ -381,7 +385,7 @@ def malloc(type_, entries):
         sys.exit()
     #=========================
 
-    return memory(_C_occa.malloc(entries, sizeof(type_)))
+    return memory(_C_occa.malloc(entries, sizeof(type_)), type_)
 
 def managedAlloc(type_, entries):
     #---[ Arg Testing ]-------
@@ -411,7 +415,7 @@ def mappedAlloc(type_, entries):
         sys.exit()
     #=========================
 
-    return memory(_C_occa.mappedAlloc(entries, sizeof(type_)))
+    return memory(_C_occa.mappedAlloc(entries, sizeof(type_)), type_)
 
 def managedMappedAlloc(type_, entries):
     #---[ Arg Testing ]-------
@@ -636,7 +640,7 @@ class device:
             sys.exit()
         #=========================
 
-        return memory(_C_occa.deviceMalloc(self.handle, entries, sizeof(type_)))
+        return memory(_C_occa.deviceMalloc(self.handle, entries, sizeof(type_)), type_)
 
     def managedAlloc(self, type_, entries):
         #---[ Arg Testing ]-------
@@ -666,7 +670,7 @@ class device:
             sys.exit()
         #=========================
 
-        return memory(_C_occa.deviceMappedAlloc(self.handle, entries, sizeof(type_)))
+        return memory(_C_occa.deviceMappedAlloc(self.handle, entries, sizeof(type_)), type_)
 
     def managedMappedAlloc(self, type_, entries):
         #---[ Arg Testing ]-------
@@ -792,8 +796,7 @@ class kernel:
             arg = args[i]
 
             if varIsOfClass(arg, np.ndarray):
-                argType = _C_occa.ptr(arg.ctypes.data)
-                _C_occa.argumentListAddArg(argList, i, argType)
+                _C_occa.argumentListAddArg(argList, i, arg)
             elif varIsOfClass(arg, memory):
                 _C_occa.argumentListAddArg(argList, i, arg.handle)
             else:
@@ -887,13 +890,15 @@ class kernelInfo:
 #=======================================
 
 #---[ Memory ]--------------------------
-class memory:
-    def __init__(self, handle_ = None):
+class memory(object):
+    def __init__(self, handle_ = None, type_ = np.uint8):
         #---[ Arg Testing ]-------
         try:
             if handle_ is not None and \
                isNotAnInteger(handle_):
                 raise ValueError('1st argument to [occa.memory.__init__] (if given) must be a memory handle')
+            elif isNotANumpyType(type_):
+                raise ValueError('2nd argument to [occa.memory.__init__] (if given) must be a numpy.dtype')
         except ValueError as e:
             print(e)
             sys.exit()
@@ -906,11 +911,20 @@ class memory:
             self.handle      = 0
             self.isAllocated = False
 
+        self.dtype = np.dtype(type_)
+        self.base  = None
+
     def free(self):
         import _C_occa
 
         if self.isAllocated:
-            _C_occa.memoryFree(self.handle)
+            # Wrapped arrays belong to numpy, only release the occa handle
+            if self.base is not None:
+                _C_occa.memoryDetach(self.handle)
+                self.base = None
+            else:
+                _C_occa.memoryFree(self.handle)
+
             self.isAllocated = False
 
     def __del__(self):
@@ -928,6 +942,18 @@ class memory:
     def getTextureHandle(self):
         return _C_occa.memoryGetTextureHandle(self.handle)
 
+    def bytes(self):
+        return _C_occa.memoryBytes(self.handle)
+
+    # numpy.asarray(mem) views host-accessible memory (CPU modes, mapped
+    #   allocations) in place and keeps [mem] alive while the view exists
+    @property
+    def __array_interface__(self):
+        return {'version': 3,
+                'shape'  : (self.bytes() // self.dtype.itemsize,),
+                'typestr': self.dtype.str,
+                'data'   : (_C_occa.memoryHostPointer(self.handle), False)}
+
     def copyFrom(self, src, bytes_ = 0, offset1 = 0, offset2 = 0):
         #---[ Arg Testing ]-------
         try:
@@ -33,6 +33,7 @@ def operatorDefinitions(N):
 
 def operatorDefinition(N):
     return """  void kernel::operator() (""" + ' '.join('const kernelArg &arg' + str(n) + nlc(n, N) for n in range(N)) + """){
+    checkIfInitialized();
     kernelArg args[] = {""" + ', '.join('arg{}'.format(n) for n in range(N)) + """}};
     kHandle->arguments.clear();
     kHandle->arguments.reserve({0});
@@ -52,14 +53,12 @@ def cKernelDefinitions(N):
     return '\n\n'.join(cKernelDefinition(n + 1) for n in range(N))
 
 def cKernelDefinition(N):
-    argsContent = ', '.join('((occaType) arg{})->ptr'.format(n) for n in range(N))
-    argsDelete = '\n  '.join('if(((occaType) arg{0})->ptr->type != OCCA_TYPE_MEMORY && ((occaType) arg{0})->ptr->type != OCCA_TYPE_PTR) delete ((occaType) arg{0});'.format(n) for n in range(N))
+    argsContent = ', '.join('(occaType) arg{}'.format(n) for n in range(N))
 
     return ('void OCCA_RFUNC occaKernelRun{0}(occaKernel kernel, {1}){{\n'.format(N, ' '.join('void *arg' + str(n) + nlc(n, N) for n in range(N)) ) + """
-  occaType_t *args[{0}] = {{ {1} }};
-  {2};
-  occaKernelRunN(kernel, {0}, args);
-}}""".format(N, argsContent, argsDelete))
+  occaType args[{0}] = {{ {1} }};
+  occa::_runKernel(kernel, {0}, args);
+}}""".format(N, argsContent))
 
 def gen_file(filename, content):
     with open(occadir + filename, 'w') as f:
@@ -50,6 +50,33 @@ def varL(n):
 def varN(n):
     return 's' + str(n)
 
+def has_vector_ext(type_):
+    return (type_ != 'bool')
+
+def vector_ext_type(type_, n):
+    return 'occaVector_' + type_ + str(n)
+
+def vector_ext_defines():
+    return """
+// CPU modes back vector types with compiler vector extensions
+//   Alignment is capped at 16 bytes, what malloc/new already give
+#if ((defined(__GNUC__) || defined(__clang__)) && !defined(__CUDACC__) && \\
+     (!defined(OCCA_IN_KERNEL) || OCCA_USING_CPU))
+#  define OCCA_VECTOR_EXTENSIONS 1
+#  define OCCA_VECTOR_EXT_TYPE(TYPE, N)                                   \\
+  TYPE __attribute__((vector_size(N * sizeof(TYPE)),                    \\
+                      aligned(((N * sizeof(TYPE)) < 16) ? (N * sizeof(TYPE)) : 16)))
+#else
+#  define OCCA_VECTOR_EXTENSIONS 0
+#endif
+
+"""
+
+def vector_ext_typedef(type_, n):
+    return ('#if OCCA_VECTOR_EXTENSIONS\n' +
+            'typedef OCCA_VECTOR_EXT_TYPE(' + type_ + ', ' + str(n) + ') ' + vector_ext_type(type_, n) + ';\n' +
+            '#endif\n')
+
 def define_typeN(type_, n):
     typeN = type_ + str(n)
     TYPEN = (type_ + str(n)).upper();
@@ -75,17 +102,56 @@ def define_typeN(type_, n):
     if typeN in defined_in_cuda:
         define += '#if (!defined(OCCA_IN_KERNEL) || (OCCA_USING_CUDA == 0))\n'
 
+    vecExt = has_vector_ext(type_)
+    vtypeN = vector_ext_type(type_, n)
+
+    if vecExt:
+        define += vector_ext_typedef(type_, n)
+
     define += 'class ' + type_ + str(n) + '{\n' + \
              'public:\n'
 
+    if vecExt:
+        define += '#if OCCA_VECTOR_EXTENSIONS\n' + \
+                  '  union {\n' + \
+                  '    ' + vtypeN + ' reg;\n' + \
+                  '    struct {\n' + \
+                  '#endif\n'
+
     for i in range(n):
         if(i < 4):
             define += '  union { ' + type_ + ' ' + varN(i) + ', ' + varL(i) + '; };\n'
         else:
             define += '  ' + type_ + ' ' + varN(i) + ';\n'
 
+    if vecExt:
+        define += '#if OCCA_VECTOR_EXTENSIONS\n' + \
+                  '    };\n' + \
+                  '  };\n' + \
+                  '#endif\n'
+
     define += '\n'
 
+    if vecExt:
+        define += '#if OCCA_VECTOR_EXTENSIONS\n'
+        define += '  inline occaFunction ' + typeN + '(const ' + vtypeN + ' &reg_) : \n' + \
+                  '    reg(reg_) {}\n\n'
+
+        for i in range(n + 1):
+            start = '  inline occaFunction ' + typeN + '('
+
+            args = (',\n' + (' ' * len(start))).join('const ' + type_ + ' &' + varL(j) + '_' for j in range(i))
+
+            define += start + args + ') : \n' + \
+                      '    reg((' + vtypeN + ') {' + \
+                      (', '.join(('0' if (i <= j) else varL(j) + '_') for j in range(n))) + \
+                      '}) {}\n'
+
+            if i < n:
+                define += '\n'
+
+        define += '#else\n'
+
     for i in range(n + 1):
         start = '  occaFunction inline ' + typeN + '('
 
@@ -98,6 +164,9 @@ def define_typeN(type_, n):
         if i < n:
             define += '\n'
 
+    if vecExt:
+        define += '#endif\n'
+
     define += '};\n'
 
     if typeN in defined_in_cuda:
@@ -178,6 +247,16 @@ def unary_op_def(type_, n, op):
         else:
             defines[d] += ';\n'
 
+    if has_vector_ext(type_):
+        signature, body = defines[0].split('\n', 1)
+
+        defines[0] = (signature + '\n' +
+                      '#if OCCA_VECTOR_EXTENSIONS\n' +
+                      '  return OCCA_' + TYPEN + '(' + ops[0] + 'a.reg);\n' +
+                      '#else\n' +
+                      body +
+                      '#endif\n')
+
     for d in range(maxDefs):
         if 0 < d:
             defines[0] += '\n' + defines[d]
@@ -223,13 +302,33 @@ def binary_op_def(type_, n, op):
             else:
                 defines[d] += '  a.' + varL(i) + ' ' + op + '= ' + b[d][i] + ';\n'
 
+    for d in range(5):
+        if d < 3:
+            defines[d] += ');\n'
+
+        if has_vector_ext(type_):
+            signature, body = defines[d].split('\n', 1)
+
+            aReg = 'a.reg' if aIsTypeN[d] else 'a'
+            bReg = 'b.reg' if bIsTypeN[d] else 'b'
+
+            if d < 3:
+                vecBody = '  return OCCA_' + TYPEN + '(' + aReg + ' ' + op + ' ' + bReg + ');\n'
+            else:
+                vecBody = '  a.reg ' + op + '= ' + bReg + ';\n'
+
+            defines[d] = (signature + '\n' +
+                          '#if OCCA_VECTOR_EXTENSIONS\n' +
+                          vecBody +
+                          '#else\n' +
+                          body +
+                          '#endif\n')
+
     for d in range(5):
         if 0 < d:
             defines[0] += '\n' + defines[d]
 
-        if d < 3:
-            defines[0] += ');\n'
-        else:
+        if 3 <= d:
             defines[0] += '  return a;\n'
 
         defines[0] += '}\n'
@@ -260,7 +359,9 @@ def define_all_types():
     define += '#  ifndef OCCA_IN_KERNEL\n'
     define += '#  define occaFunction\n'
     define += 'namespace occa {\n'
-    define += '#  endif\n\n'
+    define += '#  endif\n'
+
+    define += vector_ext_defines()
 
     for type_ in types:
         define += define_type(type_)
@@ -138,7 +138,8 @@ def setup_function(func,
 def make_function(f):
     import inspect
 
-    argc = len(inspect.getargspec(f).args)
+    getargspec = getattr(inspect, 'getfullargspec', None) or inspect.getargspec
+    argc = len(getargspec(f).args)
 
     source = ''
 
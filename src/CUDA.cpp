@@ -317,15 +317,17 @@ namespace occa {
     sourceFilename = hashDir + kc::sourceFile;
     binaryFilename = hashDir + fixBinaryName(kc::binaryFile);
 
-    if (!haveHash(hash, 0))
-      waitForHash(hash, 0);
-    else if (sys::fileExists(binaryFilename))
-      releaseHash(hash, 0);
-    else
-      foundBinary = false;
+    // Binaries are renamed into place, an existing one is complete
+    if (!sys::fileExists(binaryFilename) &&
+        (haveHash(hash, 0) || waitForHash(hash, 0))) {
+      if (sys::fileExists(binaryFilename))
+        releaseHash(hash, 0);
+      else
+        foundBinary = false;
+    }
 
     if (foundBinary) {
-      if(verboseCompilation_f)
+      if(info.showsCompilation())
         std::cout << "Found cached binary of [" << compressFilename(filename) << "] in [" << compressFilename(binaryFilename) << "]\n";
 
       return buildFromBinary(binaryFilename, functionName);
@@ -333,9 +335,11 @@ namespace occa {
 
     createSourceFileFrom(filename, hashDir, info);
 
+    const std::string tmpBinaryFilename = sys::tmpFilename(binaryFilename);
+
     std::stringstream command;
 
-    if(verboseCompilation_f)
+    if(info.showsCompilation())
       std::cout << "Compiling [" << functionName << "]\n";
 
 #if 0
@@ -357,7 +361,7 @@ namespace occa {
 
     const std::string &ptxCommand = command.str();
 
-    if(verboseCompilation_f)
+    if(info.showsCompilation())
       std::cout << "Compiling [" << functionName << "]\n" << ptxCommand << "\n";
 
 #  if (OCCA_OS & (LINUX_OS | OSX_OS))
@@ -371,7 +375,7 @@ namespace occa {
     command.str("");
 
     command << dHandle->compiler
-            << " -o "       << binaryFilename
+            << " -o "       << tmpBinaryFilename
             << " -ptx -I."
             << " -I"  << env::OCCA_DIR << "include"
 #  if (OCCA_OS == WINDOWS_OS)
@@ -383,7 +387,7 @@ namespace occa {
 
     const std::string &sCommand = command.str();
 
-    if(verboseCompilation_f)
+    if(info.showsCompilation())
       std::cout << sCommand << '\n';
 
     const int compileError = system(sCommand.c_str());
@@ -393,6 +397,8 @@ namespace occa {
       OCCA_CHECK(false, "Compilation error");
     }
 
+    sys::rename(tmpBinaryFilename, binaryFilename);
+
     const CUresult moduleLoadError = cuModuleLoad(&data_.module,
                                                   binaryFilename.c_str());
 
@@ -497,6 +503,28 @@ namespace occa {
     delete [] data_.vArgs;
   }
 
+  template <>
+  void kernel_t<CUDA>::runFromBoundArguments(){
+    CUDAKernelData_t &data_ = *((CUDAKernelData_t*) data);
+    CUfunction function_ = data_.function;
+
+    int occaKernelInfoArgs = 0;
+    void *vArgs[1 + 2*OCCA_MAX_ARGS];
+
+    const int argc = (int) boundArgPtrs.size();
+
+    vArgs[0] = &occaKernelInfoArgs;
+    if(argc)
+      ::memcpy(vArgs + 1, &(boundArgPtrs[0]), argc * sizeof(void*));
+
+    OCCA_CUDA_CHECK("Launching Kernel",
+                    cuLaunchKernel(function_,
+                                   outer.x, outer.y, outer.z,
+                                   inner.x, inner.y, inner.z,
+                                   0, *((CUstream*) dHandle->currentStream),
+                                   vArgs, 0));
+  }
+
   template <>
   void kernel_t<CUDA>::free(){
     OCCA_EXTRACT_DATA(CUDA, Kernel);
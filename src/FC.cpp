@@ -446,7 +446,8 @@ void OCCAARGUMENTLISTADDARGINT4_FC(occaArgumentList *list,
                                    int32_t *v){
   if(sizeof(int) == 4)
     {
-      occaArgumentListAddArg(*list, *argPos, occaInt(*v));
+      occaScalar s = occaIntScalar(*v);
+      occaArgumentListAddArg(*list, *argPos, &s);
     }
   else {
     OCCA_CHECK(false, "Bad integer size");
@@ -456,19 +457,22 @@ void OCCAARGUMENTLISTADDARGINT4_FC(occaArgumentList *list,
 void OCCAARGUMENTLISTADDARGREAL4_FC(occaArgumentList *list,
                                     int32_t *argPos,
                                     float *v){
-  occaArgumentListAddArg(*list, *argPos, occaFloat(*v));
+  occaScalar s = occaFloatScalar(*v);
+  occaArgumentListAddArg(*list, *argPos, &s);
 }
 
 void OCCAARGUMENTLISTADDARGREAL8_FC(occaArgumentList *list,
                                     int32_t *argPos,
                                     double *v){
-  occaArgumentListAddArg(*list, *argPos, occaDouble(*v));
+  occaScalar s = occaDoubleScalar(*v);
+  occaArgumentListAddArg(*list, *argPos, &s);
 }
 
 void OCCAARGUMENTLISTADDARGCHAR_FC(occaArgumentList *list,
                                    int32_t *argPos,
                                    char *v){
-  occaArgumentListAddArg(*list, *argPos, occaChar(*v));
+  occaScalar s = occaCharScalar(*v);
+  occaArgumentListAddArg(*list, *argPos, &s);
 }
 
 void OCCAKERNELRUN01_FC(occaKernel *kernel, occaMemory *arg01){
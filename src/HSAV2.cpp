@@ -210,10 +210,9 @@ namespace occa {
     const std::string ptxBinaryFile = hashDir + "ptxBinary.o";
     
     // TW: check for hash
-    if(!haveHash(hash, 0)){
-      waitForHash(hash, 0);
-
-      if(verboseCompilation_f)
+    if(sys::fileExists(binaryFile) ||
+       (!haveHash(hash, 0) && !waitForHash(hash, 0))) {
+      if(info.showsCompilation())
         std::cout << "Found cached binary of [" << compressFilename(filename) << "] in [" << compressFilename(binaryFile) << "]\n";
 
       // TW: build kernel from binary
@@ -223,7 +222,7 @@ namespace occa {
     if(sys::fileExists(binaryFile)){
       releaseHash(hash, 0);
 
-      if(verboseCompilation_f)
+      if(info.showsCompilation())
         std::cout << "Found cached binary of [" << compressFilename(filename) << "] in [" << compressFilename(binaryFile) << "]\n";
 
       return buildFromBinary(binaryFile, functionName);
@@ -249,17 +248,19 @@ namespace occa {
       archSM = archSM_.str();
     }
 
+    const std::string tmpBinaryFile = sys::tmpFilename(binaryFile);
+
     // TW: this specifies the system command for compilation of kernels
     std::stringstream command;
 
-    if(verboseCompilation_f)
+    if(info.showsCompilation())
       std::cout << "Compiling [" << functionName << "]\n";
 
     //---[ Compiling Command ]----------
     command.str("");
 
     command << dHandle->compiler
-            << " -o "       << binaryFile
+            << " -o "       << tmpBinaryFile
             << " -ptx -I."
             << " -I"  << env::OCCA_DIR << "/include"
             << ' '          << dHandle->compilerFlags
@@ -269,7 +270,7 @@ namespace occa {
 
     const std::string &sCommand = command.str();
 
-    if(verboseCompilation_f)
+    if(info.showsCompilation())
       std::cout << sCommand << '\n';
 
     // TW: this does the compilation step
@@ -280,6 +281,8 @@ namespace occa {
       OCCA_CHECK(false, "Compilation error");
     }
 
+    sys::rename(tmpBinaryFile, binaryFile);
+
     const CUresult moduleLoadError = cuModuleLoad(&data_.module,
                                                   binaryFile.c_str());
 
@@ -249,7 +249,8 @@ namespace occa {
                                const std::string &functionName,
                                const std::string &flags,
                                const std::string &hash,
-                               const std::string &sourceFile){
+                               const std::string &sourceFile,
+                               const bool verbose){
       cl_int error;
 
       data_.program = clCreateProgramWithSource(data_.context, 1,
@@ -260,7 +261,7 @@ namespace occa {
       if(error && hash.size())
         releaseHash(hash, 0);
 
-      if(verboseCompilation_f){
+      if(verbose && verboseCompilation_f){
         if(hash.size()){
           std::cout << "OpenCL compiling " << functionName
                     << " from [" << sourceFile << "]";
@@ -313,7 +314,7 @@ namespace occa {
 
       OCCA_CL_CHECK("Kernel (" + functionName + "): Creating Kernel", error);
 
-      if(verboseCompilation_f){
+      if(verbose && verboseCompilation_f){
         if(sourceFile.size()){
           std::cout << "OpenCL compiled " << functionName << " from [" << sourceFile << "]";
 
@@ -396,10 +397,14 @@ namespace occa {
 
       OCCA_CL_CHECK("saveProgramBinary: Getting Binary", error);
 
-      FILE *fp = fopen(binaryFile.c_str(), "wb");
+      const std::string tmpBinaryFile = sys::tmpFilename(binaryFile);
+
+      FILE *fp = fopen(tmpBinaryFile.c_str(), "wb");
       fwrite(binary, 1, binarySize, fp);
       fclose(fp);
 
+      sys::rename(tmpBinaryFile, binaryFile);
+
       delete [] binary;
     }
 
@@ -601,15 +606,17 @@ namespace occa {
     binaryFilename = hashDir + fixBinaryName(kc::binaryFile);
     bool foundBinary = true;
 
-    if (!haveHash(hash, 0))
-      waitForHash(hash, 0);
-    else if (sys::fileExists(binaryFilename))
-      releaseHash(hash, 0);
-    else
-      foundBinary = false;
+    // Binaries are renamed into place, an existing one is complete
+    if (!sys::fileExists(binaryFilename) &&
+        (haveHash(hash, 0) || waitForHash(hash, 0))) {
+      if (sys::fileExists(binaryFilename))
+        releaseHash(hash, 0);
+      else
+        foundBinary = false;
+    }
 
     if (foundBinary) {
-      if(verboseCompilation_f)
+      if(info.showsCompilation())
         std::cout << "Found cached binary of [" << compressFilename(filename) << "] in [" << compressFilename(binaryFilename) << "]\n";
 
       return buildFromBinary(binaryFilename, functionName);
@@ -625,7 +632,8 @@ namespace occa {
                               cFunction.c_str(), cFunction.size(),
                               functionName,
                               catFlags,
-                              hash, sourceFilename);
+                              hash, sourceFilename,
+                              info.showsCompilation());
 
     cl::saveProgramBinary(data_, binaryFilename, hash);
 
@@ -733,6 +741,49 @@ namespace occa {
                                          0, NULL, NULL));
   }
 
+  template <>
+  void kernel_t<OpenCL>::runFromBoundArguments(){
+    OpenCLKernelData_t &data_ = *((OpenCLKernelData_t*) data);
+    cl_kernel kernel_ = data_.kernel;
+
+    occa::dim fullOuter = outer*inner;
+
+    // cl_kernel keeps its arguments, only changed ones are set again
+    const int kArgc = (int) boundArguments.size();
+    bool setAny = false;
+
+    for(int i = 0; i < kArgc; ++i){
+      if(!boundArgChanged[i])
+        continue;
+
+      const kernelArg &arg = boundArguments[i];
+
+      for(int j = 0; j < arg.argc; ++j){
+        const int argc = (1 + boundArgOffsets[i] + j);
+
+        OCCA_CL_CHECK("Kernel (" + metaInfo.name + ") : Setting Kernel Argument [" << argc << "]",
+                      clSetKernelArg(kernel_, argc, arg.args[j].size, boundArgPtrs[argc - 1]));
+      }
+
+      boundArgChanged[i] = false;
+      setAny = true;
+    }
+
+    if(setAny){
+      OCCA_CL_CHECK("Kernel (" + metaInfo.name + ") : Setting Kernel Argument [0]",
+                    clSetKernelArg(kernel_, 0, sizeof(void*), NULL));
+    }
+
+    OCCA_CL_CHECK("Kernel (" + metaInfo.name + ") : Kernel Run",
+                  clEnqueueNDRangeKernel(*((cl_command_queue*) dHandle->currentStream),
+                                         kernel_,
+                                         (cl_int) dims,
+                                         NULL,
+                                         (uintptr_t*) &fullOuter,
+                                         (uintptr_t*) &inner,
+                                         0, NULL, NULL));
+  }
+
   template <>
   void kernel_t<OpenCL>::free(){
     OCCA_EXTRACT_DATA(OpenCL, Kernel);
@@ -60,9 +60,7 @@ namespace occa {
                 readFile(env::OCCA_DIR + "/scripts/ompTest.cpp"),
                 "ompTest");
 
-      if(!haveHash(hash)){
-        waitForHash(hash);
-      } else {
+      if(haveHash(hash) || waitForHash(hash)) {
         if(!sys::fileExists(infoFilename)){
           flag = baseCompilerFlag(vendor_);
           ss << compiler
@@ -185,15 +183,17 @@ namespace occa {
     binaryFilename = hashDir + fixBinaryName(kc::binaryFile);
     bool foundBinary = true;
 
-    if (!haveHash(hash, 0))
-      waitForHash(hash, 0);
-    else if (sys::fileExists(binaryFilename))
-      releaseHash(hash, 0);
-    else
-      foundBinary = false;
+    // Binaries are renamed into place, an existing one is complete
+    if (!sys::fileExists(binaryFilename) &&
+        (haveHash(hash, 0) || waitForHash(hash, 0))) {
+      if (sys::fileExists(binaryFilename))
+        releaseHash(hash, 0);
+      else
+        foundBinary = false;
+    }
 
     if (foundBinary) {
-      if(verboseCompilation_f)
+      if(info.showsCompilation())
         std::cout << "Found cached binary of [" << compressFilename(filename) << "] in [" << compressFilename(binaryFilename) << "]\n";
 
       return buildFromBinary(binaryFilename, functionName);
@@ -203,6 +203,8 @@ namespace occa {
 
     createSourceFileFrom(filename, hashDir, info);
 
+    const std::string tmpBinaryFilename = sys::tmpFilename(binaryFilename);
+
     std::stringstream command;
 
     if(dHandle->compilerEnvScript.size())
@@ -226,7 +228,7 @@ namespace occa {
             << ' '    << dHandle->compilerFlags
             << ' '    << info.flags
             << ' '    << sourceFilename
-            << " -o " << binaryFilename
+            << " -o " << tmpBinaryFilename
             << " -I"  << env::OCCA_DIR << "/include"
             << " -L"  << env::OCCA_DIR << "/lib -locca"
             << std::endl;
@@ -245,13 +247,13 @@ namespace occa {
             << ' '    << info.flags
             << " /I"  << env::OCCA_DIR << "\\include"
             << ' '    << sourceFilename
-            << " /link " << occaLib << ptLib << " /OUT:" << binaryFilename
+            << " /link " << occaLib << ptLib << " /OUT:" << tmpBinaryFilename
             << std::endl;
 #endif
 
     const std::string &sCommand = command.str();
 
-    if(verboseCompilation_f)
+    if(info.showsCompilation())
       std::cout << "Compiling [" << functionName << "]\n" << sCommand << "\n";
 
 #if (OCCA_OS & (LINUX_OS | OSX_OS))
@@ -265,6 +267,8 @@ namespace occa {
       OCCA_CHECK(false, "Compilation error");
     }
 
+    sys::rename(tmpBinaryFilename, binaryFilename);
+
     OCCA_EXTRACT_DATA(OpenMP, Kernel);
 
     data_.dlHandle = cpu::dlopen(binaryFilename, hash);
@@ -295,7 +299,12 @@ namespace occa {
   template <>
   kernel_t<OpenMP>* kernel_t<OpenMP>::loadFromLibrary(const char *cache,
                                                       const std::string &functionName){
-    return buildFromBinary(cache, functionName);
+    buildFromBinary(cpu::libraryImageFilename(cache), functionName);
+
+    OCCA_CHECK(((OpenMPKernelData_t*) data)->handle != NULL,
+               "Kernel [" << functionName << "] is missing from its library image");
+
+    return this;
   }
 
   template <>
@@ -336,6 +345,26 @@ namespace occa {
                      argc, data_.vArgs);
   }
 
+  template <>
+  void kernel_t<OpenMP>::runFromBoundArguments(){
+    OpenMPKernelData_t &data_ = *((OpenMPKernelData_t*) data);
+    handleFunction_t tmpKernel = (handleFunction_t) data_.handle;
+    int occaKernelArgs[6];
+
+    occaKernelArgs[0] = outer.z; occaKernelArgs[3] = inner.z;
+    occaKernelArgs[1] = outer.y; occaKernelArgs[4] = inner.y;
+    occaKernelArgs[2] = outer.x; occaKernelArgs[5] = inner.x;
+
+    const int argc = (int) boundArgPtrs.size();
+
+    int occaInnerId0 = 0, occaInnerId1 = 0, occaInnerId2 = 0;
+
+    cpu::runFunction(tmpKernel,
+                     occaKernelArgs,
+                     occaInnerId0, occaInnerId1, occaInnerId2,
+                     argc, (argc ? &(boundArgPtrs[0]) : NULL));
+  }
+
   template <>
   void kernel_t<OpenMP>::free(){
     OCCA_EXTRACT_DATA(OpenMP, Kernel);
@@ -927,56 +956,16 @@ namespace occa {
   void device_t<OpenMP>::cacheKernelInLibrary(const std::string &filename,
                                               const std::string &functionName,
                                               const kernelInfo &info_){
-#if 0
-    //---[ Creating shared library ]----
-    kernel tmpK = occa::device(this).buildKernelFromSource(filename, functionName, info_);
-    tmpK.free();
-
-    kernelInfo info = info_;
-
-    addOccaHeadersToInfo(info);
-
-    std::string cachedBinary = getCachedName(filename, getInfoSalt(info));
-
-#if (OCCA_OS == WINDOWS_OS)
-    // Windows requires .dll extension
-    cachedBinary = cachedBinary + ".dll";
-#endif
-    //==================================
-
-    library::infoID_t infoID;
-
-    infoID.modelID    = modelID_;
-    infoID.kernelName = functionName;
-
-    library::infoHeader_t &header = library::headerMap[infoID];
-
-    header.fileID = -1;
-    header.mode   = OpenMP;
-
-    const std::string flatDevID = getIdentifier().flattenFlagMap();
-
-    header.flagsOffset = library::addToScratchPad(flatDevID);
-    header.flagsBytes  = flatDevID.size();
-
-    header.contentOffset = library::addToScratchPad(cachedBinary);
-    header.contentBytes  = cachedBinary.size();
-
-    header.kernelNameOffset = library::addToScratchPad(functionName);
-    header.kernelNameBytes  = functionName.size();
-#endif
+    library::cacheCpuKernel(this, filename, functionName, info_);
   }
 
   template <>
   kernel_v* device_t<OpenMP>::loadKernelFromLibrary(const char *cache,
                                                     const std::string &functionName){
-#if 0
     kernel_v *k = new kernel_t<OpenMP>;
     k->dHandle = this;
     k->loadFromLibrary(cache, functionName);
     return k;
-#endif
-    return NULL;
   }
 
   template <>
@@ -1026,9 +1015,30 @@ namespace occa {
     mem->dHandle = this;
     mem->size    = bytes;
 
-    mem->handle = cpu::malloc(bytes);
+    int node;
+    const int placement = cpu::getMemPlacement(properties, node);
 
-    if(src != NULL)
+    mem->handle = cpu::malloc(bytes, placement, node);
+
+    if(placement == cpu::memPlacement::firstTouch){
+      char *dest = (char*) mem->handle;
+
+      // Each thread touches (or copies in) its own pages
+#pragma omp parallel
+      {
+        uintptr_t start, end;
+
+        cpu::getPageRange(bytes,
+                          omp_get_thread_num(), omp_get_num_threads(),
+                          start, end);
+
+        if(src != NULL)
+          ::memcpy(dest + start, ((char*) src) + start, end - start);
+        else
+          ::memset(dest + start, 0, end - start);
+      }
+    }
+    else if(src != NULL)
       ::memcpy(mem->handle, src, bytes);
 
     return mem;
@@ -1,17 +1,24 @@
 #include "occa/Serial.hpp"
 #include "occa/Pthreads.hpp"
 
+#include <algorithm>
+#include <map>
+
 namespace occa {
   //---[ Helper Functions ]-------------
   namespace pthreads {
     void* limbo(void *args){
       PthreadWorkerData_t &data = *((PthreadWorkerData_t*) args);
+      PthreadsDeviceData_t &dData = *(data.dData);
 
       // Thread affinity
 #if (OCCA_OS == LINUX_OS) // Not WINUX
       cpu_set_t cpuHandle;
       CPU_ZERO(&cpuHandle);
       CPU_SET(data.pinnedCore, &cpuHandle);
+
+      if(pthread_setaffinity_np(pthread_self(), sizeof(cpu_set_t), &cpuHandle))
+        fprintf(stderr, "[Pthreads] Could not pin thread [%d] on core [%d]\n", data.rank, data.pinnedCore);
 #else
       // NBN: affinity on hyperthreaded multi-socket systems?
       if(data.rank == 0)
@@ -20,52 +27,387 @@ namespace occa {
 #endif
 
       while(true){
-        // Fence local data (incase of out-of-socket updates)
-        OCCA_LFENCE;
+        data.idleTime += waitFor(dData.signal,
+                                 &(data.head), data.tail + 1,
+                                 &(data.timesParked));
+
+        PthreadKernelInfo_t &pkInfo = data.ring[data.tail % pthreadRingSize];
+
+        if(pkInfo.launch == NULL)
+          break;
+
+        // The launch slot can be reused once the ring slot is freed
+        PthreadStream_t &stream = *(pkInfo.launch->stream);
+
+        // Previous launches in the stream need to finish first
+        data.idleTime += waitFor(dData.signal,
+                                 &(stream.finishedJobs), pkInfo.startAfter,
+                                 &(data.timesParked));
+
+        const double startTime = currentTime();
+
+        run(pkInfo);
+
+        data.activeTime += (currentTime() - startTime);
+        ++data.jobsRun;
+
+        // Frees the ring slot for the host
+        atomicAdd(&(data.tail), 1);
+        atomicAdd(&(stream.finishedJobs), 1);
+        atomicAdd(&(dData.finishedJobs), 1);
+        notify(dData.signal);
+      }
+
+      return NULL;
+    }
+
+    double waitFor(PthreadSignal_t &signal,
+                   volatile unsigned int *counter,
+                   const unsigned int target,
+                   int *timesParked){
+
+      if(counterReached(atomicLoad(counter), target))
+        return 0;
+
+      const double startTime = currentTime();
+      const double spinTime  = 1.0e-6 * signal.spinTime;
+
+      for(int spins = 1; ; ++spins){
+        if(counterReached(atomicLoad(counter), target))
+          return (currentTime() - startTime);
+
+        // Checking the time is more expensive than the counter
+        if(((spins % 128) == 0) &&
+           (0 <= signal.spinTime) &&
+           (spinTime <= (currentTime() - startTime))){
+          break;
+        }
+      }
+
+      signal.mutex.lock();
+      atomicAdd(&(signal.parked), 1);
+
+      while(!counterReached(atomicLoad(counter), target)){
+        if(timesParked)
+          ++(*timesParked);
+
+        signal.cond.wait(signal.mutex);
+      }
+
+      atomicAdd(&(signal.parked), -1);
+      signal.mutex.unlock();
+
+      return (currentTime() - startTime);
+    }
+
+    void notify(PthreadSignal_t &signal){
+      // Counter updates are sequentially consistent with [parked],
+      //   either the waiter sees the update or we see the waiter
+      if(atomicLoad(&(signal.parked)) == 0)
+        return;
+
+      signal.mutex.lock();
+      signal.cond.broadcast();
+      signal.mutex.unlock();
+    }
+
+    void waitForRingSlot(PthreadsDeviceData_t &dData,
+                         const int rank){
+
+      PthreadWorkerData_t &worker = *(dData.workers[rank]);
+
+      if(counterReached(atomicLoad(&(worker.tail)) + pthreadRingSize,
+                        worker.head + 1)){
+        return;
+      }
+
+      waitFor(dData.signal,
+              &(worker.tail), worker.head + 1 - pthreadRingSize);
+    }
+
+    void pushJob(PthreadsDeviceData_t &dData,
+                 const int rank,
+                 const unsigned int startAfter,
+                 PthreadLaunch_t *launch){
+
+      PthreadWorkerData_t &worker = *(dData.workers[rank]);
 
-        if( *(data.pendingJobs) ){
-          data.kernelMutex->lock();
-          PthreadKernelInfo_t &pkInfo = *(data.pKernelInfo->front());
-          data.pKernelInfo->pop();
-          data.kernelMutex->unlock();
+      waitForRingSlot(dData, rank);
 
-          run(pkInfo);
+      PthreadKernelInfo_t &pkInfo = worker.ring[worker.head % pthreadRingSize];
 
-          //---[ Barrier ]----------------
-          data.pendingJobsMutex->lock();
-          --( *(data.pendingJobs) );
-          data.pendingJobsMutex->unlock();
+      pkInfo.rank       = rank;
+      pkInfo.count      = dData.pThreadCount;
+      pkInfo.startAfter = startAfter;
+      pkInfo.launch     = launch;
 
-          while((*data.pendingJobs) % data.count){
-            OCCA_LFENCE;
+      atomicAdd(&(worker.head), 1);
+    }
+
+    PthreadTag_t* findTag(PthreadsDeviceData_t &dData, const streamTag &tag){
+      const uintptr_t id = (uintptr_t) tag.handle;
+      PthreadTag_t &pTag = dData.tags[id % pthreadTagPoolSize];
+
+      return (((id != 0) && (pTag.id == id)) ? &pTag : NULL);
+    }
+
+    PthreadLaunch_t& nextLaunch(PthreadsDeviceData_t &dData){
+      // Every launch goes to every worker, so a slot is free again
+      //   once every ring moved past it
+      for(int p = 0; p < dData.pThreadCount; ++p)
+        waitForRingSlot(dData, p);
+
+      return dData.launches[dData.launchCount % pthreadRingSize];
+    }
+
+    void setLaunchArgs(PthreadLaunch_t &launch,
+                       const int kArgc, const kernelArg *kArgs){
+      int argc = 0;
+
+      for(int i = 0; i < kArgc; ++i){
+        for(int j = 0; j < kArgs[i].argc; ++j){
+          const kernelArg_t &arg = kArgs[i].args[j];
+
+          if(arg.info & kArgInfo::usePointer){
+            launch.args[argc] = arg.ptr();
+          }
+          else {
+            launch.argData[argc] = arg.data;
+            launch.args[argc]    = &(launch.argData[argc]);
           }
-          //==============================
+
+          ++argc;
         }
       }
 
-      return NULL;
+      launch.argc = argc;
+    }
+
+    void scheduleLaunch(PthreadsKernelData_t &data_,
+                        PthreadsDeviceData_t &dData,
+                        PthreadLaunch_t &launch){
+      const int pThreadCount = data_.pThreadCount;
+      const int total        = (int) (launch.outer.x * launch.outer.y * launch.outer.z);
+
+      launch.schedule = ((data_.loopSchedule < 0) ? dData.loopSchedule : data_.loopSchedule);
+
+      int chunkSize = ((data_.chunkSize < 0) ? dData.chunkSize : data_.chunkSize);
+
+      // Aim for a few chunks per worker
+      if(chunkSize <= 0)
+        chunkSize = (total / (4 * pThreadCount));
+
+      launch.chunkSize = ((0 < chunkSize) ? chunkSize : 1);
+      launch.nextChunk = 0;
+
+      if(launch.schedule == pthreadSchedule::stealChunks){
+        for(int p = 0; p < pThreadCount; ++p){
+          const uint64_t start = (((int64_t) total * p)       / pThreadCount);
+          const uint64_t end   = (((int64_t) total * (p + 1)) / pThreadCount);
+
+          launch.ranges[p].range = ((start << 32) | end);
+        }
+      }
+    }
+
+    void pushLaunch(PthreadsDeviceData_t &dData,
+                    PthreadStream_t &stream,
+                    PthreadLaunch_t &launch){
+
+      const int pThreadCount = dData.pThreadCount;
+      const unsigned int startAfter = stream.launchedJobs;
+
+      launch.stream = &stream;
+
+      for(int p = 0; p < pThreadCount; ++p)
+        pushJob(dData, p, startAfter, &launch);
+
+      ++dData.launchCount;
+      stream.launchedJobs += pThreadCount;
+      dData.launchedJobs  += pThreadCount;
+
+      notify(dData.signal);
+    }
+
+    void enqueueCopy(PthreadsDeviceData_t &dData,
+                     PthreadStream_t &stream,
+                     void *dest, const void *src,
+                     const uintptr_t bytes){
+
+      PthreadLaunch_t &launch = nextLaunch(dData);
+
+      launch.type  = pthreadLaunch::copy;
+      launch.dest  = dest;
+      launch.src   = src;
+      launch.bytes = bytes;
+
+      pushLaunch(dData, stream, launch);
+    }
+
+    std::vector<PthreadWorkerStats_t> getWorkerStats(occa::device d){
+      std::vector<PthreadWorkerStats_t> stats;
+
+      if(d.getDHandle()->mode() != Pthreads)
+        return stats;
+
+      PthreadsDeviceData_t &dData = *((PthreadsDeviceData_t*) d.getContextHandle());
+
+      for(int p = 0; p < dData.pThreadCount; ++p){
+        PthreadWorkerData_t &worker = *(dData.workers[p]);
+        PthreadWorkerStats_t ws;
+
+        ws.rank        = worker.rank;
+        ws.pinnedCore  = worker.pinnedCore;
+        ws.socket      = worker.socket;
+        ws.numaNode    = worker.numaNode;
+        ws.jobsRun     = worker.jobsRun;
+        ws.timesParked = worker.timesParked;
+        ws.activeTime  = worker.activeTime;
+        ws.idleTime    = worker.idleTime;
+
+        stats.push_back(ws);
+      }
+
+      return stats;
+    }
+
+    void printWorkerStats(occa::device d){
+      std::vector<PthreadWorkerStats_t> stats = getWorkerStats(d);
+
+      std::cout << "  Rank  |  Core  |  Socket  |  Node  |  Jobs  |  Parked  |  Active (s)  |  Idle (s)\n";
+
+      for(size_t i = 0; i < stats.size(); ++i){
+        const PthreadWorkerStats_t &ws = stats[i];
+
+        std::cout << "  " << ws.rank
+                  << "  |  " << ws.pinnedCore
+                  << "  |  " << ws.socket
+                  << "  |  " << ws.numaNode
+                  << "  |  " << ws.jobsRun
+                  << "  |  " << ws.timesParked
+                  << "  |  " << ws.activeTime
+                  << "  |  " << ws.idleTime << '\n';
+      }
     }
 
     void run(PthreadKernelInfo_t &pkInfo){
-      handleFunction_t tmpKernel = (handleFunction_t) pkInfo.kernelHandle;
+      PthreadLaunch_t &launch = *(pkInfo.launch);
+
+      if(launch.type == pthreadLaunch::marker){
+        // Every job before the marker in its stream is done
+        if(pkInfo.rank == 0){
+          launch.tag->time = currentTime();
+          atomicAdd(&(launch.tag->reached), 1);
+        }
+
+        return;
+      }
+
+      if(launch.type == pthreadLaunch::copy){
+        // Page-sized blocks keep first touches on the owning worker
+        uintptr_t start, end;
 
-      int dp           = pkInfo.dims - 1;
-      occa::dim &outer = pkInfo.outer;
-      occa::dim &inner = pkInfo.inner;
+        cpu::getPageRange(launch.bytes, pkInfo.rank, pkInfo.count,
+                          start, end);
 
-      occa::dim start(0,0,0), end(outer);
+        if(start < end){
+          if(launch.src != NULL){
+            ::memcpy(((char*) launch.dest) + start,
+                     ((const char*) launch.src) + start,
+                     end - start);
+          }
+          else
+            ::memset(((char*) launch.dest) + start, 0, end - start);
+        }
+
+        return;
+      }
+
+      const occa::dim &outer = launch.outer;
 
-      int loops     = (outer[dp] / pkInfo.count);
-      int coolRanks = (outer[dp] - loops*pkInfo.count);
+      const int total = (outer.x * outer.y * outer.z);
+      const int rank  = pkInfo.rank;
+      const int count = pkInfo.count;
 
-      if(pkInfo.rank < coolRanks){
-        start[dp] = (pkInfo.rank)*(loops + 1);
-        end[dp]   = start[dp] + (loops + 1);
+      if(launch.schedule == pthreadSchedule::staticChunks){
+        runRange(launch,
+                 (int) (((int64_t) total * rank)       / count),
+                 (int) (((int64_t) total * (rank + 1)) / count));
+        return;
       }
-      else{
-        start[dp] = pkInfo.rank*loops + coolRanks;
-        end[dp]   = start[dp] + loops;
+
+      const int chunkSize = launch.chunkSize;
+
+      if(launch.schedule == pthreadSchedule::dynamicChunks){
+        while(true){
+          const int end   = (int) atomicAdd(&(launch.nextChunk), chunkSize);
+          const int start = (end - chunkSize);
+
+          if(total <= start)
+            break;
+
+          runRange(launch, start, ((end < total) ? end : total));
+        }
+
+        return;
+      }
+
+      // Work-stealing: take chunks from the front of our range,
+      //   steal half of someone else's range from the back
+      volatile uint64_t *myRange = &(launch.ranges[rank].range);
+
+      for(int victim = rank; victim < (rank + count); ){
+        const uint64_t range = atomicLoad(myRange);
+
+        const int start = (int) (range >> 32);
+        const int end   = (int) (range & 0xFFFFFFFF);
+
+        if(start < end){
+          const int chunkEnd = (((start + chunkSize) < end) ?
+                                (start + chunkSize) : end);
+
+          if(atomicCAS(myRange, range, (((uint64_t) chunkEnd << 32) | end))){
+            runRange(launch, start, chunkEnd);
+            victim = rank;
+          }
+
+          continue;
+        }
+
+        volatile uint64_t *vRange = &(launch.ranges[++victim % count].range);
+
+        while(true){
+          const uint64_t vr = atomicLoad(vRange);
+
+          const int vStart = (int) (vr >> 32);
+          const int vEnd   = (int) (vr & 0xFFFFFFFF);
+
+          if(vEnd <= vStart)
+            break;
+
+          const int stolen = ((vEnd - vStart + 1) / 2);
+
+          if(atomicCAS(vRange, vr, (((uint64_t) vStart << 32) | (vEnd - stolen)))){
+            // Nobody steals from an empty range, so we can publish ours
+            atomicStore(myRange, (((uint64_t) (vEnd - stolen) << 32) | vEnd));
+            victim = rank;
+            break;
+          }
+        }
       }
+    }
+
+    void runRange(PthreadLaunch_t &launch,
+                  const int start, const int end){
+
+      handleFunction_t tmpKernel = (handleFunction_t) launch.kernelHandle;
+
+      const occa::dim &outer = launch.outer;
+      const occa::dim &inner = launch.inner;
+
+      const int nx  = outer.x;
+      const int ny  = outer.y;
+      const int nxy = (nx * ny);
 
       int occaKernelArgs[12];
 
@@ -73,19 +415,149 @@ namespace occa {
       occaKernelArgs[1]  = outer.y; occaKernelArgs[4]  = inner.y;
       occaKernelArgs[2]  = outer.x; occaKernelArgs[5]  = inner.x;
 
-      occaKernelArgs[6]  = start.z; occaKernelArgs[7]  = end.z;
-      occaKernelArgs[8]  = start.y; occaKernelArgs[9]  = end.y;
-      occaKernelArgs[10] = start.x; occaKernelArgs[11] = end.x;
+      // Split [start, end) into boxes: a partial row, partial plane,
+      //   full planes, and the same on the way out
+      for(int i = start; i < end; ){
+        const int z = (i / nxy);
+        const int y = ((i % nxy) / nx);
+        const int x = (i % nx);
+
+        const int left = (end - i);
+
+        int zEnd = z + 1, yEnd = y + 1, xEnd = x + 1;
+
+        if((x != 0) || (left < nx)){
+          xEnd = (((x + left) < nx) ? (x + left) : nx);
+        }
+        else if((y != 0) || (left < nxy)){
+          xEnd = nx;
+          yEnd = y + (((left / nx) < (ny - y)) ? (left / nx) : (ny - y));
+        }
+        else{
+          xEnd = nx;
+          yEnd = ny;
+          zEnd = z + (left / nxy);
+        }
+
+        occaKernelArgs[6]  = z; occaKernelArgs[7]  = zEnd;
+        occaKernelArgs[8]  = y; occaKernelArgs[9]  = yEnd;
+        occaKernelArgs[10] = x; occaKernelArgs[11] = xEnd;
+
+        int occaInnerId0 = 0, occaInnerId1 = 0, occaInnerId2 = 0;
+
+        cpu::runFunction(tmpKernel,
+                         occaKernelArgs,
+                         occaInnerId0, occaInnerId1, occaInnerId2,
+                         launch.argc, launch.args);
+
+        i += (zEnd - z) * (yEnd - y) * (xEnd - x);
+      }
+    }
+
+    static const char* placementName(const int schedule){
+      if(schedule & occa::scatter) return "scatter";
+      if(schedule & occa::numa)    return "numa";
+      if(schedule & occa::manual)  return "manual";
+
+      return "compact";
+    }
+
+    static bool compactOrder(const cpu::processorInfo_t &a,
+                             const cpu::processorInfo_t &b){
+      if(a.socket   != b.socket)   return (a.socket   < b.socket);
+      if(a.numaNode != b.numaNode) return (a.numaNode < b.numaNode);
+      if(a.core     != b.core)     return (a.core     < b.core);
+
+      return (a.smtIndex < b.smtIndex);
+    }
+
+    static bool spreadOrder(const cpu::processorInfo_t &a,
+                            const cpu::processorInfo_t &b){
+      if(a.smtIndex != b.smtIndex) return (a.smtIndex < b.smtIndex);
+
+      return compactOrder(a, b);
+    }
+
+    void getPlacement(std::vector<cpu::processorInfo_t> procs,
+                      const int schedule,
+                      const int threadCount,
+                      std::vector<cpu::processorInfo_t> &placement){
+
+      placement.clear();
 
-      int occaInnerId0 = 0, occaInnerId1 = 0, occaInnerId2 = 0;
+      const int procCount = procs.size();
 
-      cpu::runFunction(tmpKernel,
-                       occaKernelArgs,
-                       occaInnerId0, occaInnerId1, occaInnerId2,
-                       pkInfo.argc, pkInfo.args);
+      if(schedule & occa::compact){
+        std::sort(procs.begin(), procs.end(), compactOrder);
 
-      delete [] pkInfo.args;
-      delete &pkInfo;
+        for(int p = 0; p < threadCount; ++p)
+          placement.push_back(procs[p % procCount]);
+
+        return;
+      }
+
+      std::sort(procs.begin(), procs.end(), spreadOrder);
+
+      // Bucket processors by socket or NUMA node, keeping the spread order
+      std::map<int, std::vector<cpu::processorInfo_t> > domains;
+
+      for(int p = 0; p < procCount; ++p){
+        const int domain = ((schedule & occa::numa) ?
+                            procs[p].numaNode : procs[p].socket);
+
+        domains[domain].push_back(procs[p]);
+      }
+
+      std::vector<cpu::processorInfo_t> order;
+
+      for(int r = 0; (int) order.size() < procCount; ++r){
+        std::map<int, std::vector<cpu::processorInfo_t> >::iterator it = domains.begin();
+
+        while(it != domains.end()){
+          if(r < (int) it->second.size())
+            order.push_back(it->second[r]);
+
+          ++it;
+        }
+      }
+
+      for(int p = 0; p < threadCount; ++p)
+        placement.push_back(order[p % procCount]);
+    }
+
+    int scheduleFromString(const std::string &schedule){
+      if(schedule == "static")
+        return pthreadSchedule::staticChunks;
+      if(schedule == "dynamic")
+        return pthreadSchedule::dynamicChunks;
+      if(schedule == "stealing")
+        return pthreadSchedule::stealChunks;
+
+      OCCA_CHECK(false,
+                 "Pthreads loop schedule [" << schedule << "] is not available,"
+                 << " use [static], [dynamic] or [stealing]");
+
+      return pthreadSchedule::staticChunks;
+    }
+
+    void setSchedule(occa::kernel k,
+                     const std::string &schedule,
+                     const int chunkSize){
+
+      kernel_v *kHandle = k.getKHandle();
+
+      if(kHandle->mode() == Pthreads){
+        PthreadsKernelData_t &data_ = *((PthreadsKernelData_t*) kHandle->data);
+
+        data_.loopSchedule = scheduleFromString(schedule);
+        data_.chunkSize    = chunkSize;
+      }
+
+      const int nestedCount = kHandle->nestedKernelCount();
+      occa::kernel *nested  = kHandle->nestedKernelsPtr();
+
+      for(int i = 0; i < nestedCount; ++i)
+        setSchedule(nested[i], schedule, chunkSize);
     }
   }
   //==================================
@@ -176,15 +648,17 @@ namespace occa {
     binaryFilename = hashDir + fixBinaryName(kc::binaryFile);
     bool foundBinary = true;
 
-    if (!haveHash(hash, 0))
-      waitForHash(hash, 0);
-    else if (sys::fileExists(binaryFilename))
-      releaseHash(hash, 0);
-    else
-      foundBinary = false;
+    // Binaries are renamed into place, an existing one is complete
+    if (!sys::fileExists(binaryFilename) &&
+        (haveHash(hash, 0) || waitForHash(hash, 0))) {
+      if (sys::fileExists(binaryFilename))
+        releaseHash(hash, 0);
+      else
+        foundBinary = false;
+    }
 
     if (foundBinary) {
-      if(verboseCompilation_f)
+      if(info.showsCompilation())
         std::cout << "Found cached binary of [" << compressFilename(filename) << "] in [" << compressFilename(binaryFilename) << "]\n";
 
       return buildFromBinary(binaryFilename, functionName);
@@ -194,6 +668,8 @@ namespace occa {
 
     createSourceFileFrom(filename, hashDir, info);
 
+    const std::string tmpBinaryFilename = sys::tmpFilename(binaryFilename);
+
     std::stringstream command;
 
     if(dHandle->compilerEnvScript.size())
@@ -204,7 +680,7 @@ namespace occa {
             << ' '    << dHandle->compilerFlags
             << ' '    << info.flags
             << ' '    << sourceFilename
-            << " -o " << binaryFilename
+            << " -o " << tmpBinaryFilename
             << " -I"  << env::OCCA_DIR << "/include"
             << " -L"  << env::OCCA_DIR << "/lib -locca"
             << std::endl;
@@ -222,13 +698,13 @@ namespace occa {
             << ' '    << info.flags
             << " /I"  << env::OCCA_DIR << "\\include"
             << ' '    << sourceFilename
-            << " /link " << occaLib << ptLib << " /OUT:" << binaryFilename
+            << " /link " << occaLib << ptLib << " /OUT:" << tmpBinaryFilename
             << std::endl;
 #endif
 
     const std::string &sCommand = command.str();
 
-    if(verboseCompilation_f)
+    if(info.showsCompilation())
       std::cout << "Compiling [" << functionName << "]\n" << sCommand << "\n";
 
 #if (OCCA_OS & (LINUX_OS | OSX_OS))
@@ -242,6 +718,8 @@ namespace occa {
       OCCA_CHECK(false, "Compilation error");
     }
 
+    sys::rename(tmpBinaryFilename, binaryFilename);
+
     OCCA_EXTRACT_DATA(Pthreads, Kernel);
 
     data_.dlHandle = cpu::dlopen(binaryFilename, hash);
@@ -250,14 +728,9 @@ namespace occa {
     PthreadsDeviceData_t &dData = *((PthreadsDeviceData_t*) ((device_t<Pthreads>*) dHandle)->data);
 
     data_.pThreadCount = dData.pThreadCount;
-
-    data_.pendingJobs = &(dData.pendingJobs);
-
-    for(int p = 0; p < 50; ++p)
-      data_.pKernelInfo[p] = &(dData.pKernelInfo[p]);
-
-    data_.pendingJobsMutex = &(dData.pendingJobsMutex);
-    data_.kernelMutex      = &(dData.kernelMutex);
+    data_.loopSchedule = -1;
+    data_.chunkSize    = -1;
+    data_.dData        = &dData;
 
     releaseHash(hash, 0);
 
@@ -281,14 +754,9 @@ namespace occa {
     PthreadsDeviceData_t &dData = *((PthreadsDeviceData_t*) ((device_t<Pthreads>*) dHandle)->data);
 
     data_.pThreadCount = dData.pThreadCount;
-
-    data_.pendingJobs = &(dData.pendingJobs);
-
-    for(int p = 0; p < 50; ++p)
-      data_.pKernelInfo[p] = &(dData.pKernelInfo[p]);
-
-    data_.pendingJobsMutex = &(dData.pendingJobsMutex);
-    data_.kernelMutex      = &(dData.kernelMutex);
+    data_.loopSchedule = -1;
+    data_.chunkSize    = -1;
+    data_.dData        = &dData;
 
     return this;
   }
@@ -296,7 +764,12 @@ namespace occa {
   template <>
   kernel_t<Pthreads>* kernel_t<Pthreads>::loadFromLibrary(const char *cache,
                                                           const std::string &functionName){
-    return buildFromBinary(cache, functionName);
+    buildFromBinary(cpu::libraryImageFilename(cache), functionName);
+
+    OCCA_CHECK(((PthreadsKernelData_t*) data)->handle != NULL,
+               "Kernel [" << functionName << "] is missing from its library image");
+
+    return this;
   }
 
   template <>
@@ -315,39 +788,49 @@ namespace occa {
   void kernel_t<Pthreads>::runFromArguments(const int kArgc, const kernelArg *kArgs){
     OCCA_EXTRACT_DATA(Pthreads, Kernel);
 
-    const int pThreadCount = data_.pThreadCount;
+    PthreadsDeviceData_t &dData = *(data_.dData);
+    PthreadStream_t &stream     = *((PthreadStream_t*) dHandle->currentStream);
 
-    for(int p = 0; p < pThreadCount; ++p){
-      // Allocated individually since each thread frees their
-      //   own custom arg
-      PthreadKernelInfo_t &pArgs = *(new PthreadKernelInfo_t);
+    PthreadLaunch_t &launch = pthreads::nextLaunch(dData);
 
-      pArgs.rank  = p;
-      pArgs.count = pThreadCount;
+    launch.type         = pthreadLaunch::kernel;
+    launch.kernelHandle = data_.handle;
 
-      pArgs.kernelHandle = data_.handle;
+    launch.dims  = dims;
+    launch.inner = inner;
+    launch.outer = outer;
 
-      pArgs.dims  = dims;
-      pArgs.inner = inner;
-      pArgs.outer = outer;
+    pthreads::setLaunchArgs(launch, kArgc, kArgs);
 
-      int argc = 0;
-      pArgs.argc = kernelArg::argumentCount(kArgc, kArgs);
-      pArgs.args = new void*[pArgs.argc];
-      for(int i = 0; i < pArgs.argc; ++i){
-        for(int j = 0; j < kArgs[i].argc; ++j){
-          pArgs.args[argc++] = kArgs[i].args[j].ptr();
-        }
-      }
+    pthreads::scheduleLaunch(data_, dData, launch);
 
-      data_.kernelMutex->lock();
-      data_.pKernelInfo[p]->push(&pArgs);
-      data_.kernelMutex->unlock();
-    }
+    pthreads::pushLaunch(dData, stream, launch);
+  }
+
+  template <>
+  void kernel_t<Pthreads>::runFromBoundArguments(){
+    OCCA_EXTRACT_DATA(Pthreads, Kernel);
 
-    data_.pendingJobsMutex->lock();
-    *(data_.pendingJobs) += data_.pThreadCount;
-    data_.pendingJobsMutex->unlock();
+    PthreadsDeviceData_t &dData = *(data_.dData);
+    PthreadStream_t &stream     = *((PthreadStream_t*) dHandle->currentStream);
+
+    PthreadLaunch_t &launch = pthreads::nextLaunch(dData);
+
+    launch.type         = pthreadLaunch::kernel;
+    launch.kernelHandle = data_.handle;
+
+    launch.dims  = dims;
+    launch.inner = inner;
+    launch.outer = outer;
+
+    // Queued launches keep a copy, bound arguments can change before workers run
+    const int kArgc = (int) boundArguments.size();
+
+    pthreads::setLaunchArgs(launch, kArgc, (kArgc ? &(boundArguments[0]) : NULL));
+
+    pthreads::scheduleLaunch(data_, dData, launch);
+
+    pthreads::pushLaunch(dData, stream, launch);
   }
 
   template <>
@@ -520,8 +1003,9 @@ namespace occa {
     void *destPtr      = ((char*) (isATexture() ? textureInfo.arg : handle)) + offset;
     const void *srcPtr = src;
 
-
-    ::memcpy(destPtr, srcPtr, bytes_);
+    pthreads::enqueueCopy(*((PthreadsDeviceData_t*) dHandle->data),
+                          *((PthreadStream_t*) dHandle->currentStream),
+                          destPtr, srcPtr, bytes_);
   }
 
   template <>
@@ -542,7 +1026,9 @@ namespace occa {
     void *destPtr      = ((char*) (isATexture()      ? textureInfo.arg      : handle))      + destOffset;
     const void *srcPtr = ((char*) (src->isATexture() ? src->textureInfo.arg : src->handle)) + srcOffset;
 
-    ::memcpy(destPtr, srcPtr, bytes_);
+    pthreads::enqueueCopy(*((PthreadsDeviceData_t*) dHandle->data),
+                          *((PthreadStream_t*) dHandle->currentStream),
+                          destPtr, srcPtr, bytes_);
   }
 
   template <>
@@ -558,7 +1044,9 @@ namespace occa {
     void *destPtr      = dest;
     const void *srcPtr = ((char*) (isATexture() ? textureInfo.arg : handle)) + offset;
 
-    ::memcpy(destPtr, srcPtr, bytes_);
+    pthreads::enqueueCopy(*((PthreadsDeviceData_t*) dHandle->data),
+                          *((PthreadStream_t*) dHandle->currentStream),
+                          destPtr, srcPtr, bytes_);
   }
 
   template <>
@@ -579,7 +1067,9 @@ namespace occa {
     void *destPtr      = ((char*) (dest->isATexture() ? dest->textureInfo.arg : dest->handle)) + destOffset;
     const void *srcPtr = ((char*) (isATexture() ? textureInfo.arg : handle))       + srcOffset;
 
-    ::memcpy(destPtr, srcPtr, bytes_);
+    pthreads::enqueueCopy(*((PthreadsDeviceData_t*) dHandle->data),
+                          *((PthreadStream_t*) dHandle->currentStream),
+                          destPtr, srcPtr, bytes_);
   }
 
   template <>
@@ -601,6 +1091,9 @@ namespace occa {
 
   template <>
   void memory_t<Pthreads>::free(){
+    // Queued launches might still be using it
+    dHandle->finish();
+
     if(isATexture()){
       cpu::free(textureInfo.arg);
       textureInfo.arg = NULL;
@@ -669,7 +1162,7 @@ namespace occa {
 
   template <>
   void* device_t<Pthreads>::getContextHandle(){
-    return NULL;
+    return data;
   }
 
   template <>
@@ -684,9 +1177,40 @@ namespace occa {
 
     cpu::addSharedBinaryFlagsTo(data_.vendor, compilerFlags);
 
-    data_.pendingJobs = 0;
+    data_.launchCount  = 0;
+    data_.launchedJobs = 0;
+    data_.finishedJobs = 0;
 
-    data_.coreCount = cpu::getCoreCount();
+    data_.tagCount = 0;
+    data_.tags     = new PthreadTag_t[pthreadTagPoolSize];
+
+    for(int i = 0; i < pthreadTagPoolSize; ++i){
+      data_.tags[i].id      = 0;
+      data_.tags[i].time    = 0;
+      data_.tags[i].reached = 1;
+    }
+
+    if(aim.has("loopSchedule"))
+      data_.loopSchedule = pthreads::scheduleFromString(aim.get("loopSchedule"));
+    else
+      data_.loopSchedule = pthreadSchedule::staticChunks;
+
+    if(aim.has("chunkSize"))
+      data_.chunkSize = aim.iGet("chunkSize");
+    else
+      data_.chunkSize = 0;
+
+    std::vector<cpu::processorInfo_t> procs;
+    cpu::getTopology(procs);
+
+    data_.coreCount = procs.size();
+
+    data_.signal.parked = 0;
+
+    if(aim.has("spinTime"))
+      data_.signal.spinTime = aim.iGet("spinTime");
+    else
+      data_.signal.spinTime = defaultSpinTime;
 
     std::vector<int> pinnedCores;
 
@@ -695,13 +1219,24 @@ namespace occa {
     else
       data_.pThreadCount = aim.iGet("threadCount");
 
-    if(!aim.has("schedule") ||
-       (aim.get("schedule") == "compact")){
+    OCCA_CHECK(0 < data_.pThreadCount,
+               "Pthreads needs a positive [threadCount], not [" << data_.pThreadCount << "]");
 
-      data_.schedule = occa::compact;
+    if(aim.has("schedule")){
+      const std::string schedule = aim.get("schedule");
+
+      if(schedule == "compact")
+        data_.schedule = occa::compact;
+      else if(schedule == "numa")
+        data_.schedule = occa::numa;
+      else
+        data_.schedule = occa::scatter;
+    }
+    else if(aim.iGet("pinningInfo") & (occa::scatter | occa::numa)){
+      data_.schedule = (aim.iGet("pinningInfo") & (occa::scatter | occa::numa));
     }
     else{
-      data_.schedule = occa::scatter;
+      data_.schedule = occa::compact;
     }
 
     if(aim.has("pinnedCores")){
@@ -710,8 +1245,7 @@ namespace occa {
       if(pinnedCores.size() != (size_t) data_.pThreadCount){
         std::cout << "[Pthreads]: Mismatch between thread count and pinned cores\n"
                   << "            Defaulting to ["
-                  << ((data_.schedule == occa::compact) ?
-                      "compact" : "scatter")
+                  << pthreads::placementName(data_.schedule)
                   << "] scheduling\n"
                   << "  Thread Count: " << data_.pThreadCount << '\n'
                   << "  Pinned Cores: [";
@@ -753,26 +1287,77 @@ namespace occa {
       }
     }
 
+    std::vector<cpu::processorInfo_t> placement;
+
+    if(data_.schedule & occa::manual){
+      for(int p = 0; p < data_.pThreadCount; ++p){
+        cpu::processorInfo_t proc = cpu::processorInfo_t();
+        bool found = false;
+
+        for(int i = 0; i < data_.coreCount; ++i){
+          if(procs[i].id == pinnedCores[p]){
+            proc  = procs[i];
+            found = true;
+            break;
+          }
+        }
+
+        OCCA_CHECK(found,
+                   "Pthreads: [pinnedCores] entry [" << pinnedCores[p] << "] is not an online processor id");
+
+        proc.id = pinnedCores[p];
+        placement.push_back(proc);
+      }
+    }
+    else
+      pthreads::getPlacement(procs, data_.schedule, data_.pThreadCount, placement);
+
+    //---[ Report Placement ]---
+    std::stringstream cores, sockets, nodes;
+
+    for(int p = 0; p < data_.pThreadCount; ++p){
+      const char *sep = (p ? "," : "[");
+
+      cores   << sep << placement[p].id;
+      sockets << sep << placement[p].socket;
+      nodes   << sep << placement[p].numaNode;
+    }
+
+    cores << ']'; sockets << ']'; nodes << ']';
+
+    properties.set("threadCount"    , data_.pThreadCount);
+    properties.set("schedule"       , std::string(pthreads::placementName(data_.schedule)));
+    properties.set("pinnedCores"    , cores.str());
+    properties.set("threadSockets"  , sockets.str());
+    properties.set("threadNumaNodes", nodes.str());
+    //==========================
+
+    for(int i = 0; i < pthreadRingSize; ++i)
+      data_.launches[i].ranges = new PthreadRange_t[data_.pThreadCount];
+
+    data_.tid.resize(data_.pThreadCount);
+    data_.workers.resize(data_.pThreadCount);
+
     for(int p = 0; p < data_.pThreadCount; ++p){
       PthreadWorkerData_t *args = new PthreadWorkerData_t;
 
       args->rank  = p;
       args->count = data_.pThreadCount;
 
-      // [-] Need to know number of sockets
-      if(data_.schedule & occa::compact)
-        args->pinnedCore = (p % data_.coreCount);
-      else if(data_.schedule & occa::scatter)
-        args->pinnedCore = (p % data_.coreCount);
-      else // Manual
-        args->pinnedCore = pinnedCores[p];
+      args->pinnedCore = placement[p].id;
+      args->socket     = placement[p].socket;
+      args->numaNode   = placement[p].numaNode;
 
-      args->pendingJobs = &(data_.pendingJobs);
+      args->head  = 0;
+      args->tail  = 0;
+      args->dData = &data_;
 
-      args->pendingJobsMutex = &(data_.pendingJobsMutex);
-      args->kernelMutex      = &(data_.kernelMutex);
+      args->jobsRun     = 0;
+      args->timesParked = 0;
+      args->activeTime  = 0;
+      args->idleTime    = 0;
 
-      args->pKernelInfo = &(data_.pKernelInfo[p]);
+      data_.workers[p] = args;
 
 #if (OCCA_OS & (LINUX_OS | OSX_OS))
       pthread_create(&data_.tid[p], NULL, pthreads::limbo, args);
@@ -940,10 +1525,8 @@ namespace occa {
   void device_t<Pthreads>::finish(){
     OCCA_EXTRACT_DATA(Pthreads, Device);
 
-    // Fence local data (incase of out-of-socket updates)
-    while(data_.pendingJobs){
-      OCCA_LFENCE;
-    }
+    pthreads::waitFor(data_.signal,
+                      &(data_.finishedJobs), data_.launchedJobs);
   }
 
   template <>
@@ -953,34 +1536,92 @@ namespace occa {
 
   template <>
   void device_t<Pthreads>::waitFor(streamTag tag){
-    finish(); // [-] Not done
+    OCCA_EXTRACT_DATA(Pthreads, Device);
+
+    PthreadTag_t *pTag = pthreads::findTag(data_, tag);
+
+    // Recycled tags were reached before their record was reused
+    if(pTag == NULL)
+      return;
+
+    pthreads::waitFor(data_.signal,
+                      &(pTag->reached), 1);
   }
 
   template <>
   stream_t device_t<Pthreads>::createStream(){
-    return NULL;
+    PthreadStream_t *stream = new PthreadStream_t;
+
+    stream->launchedJobs = 0;
+    stream->finishedJobs = 0;
+
+    return stream;
   }
 
   template <>
-  void device_t<Pthreads>::freeStream(stream_t s){}
+  void device_t<Pthreads>::freeStream(stream_t s){
+    OCCA_EXTRACT_DATA(Pthreads, Device);
+
+    PthreadStream_t *stream = (PthreadStream_t*) s;
+
+    pthreads::waitFor(data_.signal,
+                      &(stream->finishedJobs), stream->launchedJobs);
+
+    delete stream;
+  }
 
   template <>
   stream_t device_t<Pthreads>::wrapStream(void *handle_){
-    return NULL;
+    return handle_;
   }
 
   template <>
   streamTag device_t<Pthreads>::tagStream(){
+    OCCA_EXTRACT_DATA(Pthreads, Device);
+
+    PthreadStream_t &stream = *((PthreadStream_t*) currentStream);
+
+    const uintptr_t id = ++data_.tagCount;
+    PthreadTag_t &pTag = data_.tags[id % pthreadTagPoolSize];
+
+    // The marker of the record's previous tag might still be queued
+    pthreads::waitFor(data_.signal,
+                      &(pTag.reached), 1);
+
+    pTag.id      = id;
+    pTag.time    = 0;
+    pTag.reached = 0;
+
+    PthreadLaunch_t &launch = pthreads::nextLaunch(data_);
+
+    launch.type = pthreadLaunch::marker;
+    launch.tag  = &pTag;
+
+    pthreads::pushLaunch(data_, stream, launch);
+
     streamTag ret;
 
     ret.tagTime = currentTime();
+    ret.handle  = (void*) id;
 
     return ret;
   }
 
   template <>
   double device_t<Pthreads>::timeBetween(const streamTag &startTag, const streamTag &endTag){
-    return (endTag.tagTime - startTag.tagTime);
+    OCCA_EXTRACT_DATA(Pthreads, Device);
+
+    waitFor(startTag);
+    waitFor(endTag);
+
+    PthreadTag_t *startPTag = pthreads::findTag(data_, startTag);
+    PthreadTag_t *endPTag   = pthreads::findTag(data_, endTag);
+
+    OCCA_CHECK((startPTag != NULL) && (endPTag != NULL),
+               "Pthreads tags are recycled after [" << pthreadTagPoolSize << "] newer tags,"
+               << " time them before that");
+
+    return (endPTag->time - startPTag->time);
   }
 
   template <>
@@ -1017,44 +1658,7 @@ namespace occa {
   void device_t<Pthreads>::cacheKernelInLibrary(const std::string &filename,
                                                 const std::string &functionName,
                                                 const kernelInfo &info_){
-#if 0
-    //---[ Creating shared library ]----
-    kernel tmpK = occa::device(this).buildKernelFromSource(filename, functionName, info_);
-    tmpK.free();
-
-    kernelInfo info = info_;
-
-    addOccaHeadersToInfo(info);
-
-    std::string cachedBinary = getCachedName(filename, getInfoSalt(info));
-
-#if (OCCA_OS & WINDOWS_OS)
-    // Windows requires .dll extension
-    cachedBinary = cachedBinary + ".dll";
-#endif
-    //==================================
-
-    library::infoID_t infoID;
-
-    infoID.modelID    = modelID_;
-    infoID.kernelName = functionName;
-
-    library::infoHeader_t &header = library::headerMap[infoID];
-
-    header.fileID = -1;
-    header.mode   = Pthreads;
-
-    const std::string flatDevID = getIdentifier().flattenFlagMap();
-
-    header.flagsOffset = library::addToScratchPad(flatDevID);
-    header.flagsBytes  = flatDevID.size();
-
-    header.contentOffset = library::addToScratchPad(cachedBinary);
-    header.contentBytes  = cachedBinary.size();
-
-    header.kernelNameOffset = library::addToScratchPad(functionName);
-    header.kernelNameBytes  = functionName.size();
-#endif
+    library::cacheCpuKernel(this, filename, functionName, info_);
   }
 
   template <>
@@ -1113,9 +1717,23 @@ namespace occa {
     mem->dHandle = this;
     mem->size    = bytes;
 
-    mem->handle = cpu::malloc(bytes);
+    int node;
+    const int placement = cpu::getMemPlacement(properties, node);
+
+    mem->handle = cpu::malloc(bytes, placement, node);
 
-    if(src != NULL)
+    if(placement == cpu::memPlacement::firstTouch){
+      OCCA_EXTRACT_DATA(Pthreads, Device);
+
+      PthreadStream_t &stream = *((PthreadStream_t*) currentStream);
+
+      // Workers touch (or copy in) the pages their static share uses
+      pthreads::enqueueCopy(data_, stream, mem->handle, src, bytes);
+
+      pthreads::waitFor(data_.signal,
+                        &(stream.finishedJobs), stream.launchedJobs);
+    }
+    else if(src != NULL)
       ::memcpy(mem->handle, src, bytes);
 
     return mem;
@@ -1169,8 +1787,30 @@ namespace occa {
 
     OCCA_EXTRACT_DATA(Pthreads, Device);
 
-    data_.pendingJobsMutex.free();
-    data_.kernelMutex.free();
+    // Empty jobs tell the workers to exit
+    for(int p = 0; p < data_.pThreadCount; ++p)
+      pthreads::pushJob(data_, p, data_.launchedJobs, NULL);
+
+    pthreads::notify(data_.signal);
+
+    for(int p = 0; p < data_.pThreadCount; ++p){
+#if (OCCA_OS & (LINUX_OS | OSX_OS))
+      pthread_join(data_.tid[p], NULL);
+#else
+      HANDLE thread = OpenThread(SYNCHRONIZE, FALSE, data_.tid[p]);
+      WaitForSingleObject(thread, INFINITE);
+      CloseHandle(thread);
+#endif
+      delete data_.workers[p];
+    }
+
+    for(int i = 0; i < pthreadRingSize; ++i)
+      delete [] data_.launches[i].ranges;
+
+    delete [] data_.tags;
+
+    data_.signal.mutex.free();
+    data_.signal.cond.free();
 
     delete (PthreadsDeviceData_t*) data;
   }
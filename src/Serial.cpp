@@ -4,6 +4,10 @@
 
 #include <strings.h>
 
+#if (OCCA_OS == LINUX_OS)
+#  include <sys/syscall.h>
+#endif
+
 namespace occa {
   //---[ Helper Functions ]-----------
   namespace cpu {
@@ -170,6 +174,119 @@ namespace occa {
 #endif
     }
 
+    void parseCpuList(const std::string &list, std::vector<int> &ids){
+      const char *c = list.c_str();
+
+      while(*c != '\0'){
+        if((*c < '0') || ('9' < *c)){
+          ++c;
+          continue;
+        }
+
+        char *next;
+
+        const int start = strtol(c, &next, 10);
+        int end         = start;
+
+        c = next;
+
+        if(*c == '-'){
+          end = strtol(c + 1, &next, 10);
+          c   = next;
+        }
+
+        for(int i = start; i <= end; ++i)
+          ids.push_back(i);
+      }
+    }
+
+    static std::string readSysFile(const std::string &filename){
+      std::ifstream fs(filename.c_str());
+      std::string content;
+
+      if(fs.is_open())
+        std::getline(fs, content);
+
+      return content;
+    }
+
+    void getTopology(std::vector<processorInfo_t> &procs){
+      procs.clear();
+
+#if (OCCA_OS & LINUX_OS)
+      const std::string cpuDir  = "/sys/devices/system/cpu/";
+      const std::string nodeDir = "/sys/devices/system/node/";
+
+      std::vector<int> ids;
+      parseCpuList(readSysFile(cpuDir + "online"), ids);
+
+      const int procCount = ids.size();
+
+      for(int i = 0; i < procCount; ++i){
+        std::stringstream topoDir;
+        topoDir << cpuDir << "cpu" << ids[i] << "/topology/";
+
+        const std::string core   = readSysFile(topoDir.str() + "core_id");
+        const std::string socket = readSysFile(topoDir.str() + "physical_package_id");
+
+        processorInfo_t proc;
+
+        proc.id       = ids[i];
+        proc.core     = (core.size()   ? atoi(core.c_str())   : ids[i]);
+        proc.socket   = (socket.size() ? atoi(socket.c_str()) : 0);
+        proc.numaNode = 0;
+        proc.smtIndex = 0;
+
+        procs.push_back(proc);
+      }
+
+      std::vector<int> nodes;
+      parseCpuList(readSysFile(nodeDir + "online"), nodes);
+
+      for(size_t n = 0; n < nodes.size(); ++n){
+        std::stringstream cpuList;
+        cpuList << nodeDir << "node" << nodes[n] << "/cpulist";
+
+        std::vector<int> nodeIds;
+        parseCpuList(readSysFile(cpuList.str()), nodeIds);
+
+        for(size_t i = 0; i < nodeIds.size(); ++i){
+          for(int p = 0; p < procCount; ++p){
+            if(procs[p].id == nodeIds[i])
+              procs[p].numaNode = nodes[n];
+          }
+        }
+      }
+
+      // Siblings share a (socket, core) pair, lower ids come first
+      for(int p = 0; p < procCount; ++p){
+        for(int q = 0; q < p; ++q){
+          if((procs[q].socket == procs[p].socket) &&
+             (procs[q].core   == procs[p].core)){
+            ++procs[p].smtIndex;
+          }
+        }
+      }
+
+      if(procCount)
+        return;
+#endif
+
+      const int coreCount = getCoreCount();
+
+      for(int p = 0; p < coreCount; ++p){
+        processorInfo_t proc;
+
+        proc.id       = p;
+        proc.core     = p;
+        proc.socket   = 0;
+        proc.numaNode = 0;
+        proc.smtIndex = 0;
+
+        procs.push_back(proc);
+      }
+    }
+
     int getCoreCount(){
 #if (OCCA_OS & (LINUX_OS | OSX_OS))
       return sysconf(_SC_NPROCESSORS_ONLN);
@@ -426,9 +543,7 @@ namespace occa {
                 readFile(env::OCCA_DIR + "/scripts/compilerVendorTest.cpp"),
                 "compilerVendorTest");
 
-      if(!haveHash(hash)){
-        waitForHash(hash);
-      } else {
+      if(haveHash(hash) || waitForHash(hash)) {
         if(!sys::fileExists(infoFilename)){
           ss << compiler
              << ' '
@@ -518,14 +633,19 @@ namespace occa {
     }
 
     void* malloc(uintptr_t bytes){
-      void* ptr;
+      void* ptr = NULL;
 
 #if   (OCCA_OS & (LINUX_OS | OSX_OS))
-      ignoreResult( posix_memalign(&ptr, env::OCCA_MEM_BYTE_ALIGN, bytes) );
+      const int error = posix_memalign(&ptr, env::OCCA_MEM_BYTE_ALIGN, bytes);
 #elif (OCCA_OS == WINDOWS_OS)
       ptr = ::malloc(bytes);
+
+      const int error = ((ptr == NULL) && bytes);
 #endif
 
+      OCCA_CHECK(error == 0,
+                 "Failed to allocate [" << bytes << "] bytes");
+
       return ptr;
     }
 
@@ -533,6 +653,125 @@ namespace occa {
       ::free(ptr);
     }
 
+    uintptr_t pageSize(){
+#if (OCCA_OS & (LINUX_OS | OSX_OS))
+      static const uintptr_t bytes = sysconf(_SC_PAGESIZE);
+#else
+      static const uintptr_t bytes = 4096;
+#endif
+      return bytes;
+    }
+
+    int getMemPlacement(argInfoMap &properties, int &node){
+      node = properties.iGet("memNode");
+
+      if(!properties.has("memPlacement"))
+        return memPlacement::none;
+
+      const std::string placement = properties.get("memPlacement");
+
+      if(placement == "firstTouch") return memPlacement::firstTouch;
+      if(placement == "interleave") return memPlacement::interleave;
+      if(placement == "node")       return memPlacement::bound;
+
+      OCCA_CHECK(placement == "none",
+                 "Memory placement [" << placement << "] is not available,"
+                 << " use [none], [firstTouch], [interleave] or [node]");
+
+      return memPlacement::none;
+    }
+
+    void* malloc(uintptr_t bytes,
+                 const int placement, const int node){
+
+      if(placement == memPlacement::none)
+        return malloc(bytes);
+
+      void* ptr = NULL;
+
+      // Policies work on whole pages
+      const uintptr_t page   = pageSize();
+      const uintptr_t bytes_ = (((bytes + page - 1) / page) * page);
+
+#if   (OCCA_OS & (LINUX_OS | OSX_OS))
+      const int error = posix_memalign(&ptr, page, bytes_);
+#elif (OCCA_OS == WINDOWS_OS)
+      // Policies are not applied on Windows, keep ::free() valid
+      ptr = ::malloc(bytes_);
+
+      const int error = ((ptr == NULL) && bytes_);
+#endif
+
+      OCCA_CHECK(error == 0,
+                 "Failed to allocate [" << bytes_ << "] page-aligned bytes");
+
+      setMemPolicy(ptr, bytes_, placement, node);
+
+      return ptr;
+    }
+
+    void setMemPolicy(void *ptr, uintptr_t bytes,
+                      const int placement, const int node){
+
+#if (OCCA_OS == LINUX_OS) && defined(SYS_mbind)
+      if((placement != memPlacement::interleave) &&
+         (placement != memPlacement::bound)){
+        return;
+      }
+
+      // From <linux/mempolicy.h>
+      const int mpolBind       = 2;
+      const int mpolInterleave = 3;
+      const int mpolMoveFlag   = (1 << 1);
+
+      const int maskBits = (8 * sizeof(unsigned long));
+      unsigned long nodeMask[16];
+
+      ::memset(nodeMask, 0, sizeof(nodeMask));
+
+      std::vector<int> nodes;
+
+      if(placement == memPlacement::bound){
+        nodes.push_back(node);
+      }
+      else{
+        std::ifstream fs("/sys/devices/system/node/online");
+        std::string online;
+
+        if(fs.is_open())
+          std::getline(fs, online);
+
+        parseCpuList(online, nodes);
+      }
+
+      for(size_t i = 0; i < nodes.size(); ++i){
+        if((0 <= nodes[i]) && (nodes[i] < (16 * maskBits)))
+          nodeMask[nodes[i] / maskBits] |= (1UL << (nodes[i] % maskBits));
+      }
+
+      const int mode = ((placement == memPlacement::bound) ? mpolBind : mpolInterleave);
+
+      if(syscall(SYS_mbind, ptr, bytes, mode, nodeMask, (16 * maskBits) + 1, mpolMoveFlag)){
+        std::cout << "[" << ((placement == memPlacement::bound) ? "node" : "interleave")
+                  << "] memory placement failed, keeping the default policy\n";
+      }
+#endif
+    }
+
+    void getPageRange(const uintptr_t bytes,
+                      const int rank, const int count,
+                      uintptr_t &start, uintptr_t &end){
+
+      const uintptr_t page  = pageSize();
+      const uintptr_t pages = ((bytes + page - 1) / page);
+
+      start = page * ((pages * rank)       / count);
+      end   = page * ((pages * (rank + 1)) / count);
+
+      if(bytes < start) start = bytes;
+      if(bytes < end)   end   = bytes;
+    }
+
     void* dlopen(const std::string &filename,
                  const std::string &hash){
 
@@ -591,6 +830,77 @@ namespace occa {
       return sym2;
     }
 
+    std::string libraryImageFilename(const char *cache){
+      static mutex_t imageMutex;
+      static std::map<std::string,std::string> imageFilenames;
+
+      uint64_t bytes;
+      ::memcpy(&bytes, cache, sizeof(uint64_t));
+
+      const char *image = (cache + sizeof(uint64_t));
+
+      hash_t hash;
+      hash.update(image, bytes);
+
+      const std::string digest = hash.digest();
+
+      imageMutex.lock();
+
+      std::string &filename = imageFilenames[digest];
+
+      if(filename.size()){
+        imageMutex.unlock();
+        return filename;
+      }
+
+#if (OCCA_OS & LINUX_OS) && defined(SYS_memfd_create)
+      // Anonymous in-memory file, nothing touches the disk
+      const int fd = syscall(SYS_memfd_create, digest.c_str(), 0);
+
+      if(fd != -1){
+        uint64_t written = 0;
+
+        while(written < bytes){
+          const ssize_t w = ::write(fd, image + written, bytes - written);
+
+          if(w <= 0)
+            break;
+
+          written += w;
+        }
+
+        if(written == bytes){
+          std::stringstream ss;
+          ss << "/proc/self/fd/" << fd;
+
+          filename = ss.str();
+        }
+        else
+          ::close(fd);
+      }
+#endif
+
+      if(filename.size() == 0){
+        filename = (env::OCCA_CACHE_DIR + "libraries/images/" + digest);
+
+#if (OCCA_OS & WINDOWS_OS)
+        // Windows requires .dll extension
+        filename += ".dll";
+#endif
+
+        if(!sys::fileExists(filename)){
+          sys::mkpath(getFileDirectory(filename));
+          writeToFile(filename, std::string(image, bytes), true);
+        }
+      }
+
+      const std::string ret = filename;
+
+      imageMutex.unlock();
+
+      return ret;
+    }
+
     void runFunction(handleFunction_t f,
                      const int *occaKernelInfoArgs,
                      int occaInnerId0, int occaInnerId1, int occaInnerId2,
@@ -688,15 +998,17 @@ namespace occa {
     binaryFilename = hashDir + fixBinaryName(kc::binaryFile);
     bool foundBinary = true;
 
-    if (!haveHash(hash, 0))
-      waitForHash(hash, 0);
-    else if (sys::fileExists(binaryFilename))
-      releaseHash(hash, 0);
-    else
-      foundBinary = false;
+    // Binaries are renamed into place, an existing one is complete
+    if (!sys::fileExists(binaryFilename) &&
+        (haveHash(hash, 0) || waitForHash(hash, 0))) {
+      if (sys::fileExists(binaryFilename))
+        releaseHash(hash, 0);
+      else
+        foundBinary = false;
+    }
 
     if (foundBinary) {
-      if(verboseCompilation_f)
+      if(info.showsCompilation())
         std::cout << "Found cached binary of [" << compressFilename(filename) << "] in [" << compressFilename(binaryFilename) << "]\n";
 
       return buildFromBinary(binaryFilename, functionName);
@@ -706,6 +1018,8 @@ namespace occa {
 
     createSourceFileFrom(filename, hashDir, info);
 
+    const std::string tmpBinaryFilename = sys::tmpFilename(binaryFilename);
+
     std::stringstream command;
 
     if(dHandle->compilerEnvScript.size())
@@ -716,7 +1030,7 @@ namespace occa {
             << ' '    << dHandle->compilerFlags
             << ' '    << info.flags
             << ' '    << sourceFilename
-            << " -o " << binaryFilename
+            << " -o " << tmpBinaryFilename
             << " -I"  << env::OCCA_DIR << "/include"
             << " -L"  << env::OCCA_DIR << "/lib -locca"
             << std::endl;
@@ -759,13 +1073,13 @@ namespace occa {
 #  if OCCA_OPENCL_ENABLED
             << " /link"  << clLib
 #  endif
-            << " /OUT:" << binaryFilename
+            << " /OUT:" << tmpBinaryFilename
             << std::endl;
 #endif
 
     const std::string &sCommand = command.str();
 
-    if(verboseCompilation_f)
+    if(info.showsCompilation())
       std::cout << "Compiling [" << functionName << "]\n" << sCommand << "\n";
 
 #if (OCCA_OS & (LINUX_OS | OSX_OS))
@@ -779,6 +1093,8 @@ namespace occa {
       OCCA_CHECK(false, "Compilation error");
     }
 
+    sys::rename(tmpBinaryFilename, binaryFilename);
+
     OCCA_EXTRACT_DATA(Serial, Kernel);
 
     data_.dlHandle = cpu::dlopen(binaryFilename, hash);
@@ -809,9 +1125,12 @@ namespace occa {
   template <>
   kernel_t<Serial>* kernel_t<Serial>::loadFromLibrary(const char *cache,
                                                       const std::string &functionName){
-    name = functionName;
+    buildFromBinary(cpu::libraryImageFilename(cache), functionName);
+
+    OCCA_CHECK(((SerialKernelData_t*) data)->handle != NULL,
+               "Kernel [" << functionName << "] is missing from its library image");
 
-    return buildFromBinary(cache, functionName);
+    return this;
   }
 
   template <>
@@ -851,6 +1170,26 @@ namespace occa {
                      argc, data_.vArgs);
   }
 
+  template <>
+  void kernel_t<Serial>::runFromBoundArguments(){
+    SerialKernelData_t &data_ = *((SerialKernelData_t*) data);
+    handleFunction_t tmpKernel = (handleFunction_t) data_.handle;
+    int occaKernelArgs[6];
+
+    occaKernelArgs[0] = outer.z; occaKernelArgs[3] = inner.z;
+    occaKernelArgs[1] = outer.y; occaKernelArgs[4] = inner.y;
+    occaKernelArgs[2] = outer.x; occaKernelArgs[5] = inner.x;
+
+    const int argc = (int) boundArgPtrs.size();
+
+    int occaInnerId0 = 0, occaInnerId1 = 0, occaInnerId2 = 0;
+
+    cpu::runFunction(tmpKernel,
+                     occaKernelArgs,
+                     occaInnerId0, occaInnerId1, occaInnerId2,
+                     argc, (argc ? &(boundArgPtrs[0]) : NULL));
+  }
+
   template <>
   void kernel_t<Serial>::free(){
     OCCA_EXTRACT_DATA(Serial, Kernel);
@@ -1408,56 +1747,16 @@ namespace occa {
   void device_t<Serial>::cacheKernelInLibrary(const std::string &filename,
                                               const std::string &functionName,
                                               const kernelInfo &info_){
-#if 0
-    //---[ Creating shared library ]----
-    kernel tmpK = occa::device(this).buildKernelFromSource(filename, functionName, info_);
-    tmpK.free();
-
-    kernelInfo info = info_;
-
-    addOccaHeadersToInfo(info);
-
-    std::string cachedBinary = getCachedName(filename, getInfoSalt(info));
-
-#if (OCCA_OS & WINDOWS_OS)
-    // Windows requires .dll extension
-    cachedBinary = cachedBinary + ".dll";
-#endif
-    //==================================
-
-    library::infoID_t infoID;
-
-    infoID.modelID    = modelID_;
-    infoID.kernelName = functionName;
-
-    library::infoHeader_t &header = library::headerMap[infoID];
-
-    header.fileID = -1;
-    header.mode   = Serial;
-
-    const std::string flatDevID = getIdentifier().flattenFlagMap();
-
-    header.flagsOffset = library::addToScratchPad(flatDevID);
-    header.flagsBytes  = flatDevID.size();
-
-    header.contentOffset = library::addToScratchPad(cachedBinary);
-    header.contentBytes  = cachedBinary.size();
-
-    header.kernelNameOffset = library::addToScratchPad(functionName);
-    header.kernelNameBytes  = functionName.size();
-#endif
+    library::cacheCpuKernel(this, filename, functionName, info_);
   }
 
   template <>
   kernel_v* device_t<Serial>::loadKernelFromLibrary(const char *cache,
                                                     const std::string &functionName){
-#if 0
     kernel_v *k = new kernel_t<Serial>;
     k->dHandle = this;
     k->loadFromLibrary(cache, functionName);
     return k;
-#endif
-    return NULL;
   }
 
   template <>
@@ -1507,7 +1806,14 @@ namespace occa {
     mem->dHandle = this;
     mem->size    = bytes;
 
-    mem->handle = cpu::malloc(bytes);
+    int node;
+    const int placement = cpu::getMemPlacement(properties, node);
+
+    // Only one thread runs Serial kernels, first-touch is just a touch
+    mem->handle = cpu::malloc(bytes, placement, node);
+
+    if((src == NULL) && (placement == cpu::memPlacement::firstTouch))
+      ::memset(mem->handle, 0, bytes);
 
     if(src != NULL)
       ::memcpy(mem->handle, src, bytes);
@@ -1,5 +1,11 @@
+#include <algorithm>
+#include <deque>
+#include <exception>
+#include <iomanip>
+
 #include "occa/base.hpp"
 #include "occa/library.hpp"
+#include "occa/miniLib.hpp"
 #include "occa/parser/parser.hpp"
 
 #include "occa/Serial.hpp"
@@ -84,7 +90,7 @@ namespace occa {
   //==============================================
 
   //---[ Globals & Flags ]------------------------
-  const int parserVersion = 100;
+  const int parserVersion = 101;
 
   kernelInfo defaultKernelInfo;
 
@@ -99,6 +105,14 @@ namespace occa {
     verboseCompilation_f = value;
   }
 
+  namespace asyncBuild {
+    extern int maxBuilders;
+  }
+
+  void setMaxConcurrentBuilds(const int count) {
+    asyncBuild::maxBuilders = count;
+  }
+
   namespace flags {
     const int checkCacheDir = (1 << 0);
   }
@@ -505,7 +519,12 @@ namespace occa {
          (info != "chunk")       &&
          (info != "threadCount") &&
          (info != "schedule")    &&
-         (info != "pinnedCores")) {
+         (info != "pinnedCores") &&
+         (info != "spinTime")    &&
+         (info != "loopSchedule") &&
+         (info != "chunkSize")   &&
+         (info != "memPlacement") &&
+         (info != "memNode")) {
 
         std::cout << "Flag [" << info << "] is not available, skipping it\n";
         continue;
@@ -546,18 +565,34 @@ namespace occa {
   kernelInfo::kernelInfo() :
     mode(NoMode),
     header(""),
-    flags("") {}
+    flags(""),
+    specializedInnerDims(false),
+    maxSpecializations(8),
+    quietCompilation(false) {}
 
   kernelInfo::kernelInfo(const kernelInfo &p) :
     mode(p.mode),
     header(p.header),
-    flags(p.flags) {}
+    flags(p.flags),
+    parserFlags(p.parserFlags),
+    specializedArgs(p.specializedArgs),
+    specializedInnerDims(p.specializedInnerDims),
+    maxSpecializations(p.maxSpecializations),
+    quietCompilation(p.quietCompilation) {}
 
   kernelInfo& kernelInfo::operator = (const kernelInfo &p) {
     mode   = p.mode;
     header = p.header;
     flags  = p.flags;
 
+    parserFlags = p.parserFlags;
+
+    specializedArgs      = p.specializedArgs;
+    specializedInnerDims = p.specializedInnerDims;
+    maxSpecializations   = p.maxSpecializations;
+
+    quietCompilation = p.quietCompilation;
+
     return *this;
   }
 
@@ -565,20 +600,59 @@ namespace occa {
     header += p.header;
     flags  += p.flags;
 
+    for(int i = 0; i < (int) p.specializedArgs.size(); ++i)
+      specializeArgument(p.specializedArgs[i]);
+
+    specializedInnerDims |= p.specializedInnerDims;
+    quietCompilation     |= p.quietCompilation;
+
     return *this;
   }
 
   std::string kernelInfo::salt() const {
-    return (header + flags);
+    std::string ret = (header + flags);
+
+    cStrToStrMapIterator it = parserFlags.flags.begin();
+
+    while(it != parserFlags.flags.end()) {
+      ret += it->first;
+      ret += '=';
+      ret += it->second;
+      ret += '\n';
+
+      ++it;
+    }
+
+    // Cached OCCA headers are named after their contents, binaries
+    //   built against other headers get a different hash
+    ret += getModeHeaderFilename();
+    ret += '\n';
+
+    // Specialized kernels carry variants, keep them apart from plain ones
+    if(hasSpecializations()) {
+      std::stringstream ss;
+
+      ss << "specialize =";
+
+      for(int i = 0; i < (int) specializedArgs.size(); ++i)
+        ss << ' ' << specializedArgs[i];
+
+      ss << (specializedInnerDims ? " innerDims" : "")
+         << " max " << maxSpecializations << '\n';
+
+      ret += ss.str();
+    }
+
+    return ret;
   }
 
   std::string kernelInfo::getModeHeaderFilename() const {
-    if(mode & Serial)   return sys::getFilename("[occa]/defines/Serial.hpp");
-    if(mode & OpenMP)   return sys::getFilename("[occa]/defines/OpenMP.hpp");
-    if(mode & OpenCL)   return sys::getFilename("[occa]/defines/OpenCL.hpp");
-    if(mode & CUDA)     return sys::getFilename("[occa]/defines/CUDA.hpp");
-    if(mode & HSA)      return sys::getFilename("[occa]/defines/HSA.hpp");
-    if(mode & Pthreads) return sys::getFilename("[occa]/defines/Pthreads.hpp");
+    if(mode & Serial)   return getCachedOccaHeader("Serial.hpp", "defines/Serial");
+    if(mode & OpenMP)   return getCachedOccaHeader("OpenMP.hpp", "defines/OpenMP");
+    if(mode & OpenCL)   return getCachedOccaHeader("OpenCL.hpp", "defines/OpenCL");
+    if(mode & CUDA)     return getCachedOccaHeader("CUDA.hpp", "defines/CUDA");
+    if(mode & HSA)      return getCachedOccaHeader("HSA.hpp", "defines/HSA");
+    if(mode & Pthreads) return getCachedOccaHeader("Pthreads.hpp", "defines/Pthreads");
 
     return "";
   }
@@ -652,6 +726,39 @@ namespace occa {
     parserFlags[flag] = value;
   }
 
+  void kernelInfo::specializeArgument(const int argPos) {
+    OCCA_CHECK((0 <= argPos) && (argPos < OCCA_MAX_ARGS),
+               "Kernels can only have at most [" << OCCA_MAX_ARGS << "] arguments,"
+               << " argument [" << argPos << "] was specialized");
+
+    for(int i = 0; i < (int) specializedArgs.size(); ++i) {
+      if(specializedArgs[i] == argPos)
+        return;
+    }
+
+    specializedArgs.push_back(argPos);
+  }
+
+  void kernelInfo::specializeInnerDims() {
+    specializedInnerDims = true;
+  }
+
+  void kernelInfo::setMaxSpecializations(const int count) {
+    maxSpecializations = count;
+  }
+
+  bool kernelInfo::hasSpecializations() const {
+    return (specializedArgs.size() || specializedInnerDims);
+  }
+
+  void kernelInfo::hideCompilation() {
+    quietCompilation = true;
+  }
+
+  bool kernelInfo::showsCompilation() const {
+    return (verboseCompilation_f && !quietCompilation);
+  }
+
   template <>
   void kernelInfo::addDefine(const std::string &macro, const std::string &value) {
     std::stringstream ss;
@@ -733,6 +840,508 @@ namespace occa {
   }
   //==============================================
 
+  //---[ Kernel Memo ]----------------------------
+  namespace kernelMemo {
+    // Enough to load a built kernel again, every hit gets its own handle
+    //   and only the compiled binaries are shared
+    struct entry_t {
+      int deviceID;
+
+      double mtime;
+      uintptr_t bytes;
+
+      std::string parsedFilename;
+      std::string binaryFilename, nestedBinaryFilename;
+
+      parsedKernelInfo metaInfo;
+    };
+
+    static mutex_t mutex;
+
+    static std::map<std::string, entry_t> entries;
+
+    static kernelMemoStats_t stats = {0, 0, 0};
+
+    static std::string keyFor(const int deviceID,
+                              const std::string &filename,
+                              const std::string &functionName,
+                              const std::string &salt) {
+      std::stringstream ss;
+
+      ss << deviceID << '\n'
+         << filename << '\n'
+         << functionName << '\n'
+         << salt;
+
+      return ss.str();
+    }
+
+    static bool fileStats(const std::string &filename,
+                          double &mtime,
+                          uintptr_t &bytes) {
+      struct stat statInfo;
+
+      if(stat(filename.c_str(), &statInfo) != 0)
+        return false;
+
+#if (OCCA_OS == LINUX_OS)
+      mtime = statInfo.st_mtim.tv_sec + (1.0e-9 * statInfo.st_mtim.tv_nsec);
+#else
+      mtime = statInfo.st_mtime;
+#endif
+      bytes = statInfo.st_size;
+
+      return true;
+    }
+
+    // Copies the entry for [key] into [entry], returns false on a miss
+    static bool find(const std::string &key,
+                     const double mtime,
+                     const uintptr_t bytes,
+                     entry_t &entry) {
+      bool found = false;
+
+      mutex.lock();
+
+      std::map<std::string, entry_t>::iterator it = entries.find(key);
+
+      if(it == entries.end()) {
+        ++stats.misses;
+      }
+      else if((it->second.mtime != mtime) ||
+              (it->second.bytes != bytes)) {
+        entries.erase(it);
+
+        ++stats.misses;
+        ++stats.invalidated;
+      }
+      else {
+        entry = it->second;
+        found = true;
+
+        ++stats.hits;
+      }
+
+      mutex.unlock();
+
+      return found;
+    }
+
+    static void store(const std::string &key,
+                      const entry_t &entry) {
+      mutex.lock();
+
+      // Concurrent builds of the same kernel keep the first one
+      if(entries.find(key) == entries.end())
+        entries[key] = entry;
+
+      mutex.unlock();
+    }
+
+    static void forgetDevice(const int deviceID) {
+      mutex.lock();
+
+      std::map<std::string, entry_t>::iterator it = entries.begin();
+
+      while(it != entries.end()) {
+        if(it->second.deviceID == deviceID)
+          entries.erase(it++);
+        else
+          ++it;
+      }
+
+      mutex.unlock();
+    }
+  }
+
+  kernelMemoStats_t getKernelMemoStats() {
+    kernelMemo::mutex.lock();
+    const kernelMemoStats_t ret = kernelMemo::stats;
+    kernelMemo::mutex.unlock();
+
+    return ret;
+  }
+  //==============================================
+
+
+  //---[ Async Builds ]---------------------------
+  struct kernelBuild_t {
+    int deviceID;
+    occa::device device;
+
+    std::string filename, functionName;
+    kernelInfo info;
+
+    kernel_v *kHandle;
+    bool finished, failed;
+    std::string error;
+
+    // Held by the builder and every kernel still waiting on it
+    int refs;
+  };
+
+  namespace asyncBuild {
+    int maxBuilders = 0;
+
+    static mutex_t mutex;
+    static condition_t finishedCond;
+
+    static std::deque<kernelBuild_t*> queue;
+    static std::vector<kernelBuild_t*> builds;
+
+    static int activeBuilders = 0;
+
+    // Thrown by failCheck() on builder threads
+    struct failure_t {};
+
+#if (OCCA_OS & (LINUX_OS | OSX_OS))
+    static pthread_key_t builderKey;
+#else
+    static DWORD builderKey;
+#endif
+
+    static bool createBuilderKey() {
+#if (OCCA_OS & (LINUX_OS | OSX_OS))
+      pthread_key_create(&builderKey, NULL);
+#else
+      builderKey = TlsAlloc();
+#endif
+      return true;
+    }
+
+    static const bool builderKeyCreated = createBuilderKey();
+
+    static bool onBuilderThread() {
+#if (OCCA_OS & (LINUX_OS | OSX_OS))
+      return (builderKeyCreated && (pthread_getspecific(builderKey) != NULL));
+#else
+      return (builderKeyCreated && (TlsGetValue(builderKey) != NULL));
+#endif
+    }
+
+    // Expects [mutex] to be locked
+    static void release(kernelBuild_t *build) {
+      if(--(build->refs) == 0)
+        delete build;
+    }
+
+    static int builderCount() {
+      int count = maxBuilders;
+
+      if(count <= 0)
+        count = env::OCCA_MAX_BUILDS;
+
+      if(count <= 0)
+        count = cpu::getCoreCount();
+
+      return ((count <= 0) ? 1 : count);
+    }
+
+    // Builders exit once the queue is empty
+    static void builderLoop() {
+      mutex.lock();
+
+      while(queue.size()) {
+        kernelBuild_t &build = *(queue.front());
+        queue.pop_front();
+
+        mutex.unlock();
+
+        kernel k;
+        std::string error;
+        bool failed = false;
+
+        try {
+          k = build.device.buildKernelFromSource(build.filename,
+                                                 build.functionName,
+                                                 build.info);
+        }
+        catch(failure_t &) {
+          failed = true;
+          error  = "see the error printed above";
+        }
+        catch(std::exception &e) {
+          failed = true;
+          error  = e.what();
+        }
+        catch(...) {
+          failed = true;
+          error  = "unknown exception";
+        }
+
+        mutex.lock();
+
+        build.kHandle  = (failed ? NULL : k.getKHandle());
+        build.failed   = failed;
+        build.error    = error;
+        build.finished = true;
+
+        builds.erase(std::find(builds.begin(), builds.end(), &build));
+        release(&build);
+
+        finishedCond.broadcast();
+      }
+
+      --activeBuilders;
+
+      mutex.unlock();
+    }
+
+#if (OCCA_OS & (LINUX_OS | OSX_OS))
+    static void* builderThread(void *) {
+      pthread_setspecific(builderKey, (void*) &builderKey);
+      builderLoop();
+      return NULL;
+    }
+#else
+    static DWORD WINAPI builderThread(LPVOID) {
+      TlsSetValue(builderKey, (LPVOID) &builderKey);
+      builderLoop();
+      return 0;
+    }
+#endif
+
+    static void spawnBuilder() {
+#if (OCCA_OS & (LINUX_OS | OSX_OS))
+      pthread_t thread;
+
+      int error = pthread_create(&thread, NULL, builderThread, NULL);
+
+      OCCA_CHECK(error == 0,
+                 "Error creating kernel build thread");
+
+      pthread_detach(thread);
+#else
+      HANDLE thread = CreateThread(NULL, 0, builderThread, NULL, 0, NULL);
+
+      OCCA_CHECK(thread != NULL,
+                 "Error creating kernel build thread");
+
+      CloseHandle(thread);
+#endif
+    }
+
+    static void submit(kernelBuild_t *build) {
+      mutex.lock();
+
+      builds.push_back(build);
+      queue.push_back(build);
+
+      const bool needsBuilder = (activeBuilders < builderCount());
+
+      if(needsBuilder)
+        ++activeBuilders;
+
+      mutex.unlock();
+
+      if(needsBuilder)
+        spawnBuilder();
+    }
+
+    static bool isFinished(kernelBuild_t *build) {
+      mutex.lock();
+      const bool finished = build->finished;
+      mutex.unlock();
+
+      return finished;
+    }
+
+    static void retain(kernelBuild_t *build) {
+      mutex.lock();
+      ++(build->refs);
+      mutex.unlock();
+    }
+
+    static void drop(kernelBuild_t *build) {
+      mutex.lock();
+      release(build);
+      mutex.unlock();
+    }
+
+    // Drops the caller's reference, [error] is set if the build failed
+    static kernel_v* wait(kernelBuild_t *build,
+                          std::string &error) {
+      mutex.lock();
+
+      while(!build->finished)
+        finishedCond.wait(mutex);
+
+      kernel_v *kHandle = build->kHandle;
+      error = build->error;
+
+      release(build);
+
+      mutex.unlock();
+
+      return kHandle;
+    }
+
+    // Builds are owned by their kernels, the device only waits
+    //   for its pending builds to finish
+    static void forgetDevice(const int deviceID) {
+      mutex.lock();
+
+      bool pending = true;
+
+      while(pending) {
+        pending = false;
+
+        for(int i = 0; i < (int) builds.size(); ++i) {
+          if(builds[i]->deviceID == deviceID) {
+            pending = true;
+            break;
+          }
+        }
+
+        if(pending)
+          finishedCond.wait(mutex);
+      }
+
+      mutex.unlock();
+    }
+  }
+
+  void failCheck() {
+    if(asyncBuild::onBuilderThread())
+      throw asyncBuild::failure_t();
+
+    abort();
+  }
+
+  // The parser keeps global state, only the compilation runs concurrently
+  static mutex_t parserMutex;
+  //==============================================
+
+  //---[ Kernel Specialization ]------------------
+  struct kernelSpecialization_t {
+    occa::device_v *dHandle;
+
+    std::string filename, functionName;
+
+    // Variants build with [info] and the specialized values
+    kernelInfo info;
+
+    // Parsed kernels bake in arguments, kernels running the
+    //   occaInnerFor loops bake in inner dims
+    std::vector<int> argPositions;
+    bool innerDims;
+
+    std::vector<std::string> keys;
+    std::vector<kernel> variants;
+  };
+
+  void kernel_v::setupSpecialization(device_v *dHandle_,
+                                     const std::string &filename,
+                                     const std::string &functionName,
+                                     const kernelInfo &info,
+                                     const bool usesArgs) {
+    const bool usesInnerDims = !usesArgs;
+
+    if((usesArgs      && info.specializedArgs.empty()) ||
+       (usesInnerDims && !info.specializedInnerDims)) {
+
+      return;
+    }
+
+    spec = new kernelSpecialization_t;
+
+    spec->dHandle      = dHandle_;
+    spec->filename     = filename;
+    spec->functionName = functionName;
+    spec->info         = info;
+    spec->innerDims    = usesInnerDims;
+
+    if(usesArgs)
+      spec->argPositions = info.specializedArgs;
+
+    // Nested kernels of argument variants still specialize inner dims
+    spec->info.specializedArgs.clear();
+
+    if(usesInnerDims)
+      spec->info.specializedInnerDims = false;
+  }
+
+  kernel_v* kernel_v::specializedVariant() {
+    kernelInfo info = spec->info;
+
+    std::stringstream key;
+
+    const int argCount = (int) spec->argPositions.size();
+
+    for(int i = 0; i < argCount; ++i) {
+      const int argPos = spec->argPositions[i];
+
+      if((int) arguments.size() <= argPos)
+        return NULL;
+
+      const kernelArg_t &arg = arguments[argPos].args[0];
+
+      // Only scalars are baked in
+      if((arguments[argPos].argc != 1) ||
+         (arg.mHandle != NULL)         ||
+         (arg.size == 0) || (8 < arg.size)) {
+
+        continue;
+      }
+
+      const unsigned char *bytes = (const unsigned char*) arg.ptr();
+
+      std::stringstream value;
+      value << std::hex << std::setfill('0');
+
+      for(uintptr_t b = 0; b < arg.size; ++b)
+        value << std::setw(2) << (int) bytes[b];
+
+      key << argPos << '=' << value.str() << ' ';
+
+      std::stringstream flag;
+      flag << "specialize-" << spec->functionName << '-' << argPos;
+
+      info.addParserFlag(flag.str(), value.str());
+    }
+
+    if(spec->innerDims) {
+      key << "inner=" << inner.x << ',' << inner.y << ',' << inner.z;
+
+      info.addDefine("occaInnerDim0", inner.x);
+      info.addDefine("occaInnerDim1", inner.y);
+      info.addDefine("occaInnerDim2", inner.z);
+    }
+
+    const std::string keyStr = key.str();
+    const int variantCount   = (int) spec->keys.size();
+
+    for(int i = 0; i < variantCount; ++i) {
+      if(spec->keys[i] == keyStr)
+        return spec->variants[i].getKHandle();
+    }
+
+    if(spec->info.maxSpecializations <= variantCount)
+      return NULL;
+
+    occa::device device(spec->dHandle);
+
+    kernel variant = device.buildKernelFromSource(spec->filename,
+                                                  spec->functionName,
+                                                  info);
+
+    variant.getKHandle()->metaInfo = metaInfo;
+
+    spec->keys.push_back(keyStr);
+    spec->variants.push_back(variant);
+
+    return variant.getKHandle();
+  }
+
+  void kernel_v::freeSpecialization() {
+    for(int i = 0; i < (int) spec->variants.size(); ++i)
+      spec->variants[i].free();
+
+    delete spec;
+    spec = NULL;
+  }
+  //==============================================
+
   //---[ Kernel ]---------------------------------
   kernel* kernel_v::nestedKernelsPtr() {
     return &(nestedKernels[0]);
@@ -750,25 +1359,105 @@ namespace occa {
     return (int) arguments.size();
   }
 
+  void kernel_v::packBoundArguments() {
+    const int offset = (nestedKernelCount() ? 1 : 0);
+
+    if(offset) {
+      if(boundArguments.empty())
+        boundArguments.resize(1);
+
+      boundArguments[0] = kernelArg(nestedKernelsPtr());
+    }
+
+    const int kArgc = (int) boundArguments.size();
+
+    boundArgChanged.resize(kArgc, true);
+    boundArgOffsets.resize(kArgc);
+    boundArgPtrs.clear();
+
+    for(int i = 0; i < kArgc; ++i) {
+      const kernelArg &arg = boundArguments[i];
+
+      OCCA_CHECK(0 < arg.argc,
+                 "Kernel [" << name << "] : Argument [" << (i - offset) << "] was not set");
+
+      boundArgOffsets[i] = (int) boundArgPtrs.size();
+
+      for(int j = 0; j < arg.argc; ++j)
+        boundArgPtrs.push_back(arg.args[j].ptr());
+    }
+
+    boundArgsPacked = true;
+  }
+
+  void kernel_v::markBoundArgumentsChanged() {
+    const int kArgc = (int) boundArgChanged.size();
+
+    for(int i = 0; i < kArgc; ++i)
+      boundArgChanged[i] = true;
+  }
+
   kernel::kernel() :
-    kHandle(NULL) {}
+    kHandle(NULL),
+    bHandle(NULL) {}
 
   kernel::kernel(kernel_v *kHandle_) :
-    kHandle(kHandle_) {}
+    kHandle(kHandle_),
+    bHandle(NULL) {}
 
   kernel::kernel(const kernel &k) :
-    kHandle(k.kHandle) {}
+    kHandle(k.kHandle),
+    bHandle(k.bHandle) {
+
+    if(bHandle != NULL)
+      asyncBuild::retain(bHandle);
+  }
 
   kernel& kernel::operator = (const kernel &k) {
+    if(k.bHandle != NULL)
+      asyncBuild::retain(k.bHandle);
+
+    if(bHandle != NULL)
+      asyncBuild::drop(bHandle);
+
     kHandle = k.kHandle;
+    bHandle = k.bHandle;
     return *this;
   }
 
   void kernel::checkIfInitialized() const {
+    if(bHandle != NULL)
+      waitForBuild();
+
     OCCA_CHECK(kHandle != NULL,
                "Kernel is not initialized");
   }
 
+  bool kernel::isReady() {
+    if(bHandle == NULL)
+      return (kHandle != NULL);
+
+    return asyncBuild::isFinished(bHandle);
+  }
+
+  void kernel::waitForBuild() const {
+    if(bHandle == NULL)
+      return;
+
+    std::string error;
+
+    kHandle = asyncBuild::wait(bHandle, error);
+    bHandle = NULL;
+
+    OCCA_CHECK(kHandle != NULL,
+               "Async kernel build failed: " << error);
+  }
+
+  double kernel::buildTime() {
+    checkIfInitialized();
+    return kHandle->buildTime_;
+  }
+
   void* kernel::getKernelHandle() {
     checkIfInitialized();
     return kHandle->getKernelHandle();
@@ -867,6 +1556,23 @@ namespace occa {
   void kernel::runFromArguments() {
     checkIfInitialized();
 
+    if(kHandle->spec) {
+      kernel_v *variant = kHandle->specializedVariant();
+
+      if(variant) {
+        variant->arguments.swap(kHandle->arguments);
+
+        variant->dims  = kHandle->dims;
+        variant->inner = kHandle->inner;
+        variant->outer = kHandle->outer;
+
+        kernel(variant).runFromArguments();
+
+        variant->arguments.swap(kHandle->arguments);
+        return;
+      }
+    }
+
     for (int i = 0; i < (int) kHandle->arguments.size(); ++i) {
       const bool argIsConst = kHandle->metaInfo.argIsConst(i);
       kHandle->arguments[i].setupForKernelCall(argIsConst);
@@ -884,6 +1590,77 @@ namespace occa {
     // Remove nestedKernels
     if (kHandle->nestedKernelCount())
       kHandle->arguments.erase(kHandle->arguments.begin());
+
+    // Backends that keep arguments set (OpenCL) were overwritten
+    if (kHandle->boundArguments.size())
+      kHandle->markBoundArgumentsChanged();
+  }
+
+  void kernel::setArgument(const int argPos,
+                           const kernelArg &arg) {
+    checkIfInitialized();
+
+    OCCA_CHECK((0 <= argPos) && (argPos < OCCA_MAX_ARGS),
+               "Kernels can only have at most [" << OCCA_MAX_ARGS << "] arguments,"
+               << " argument [" << argPos << "] was set");
+
+    kernel_v &k = *kHandle;
+
+    const int offset = (k.nestedKernelCount() ? 1 : 0);
+    const int pos    = (argPos + offset);
+
+    if((int) k.boundArguments.size() <= pos) {
+      // Growing moves the stored arguments
+      k.boundArguments.resize(pos + 1);
+      k.boundArgChanged.resize(pos + 1, true);
+      k.boundArgsPacked = false;
+    }
+
+    kernelArg &bArg = k.boundArguments[pos];
+
+    if(bArg.argc != arg.argc)
+      k.boundArgsPacked = false;
+
+    bArg = arg;
+    k.boundArgChanged[pos] = true;
+
+    // Only repack this argument's pointers
+    if(k.boundArgsPacked) {
+      const int ptrOffset = k.boundArgOffsets[pos];
+
+      for(int j = 0; j < bArg.argc; ++j)
+        k.boundArgPtrs[ptrOffset + j] = bArg.args[j].ptr();
+    }
+  }
+
+  void kernel::launch() {
+    checkIfInitialized();
+
+    kernel_v &k = *kHandle;
+
+    const int offset = (k.nestedKernelCount() ? 1 : 0);
+    const int kArgc  = (int) k.boundArguments.size();
+
+    // Variants are picked from the argument values
+    if(k.spec) {
+      k.arguments.clear();
+
+      for(int i = offset; i < kArgc; ++i)
+        k.arguments.push_back(k.boundArguments[i]);
+
+      runFromArguments();
+      return;
+    }
+
+    for(int i = offset; i < kArgc; ++i) {
+      const bool argIsConst = k.metaInfo.argIsConst(i - offset);
+      k.boundArguments[i].setupForKernelCall(argIsConst);
+    }
+
+    if(!k.boundArgsPacked)
+      k.packBoundArguments();
+
+    k.runFromBoundArguments();
   }
 
 #include "operators/definitions.cpp"
@@ -896,6 +1673,9 @@ namespace occa {
         kHandle->nestedKernels[k].free();
     }
 
+    if(kHandle->spec)
+      kHandle->freeSpecialization();
+
     kHandle->free();
 
     delete kHandle;
@@ -2013,8 +2793,7 @@ namespace occa {
     else
       sourceFilename += "stringSource.occa";
 
-    if(!haveHash(hash, 1)) {
-      waitForHash(hash, 1);
+    if(!haveHash(hash, 1) && !waitForHash(hash, 1)) {
       return buildKernelFromBinary(hashDir + dHandle->fixBinaryName(kc::binaryFile),
                                    functionName);
     }
@@ -2033,96 +2812,279 @@ namespace occa {
   kernel device::buildKernelFromSource(const std::string &filename,
                                        const std::string &functionName,
                                        const kernelInfo &info_) {
+
+    return buildKernelsFromSource(filename,
+                                  std::vector<std::string>(1, functionName),
+                                  info_)[0];
+  }
+
+  std::vector<kernel> device::buildKernelsFromSource(const std::string &filename,
+                                                     const std::vector<std::string> &functionNames,
+                                                     const kernelInfo &info_) {
     checkIfInitialized();
 
+    const int kernelCount = (int) functionNames.size();
+
+    std::vector<kernel> kernels(kernelCount);
+
     const std::string sourceFilename = sys::getFilename(filename);
+    const std::string infoSalt       = dHandle->getInfoSalt(info_);
+
+    double mtime    = 0;
+    uintptr_t bytes = 0;
+
+    const bool memoizable = kernelMemo::fileStats(sourceFilename, mtime, bytes);
+
     const bool usingParser = fileNeedsParser(filename);
 
-    kernel ker;
+    // Every kernel comes from the same source, so only the first one
+    //   compiles and the rest load its binary. Memoized kernels already
+    //   know the binaries and skip the parser.
+    std::string parsedFile, launchBinary, nestedBinary;
+
+    std::vector<std::string> memoKeys(kernelCount);
+    std::vector<parsedKernelInfo> metaInfos(kernelCount);
+    std::vector<int> toParse;
+
+    for(int i = 0; i < kernelCount; ++i) {
+      memoKeys[i] = kernelMemo::keyFor(dHandle->id_,
+                                       sourceFilename,
+                                       functionNames[i],
+                                       infoSalt);
 
-    kernel_v *&k = ker.kHandle;
+      kernelMemo::entry_t entry;
+
+      if(memoizable &&
+         kernelMemo::find(memoKeys[i], mtime, bytes, entry)) {
+
+        parsedFile   = entry.parsedFilename;
+        launchBinary = entry.binaryFilename;
+        metaInfos[i] = entry.metaInfo;
+
+        if(entry.nestedBinaryFilename.size())
+          nestedBinary = entry.nestedBinaryFilename;
+      }
+      else
+        toParse.push_back(i);
+    }
+
+    const int parseCount = (int) toParse.size();
+
+    double startTime = currentTime();
 
     if(usingParser) {
+      if(parseCount) {
+        const std::string hash = getFileContentHash(sourceFilename, infoSalt);
+
+        const std::string hashDir = hashDirFor(sourceFilename, hash);
+        parsedFile                = hashDir + "parsedSource.occa";
+
+        std::vector<std::string> parseNames(parseCount);
+
+        for(int b = 0; b < parseCount; ++b)
+          parseNames[b] = functionNames[toParse[b]];
+
+        std::vector<parsedKernelInfo> parsedInfos;
+
+        parserMutex.lock();
+
+        // Failed async builds throw through here
+        try {
+          parsedInfos = parseFileForFunctions(mode(),
+                                              sourceFilename,
+                                              parsedFile,
+                                              parseNames,
+                                              info_);
+        }
+        catch(...) {
+          parserMutex.unlock();
+          throw;
+        }
+
+        parserMutex.unlock();
+
+        for(int b = 0; b < parseCount; ++b)
+          metaInfos[toParse[b]] = parsedInfos[b];
+      }
+
+      kernelInfo info = defaultKernelInfo;
+      info.addDefine("OCCA_LAUNCH_KERNEL", 1);
+
+      info.quietCompilation = info_.quietCompilation;
+
+      for(int i = 0; i < kernelCount; ++i) {
+        const std::string &functionName = functionNames[i];
+
+        kernel_v *&k = kernels[i].kHandle;
+
 #if OCCA_OPENMP_ENABLED
-      if(dHandle->mode() != OpenMP) {
+        if(dHandle->mode() != OpenMP) {
+          k          = new kernel_t<Serial>;
+          k->dHandle = new device_t<Serial>;
+        }
+        else {
+          k          = new kernel_t<OpenMP>;
+          k->dHandle = dHandle;
+        }
+#else
         k          = new kernel_t<Serial>;
         k->dHandle = new device_t<Serial>;
-      }
-      else {
-        k          = new kernel_t<OpenMP>;
-        k->dHandle = dHandle;
-      }
-#else
-      k          = new kernel_t<Serial>;
-      k->dHandle = new device_t<Serial>;
 #endif
 
-      const std::string hash = getFileContentHash(sourceFilename,
-                                                  dHandle->getInfoSalt(info_));
+        k->metaInfo = metaInfos[i];
 
-      const std::string hashDir    = hashDirFor(sourceFilename, hash);
-      const std::string parsedFile = hashDir + "parsedSource.occa";
+        if(launchBinary.size() == 0) {
+          k->buildFromSource(parsedFile, functionName, info);
+          launchBinary = k->binaryFilename;
+        }
+        else {
+          k->buildFromBinary(launchBinary, functionName);
+        }
 
-      k->metaInfo = parseFileForFunction(mode(),
-                                         sourceFilename,
-                                         parsedFile,
-                                         functionName,
-                                         info_);
+        k->nestedKernels.clear();
 
-      kernelInfo info = defaultKernelInfo;
-      info.addDefine("OCCA_LAUNCH_KERNEL", 1);
+        if (k->metaInfo.nestedKernels) {
+          std::stringstream ss;
 
-      k->buildFromSource(parsedFile, functionName, info);
-      k->nestedKernels.clear();
+          kernelInfo nestedInfo = info_;
 
-      if (k->metaInfo.nestedKernels) {
-        std::stringstream ss;
+          for(int ki = 0; ki < k->metaInfo.nestedKernels; ++ki) {
+            ss << ki;
 
-        const int vc_f = verboseCompilation_f;
+            const std::string sKerName = k->metaInfo.baseName + ss.str();
 
-        for(int ki = 0; ki < k->metaInfo.nestedKernels; ++ki) {
-          ss << ki;
+            ss.str("");
 
-          const std::string sKerName = k->metaInfo.baseName + ss.str();
+            kernel sKer;
 
-          ss.str("");
+            if(nestedBinary.size() == 0) {
+              sKer.kHandle = dHandle->buildKernelFromSource(parsedFile,
+                                                            sKerName,
+                                                            nestedInfo);
+              nestedBinary = sKer.kHandle->binaryFilename;
+            }
+            else {
+              sKer.kHandle = dHandle->buildKernelFromBinary(nestedBinary,
+                                                            sKerName);
+            }
 
-          kernel sKer;
-          sKer.kHandle = dHandle->buildKernelFromSource(parsedFile,
-                                                        sKerName,
-                                                        info_);
+            sKer.kHandle->metaInfo               = k->metaInfo;
+            sKer.kHandle->metaInfo.name          = sKerName;
+            sKer.kHandle->metaInfo.nestedKernels = 0;
+            sKer.kHandle->metaInfo.removeArg(0); // remove nestedKernels **
+            k->nestedKernels.push_back(sKer);
 
-          sKer.kHandle->metaInfo               = k->metaInfo;
-          sKer.kHandle->metaInfo.name          = sKerName;
-          sKer.kHandle->metaInfo.nestedKernels = 0;
-          sKer.kHandle->metaInfo.removeArg(0); // remove nestedKernels **
-          k->nestedKernels.push_back(sKer);
+            sKer.kHandle->setupSpecialization(dHandle,
+                                              parsedFile, sKerName, nestedInfo,
+                                              false);
 
-          // Only show compilation the first time
-          if(ki == 0)
-            verboseCompilation_f = false;
+            // Only show compilation the first time
+            nestedInfo.hideCompilation();
+          }
         }
 
-        verboseCompilation_f = vc_f;
+        k->setupSpecialization(dHandle,
+                               sourceFilename, functionName, info_,
+                               true);
+
+        const double endTime = currentTime();
+
+        k->buildTime_ = (endTime - startTime);
+        startTime     = endTime;
       }
     }
     else{
-      k = dHandle->buildKernelFromSource(sourceFilename,
-                                         functionName,
-                                         info_);
-      k->dHandle = dHandle;
+      for(int i = 0; i < kernelCount; ++i) {
+        const std::string &functionName = functionNames[i];
+
+        kernel_v *&k = kernels[i].kHandle;
+
+        if(launchBinary.size() == 0) {
+          k = dHandle->buildKernelFromSource(sourceFilename,
+                                             functionName,
+                                             info_);
+          launchBinary = k->binaryFilename;
+        }
+        else {
+          k = dHandle->buildKernelFromBinary(launchBinary,
+                                             functionName);
+        }
+
+        k->dHandle = dHandle;
+
+        k->setupSpecialization(dHandle,
+                               sourceFilename, functionName, info_,
+                               false);
+
+        const double endTime = currentTime();
+
+        k->buildTime_ = (endTime - startTime);
+        startTime     = endTime;
+      }
     }
 
-    return ker;
+    if(memoizable) {
+      for(int b = 0; b < parseCount; ++b) {
+        const int i = toParse[b];
+
+        kernel_v &k = *(kernels[i].kHandle);
+
+        kernelMemo::entry_t entry;
+
+        entry.deviceID = dHandle->id_;
+        entry.mtime    = mtime;
+        entry.bytes    = bytes;
+
+        entry.parsedFilename = parsedFile;
+        entry.binaryFilename = k.binaryFilename;
+
+        if(k.nestedKernelCount())
+          entry.nestedBinaryFilename = k.nestedKernels[0].kHandle->binaryFilename;
+
+        entry.metaInfo = k.metaInfo;
+
+        kernelMemo::store(memoKeys[i], entry);
+      }
+    }
+
+    return kernels;
   }
 
   kernel device::buildKernelFromBinary(const std::string &filename,
                                        const std::string &functionName) {
     checkIfInitialized();
 
+    const double startTime = currentTime();
+
     kernel ker;
     ker.kHandle = dHandle->buildKernelFromBinary(filename, functionName);
-    ker.kHandle->dHandle = dHandle;
+    ker.kHandle->dHandle    = dHandle;
+    ker.kHandle->buildTime_ = currentTime() - startTime;
+
+    return ker;
+  }
+
+  kernel device::buildKernelAsync(const std::string &filename,
+                                  const std::string &functionName,
+                                  const kernelInfo &info_) {
+    checkIfInitialized();
+
+    kernelBuild_t *build = new kernelBuild_t;
+
+    build->deviceID     = dHandle->id_;
+    build->device       = *this;
+    build->filename     = filename;
+    build->functionName = functionName;
+    build->info         = info_;
+    build->kHandle      = NULL;
+    build->finished     = false;
+    build->failed       = false;
+    build->refs         = 2;
+
+    asyncBuild::submit(build);
+
+    kernel ker;
+    ker.bHandle = build;
 
     return ker;
   }
@@ -2279,6 +3241,10 @@ namespace occa {
   void device::free() {
     checkIfInitialized();
 
+    asyncBuild::forgetDevice(dHandle->id_);
+    kernelMemo::forgetDevice(dHandle->id_);
+    reduction::forgetDevice(dHandle->id_);
+
     const int streamCount = dHandle->streams.size();
 
     for(int i = 0; i < streamCount; ++i)
@@ -2450,6 +3416,15 @@ namespace occa {
                                                info_);
   }
 
+  std::vector<kernel> buildKernelsFromSource(const std::string &filename,
+                                             const std::vector<std::string> &functionNames,
+                                             const kernelInfo &info_) {
+
+    return currentDevice.buildKernelsFromSource(filename,
+                                                functionNames,
+                                                info_);
+  }
+
   kernel buildKernelFromBinary(const std::string &filename,
                                const std::string &functionName) {
 
@@ -2457,6 +3432,15 @@ namespace occa {
                                                functionName);
   }
 
+  kernel buildKernelAsync(const std::string &filename,
+                          const std::string &functionName,
+                          const kernelInfo &info_) {
+
+    return currentDevice.buildKernelAsync(filename,
+                                          functionName,
+                                          info_);
+  }
+
   void cacheKernelInLibrary(const std::string &filename,
                             const std::string &functionName,
                             const kernelInfo &info_) {
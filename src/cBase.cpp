@@ -19,9 +19,11 @@ struct occaType_t {
     value() {}
 };
 
+// Arguments are stored by value, clearing and reusing a list
+//   doesn't allocate
 struct occaArgumentList_t {
   int argc;
-  occaType_t *argv[100];
+  occaType_t argv[OCCA_MAX_ARGS];
 };
 
 //---[ Globals & Flags ]------------
@@ -63,6 +65,78 @@ namespace occa {
     return ot;
   }
 
+  inline occaScalar _newScalar(const int type, const uintptr_t bytes) {
+    occaScalar s;
+    s.ptr         = NULL;
+    s.type        = type;
+    s.bytes       = bytes;
+    s.value.void_ = NULL;
+    return s;
+  }
+
+  inline void _scalarToType(const occaScalar &s, occaType_t &t) {
+    t.type = s.type;
+
+    occa::kernelArg_t &kArg = t.value;
+    kArg.size = s.bytes;
+    kArg.info = occa::kArgInfo::none;
+
+    ::memcpy(&(kArg.data), &(s.value), sizeof(s.value));
+  }
+
+  inline void _addArgument(occa::kernel &kernel, const int pos, occaType_t &arg) {
+    void *argPtr = arg.value.data.void_;
+
+    if(arg.type == OCCA_TYPE_MEMORY){
+      occa::memory memory_((occa::memory_v*) argPtr);
+      kernel.addArgument(pos, occa::kernelArg(memory_));
+    }
+    else if(arg.type == OCCA_TYPE_PTR){
+      occa::memory memory_((void*) argPtr);
+      kernel.addArgument(pos, occa::kernelArg(memory_));
+    }
+    else
+      kernel.addArgument(pos, occa::kernelArg(arg.value));
+  }
+
+  // occaType scalars are freed once they're used, occaScalar
+  //   and memory arguments are left alone
+  inline void _runKernel(occaKernel kernel, const int argc, occaType *args) {
+    occa::kernel kernel_((occa::kernel_v*) kernel);
+    kernel_.clearArgumentList();
+
+    for(int i = 0; i < argc; ++i){
+      occaType arg = args[i];
+
+      if(arg->ptr == NULL){
+        occaType_t scalar;
+        _scalarToType(*((occaScalar*) arg), scalar);
+        _addArgument(kernel_, i, scalar);
+      }
+      else {
+        _addArgument(kernel_, i, *(arg->ptr));
+
+        if((arg->ptr->type != OCCA_TYPE_MEMORY) &&
+           (arg->ptr->type != OCCA_TYPE_PTR)){
+          delete arg->ptr;
+          delete arg;
+        }
+      }
+    }
+
+    kernel_.runFromArguments();
+  }
+
+  inline void _runKernel(occaKernel kernel, const int argc, occaType_t *args) {
+    occa::kernel kernel_((occa::kernel_v*) kernel);
+    kernel_.clearArgumentList();
+
+    for(int i = 0; i < argc; ++i)
+      _addArgument(kernel_, i, args[i]);
+
+    kernel_.runFromArguments();
+  }
+
   inline std::string typeToStr(occaType value) {
     occa::kernelArg_t &value_ = occa::_typeValue(value);
     const int valueType       = occa::_typeType(value);
@@ -204,6 +278,66 @@ occaType OCCA_RFUNC occaString(const char *value) {
   kArg.info       = occa::kArgInfo::usePointer;
   return type;
 }
+
+occaScalar OCCA_RFUNC occaIntScalar(int value) {
+  occaScalar s = occa::_newScalar(OCCA_TYPE_INT, sizeof(int));
+  s.value.int_ = value;
+  return s;
+}
+
+occaScalar OCCA_RFUNC occaUIntScalar(unsigned int value) {
+  occaScalar s = occa::_newScalar(OCCA_TYPE_UINT, sizeof(unsigned int));
+  s.value.uint_ = value;
+  return s;
+}
+
+occaScalar OCCA_RFUNC occaCharScalar(char value) {
+  occaScalar s = occa::_newScalar(OCCA_TYPE_CHAR, sizeof(char));
+  s.value.char_ = value;
+  return s;
+}
+
+occaScalar OCCA_RFUNC occaUCharScalar(unsigned char value) {
+  occaScalar s = occa::_newScalar(OCCA_TYPE_UCHAR, sizeof(unsigned char));
+  s.value.uchar_ = value;
+  return s;
+}
+
+occaScalar OCCA_RFUNC occaShortScalar(short value) {
+  occaScalar s = occa::_newScalar(OCCA_TYPE_SHORT, sizeof(short));
+  s.value.short_ = value;
+  return s;
+}
+
+occaScalar OCCA_RFUNC occaUShortScalar(unsigned short value) {
+  occaScalar s = occa::_newScalar(OCCA_TYPE_USHORT, sizeof(unsigned short));
+  s.value.ushort_ = value;
+  return s;
+}
+
+occaScalar OCCA_RFUNC occaLongScalar(long value) {
+  occaScalar s = occa::_newScalar(OCCA_TYPE_LONG, sizeof(long));
+  s.value.long_ = value;
+  return s;
+}
+
+occaScalar OCCA_RFUNC occaULongScalar(unsigned long value) {
+  occaScalar s = occa::_newScalar(OCCA_TYPE_ULONG, sizeof(unsigned long));
+  s.value.ulong_ = value;
+  return s;
+}
+
+occaScalar OCCA_RFUNC occaFloatScalar(float value) {
+  occaScalar s = occa::_newScalar(OCCA_TYPE_FLOAT, sizeof(float));
+  s.value.float_ = value;
+  return s;
+}
+
+occaScalar OCCA_RFUNC occaDoubleScalar(double value) {
+  occaScalar s = occa::_newScalar(OCCA_TYPE_DOUBLE, sizeof(double));
+  s.value.double_ = value;
+  return s;
+}
 //====================================
 
 
@@ -796,12 +930,7 @@ occaArgumentList OCCA_RFUNC occaCreateArgumentList() {
 }
 
 void OCCA_RFUNC occaArgumentListClear(occaArgumentList list) {
-  occaArgumentList_t &list_ = *list;
-  for(int i = 0; i < list_.argc; ++i) {
-    if(list_.argv[i]->type != OCCA_TYPE_MEMORY)
-      delete list_.argv[i];
-  }
-  list_.argc = 0;
+  list->argc = 0;
 }
 
 void OCCA_RFUNC occaArgumentListFree(occaArgumentList list) {
@@ -820,7 +949,21 @@ void OCCA_RFUNC occaArgumentListAddArg(occaArgumentList list,
 
     list_.argc = (argPos + 1);
   }
-  list_.argv[argPos] = (occaType_t*) type;
+
+  occaType type_ = (occaType) type;
+
+  if(type_->ptr == NULL) {
+    occa::_scalarToType(*((occaScalar*) type_), list_.argv[argPos]);
+    return;
+  }
+
+  list_.argv[argPos] = *(type_->ptr);
+
+  if((type_->ptr->type != OCCA_TYPE_MEMORY) &&
+     (type_->ptr->type != OCCA_TYPE_PTR)) {
+    delete type_->ptr;
+    delete type_;
+  }
 }
 
 // Note the _
@@ -829,7 +972,7 @@ void OCCA_RFUNC occaKernelRun_(occaKernel kernel,
                                occaArgumentList list) {
 
   occaArgumentList_t &list_ = *((occaArgumentList_t*) list);
-  occaKernelRunN(kernel, list_.argc, list_.argv);
+  occa::_runKernel(kernel, list_.argc, list_.argv);
 }
 
 void OCCA_RFUNC occaKernelRunN(occaKernel kernel, const int argc, occaType_t **args){
@@ -838,20 +981,12 @@ void OCCA_RFUNC occaKernelRunN(occaKernel kernel, const int argc, occaType_t **a
 
   for(int i = 0; i < argc; ++i){
     occaType_t &arg = *(args[i]);
-    void *argPtr = arg.value.data.void_;
 
-    if(arg.type == OCCA_TYPE_MEMORY){
-      occa::memory memory_((occa::memory_v*) argPtr);
-      kernel_.addArgument(i, occa::kernelArg(memory_));
-    }
-    else if(arg.type == OCCA_TYPE_PTR){
-      occa::memory memory_((void*) argPtr);
-      kernel_.addArgument(i, occa::kernelArg(memory_));
-    }
-    else {
-      kernel_.addArgument(i, occa::kernelArg(arg.value));
+    occa::_addArgument(kernel_, i, arg);
+
+    if((arg.type != OCCA_TYPE_MEMORY) &&
+       (arg.type != OCCA_TYPE_PTR))
       delete (occaType_t*) args[i];
-    }
   }
 
   kernel_.runFromArguments();
@@ -981,6 +1116,11 @@ const char* OCCA_RFUNC occaMemoryMode(occaMemory memory) {
   return memory_.mode().c_str();
 }
 
+uintptr_t OCCA_RFUNC occaMemoryBytes(occaMemory memory) {
+  occa::memory memory_((occa::memory_v*) occa::_typeValue(memory).data.void_);
+  return memory_.bytes();
+}
+
 void* OCCA_RFUNC occaMemoryGetMemoryHandle(occaMemory memory) {
   occa::memory memory_((occa::memory_v*) occa::_typeValue(memory).data.void_);
   return memory_.getMemoryHandle();
@@ -1,4 +1,14 @@
 #include "occa/library.hpp"
+#include "occa/Serial.hpp"
+
+#include <algorithm>
+
+#if (OCCA_OS & (LINUX_OS | OSX_OS))
+#  include <fcntl.h>
+#  include <sys/mman.h>
+#  include <sys/stat.h>
+#  include <unistd.h>
+#endif
 
 namespace occa {
   namespace fileDatabase {
@@ -45,19 +55,70 @@ namespace occa {
   }
 
   namespace library {
+    const char magic[8]    = {'O', 'C', 'C', 'A', 'L', 'I', 'B', '\0'};
+    const uint32_t version = 2;
+
     mutex_t headerMutex, kernelMutex;
     mutex_t deviceIDMutex, deviceModelMutex;
-    mutex_t scratchMutex;
+    mutex_t scratchMutex, fileMutex;
 
     headerMap_t headerMap;
     kernelMap_t kernelMap;
 
     deviceModelMap_t deviceModelMap;
 
+    mappedFileMap_t mappedFiles;
+
     std::string scratchPad;
 
     int currentDeviceID = 0;
 
+    // Bundles are written in native byte order
+    template <class TM>
+    static inline void writeValue(std::string &s, const TM &t){
+      s.append((const char*) &t, sizeof(TM));
+    }
+
+    template <class TM>
+    static inline TM readValue(const char *&c){
+      TM t;
+      ::memcpy(&t, c, sizeof(TM));
+      c += sizeof(TM);
+
+      return t;
+    }
+
+    static inline void writeString(std::string &s, const std::string &str){
+      writeValue<uint32_t>(s, str.size());
+      s += str;
+    }
+
+    static inline std::string readString(const char *&c){
+      const uint32_t chars = readValue<uint32_t>(c);
+      c += chars;
+
+      return std::string(c - chars, chars);
+    }
+
+    // Checks [bytes] can be read from [c] without passing [end]
+    static inline bool hasBytes(const char *c, const char *end, const uint64_t bytes){
+      return (bytes <= (uint64_t) (end - c));
+    }
+
+    static inline std::string readCheckedString(const char *&c, const char *end,
+                                                const std::string &kernelName){
+      OCCA_CHECK(hasBytes(c, end, sizeof(uint32_t)),
+                 "Library contents for kernel [" << kernelName << "] are truncated");
+
+      const char *c_       = c;
+      const uint32_t chars = readValue<uint32_t>(c_);
+
+      OCCA_CHECK(hasBytes(c_, end, chars),
+                 "Library contents for kernel [" << kernelName << "] are truncated");
+
+      return readString(c);
+    }
+
     size_t addToScratchPad(const std::string &s){
       scratchMutex.lock();
 
@@ -69,33 +130,115 @@ namespace occa {
       return offset;
     }
 
+    const mappedFile_t& mapFile(const int fileID){
+      fileMutex.lock();
+
+      mappedFileMapIterator it = mappedFiles.find(fileID);
+
+      if(it != mappedFiles.end()){
+        fileMutex.unlock();
+        return it->second;
+      }
+
+      const std::string filename = fileDatabase::getFilename(fileID);
+
+      mappedFile_t &file = mappedFiles[fileID];
+
+#if (OCCA_OS & (LINUX_OS | OSX_OS))
+      const int fd = ::open(filename.c_str(), O_RDONLY);
+
+      struct stat statbuf;
+
+      if((fd == -1) || fstat(fd, &statbuf)){
+        mappedFiles.erase(fileID);
+        fileMutex.unlock();
+
+        OCCA_CHECK(false,
+                   "Failed to open library [" << compressFilename(filename) << "]");
+      }
+
+      file.bytes = statbuf.st_size;
+
+      void *ptr = (file.bytes ?
+                   ::mmap(NULL, file.bytes, PROT_READ, MAP_PRIVATE, fd, 0) :
+                   MAP_FAILED);
+
+      ::close(fd);
+
+      if(ptr == MAP_FAILED){
+        mappedFiles.erase(fileID);
+        fileMutex.unlock();
+
+        OCCA_CHECK(false,
+                   "Failed to map library [" << compressFilename(filename) << "]");
+      }
+
+      file.ptr = (const char*) ptr;
+#else
+      // Kept for the life of the process, like a mapping
+      std::string *contents = new std::string(readFile(filename, true));
+
+      file.ptr   = contents->c_str();
+      file.bytes = contents->size();
+#endif
+
+      fileMutex.unlock();
+
+      return file;
+    }
+
+    const char* getContents(const infoHeader_t &h){
+      if(h.fileID < 0)
+        return scratchPad.c_str();
+
+      return mapFile(h.fileID).ptr;
+    }
+
     void load(const std::string &filename){
-      //---[ Load file ]------
-      std::string sBuffer = readFile(filename);
-      const char *buffer  = sBuffer.c_str();
+      const int fileID = fileDatabase::getFileID(filename);
+
+      //---[ Map file ]-------
+      const mappedFile_t &file = mapFile(fileID);
+      const char *buffer       = file.ptr;
+
+      const uint64_t preambleBytes = (sizeof(magic) + 3*sizeof(uint32_t));
+
+      OCCA_CHECK((preambleBytes <= file.bytes) &&
+                 (::memcmp(buffer, magic, sizeof(magic)) == 0),
+                 "[" << compressFilename(filename) << "] is not an OCCA library");
 
       //---[ Read file ]------
-      const uint32_t *buffer32 = (const uint32_t*) buffer;
-      const uint64_t *buffer64;
+      const char *c = (buffer + sizeof(magic));
+
+      const uint32_t fileVersion   = readValue<uint32_t>(c);
+      const uint32_t fileParserVer = readValue<uint32_t>(c);
+      const uint32_t headerCount   = readValue<uint32_t>(c);
 
-      const uint32_t headerCount = *(buffer32++);
+      OCCA_CHECK((fileVersion == version) && (fileParserVer == (uint32_t) parserVersion),
+                 "Library [" << compressFilename(filename) << "] was built by another OCCA version"
+                 << " (library version " << fileVersion << ", parser version " << fileParserVer << ")");
+
+      OCCA_CHECK((preambleBytes + headerCount*(sizeof(uint32_t) + 6*sizeof(uint64_t))) <= file.bytes,
+                 "Library [" << compressFilename(filename) << "] is truncated");
 
       for(uint32_t i = 0; i < headerCount; ++i){
         infoID_t infoID;
 
-        const int mode_ = *(buffer32++);
+        const int mode_ = readValue<uint32_t>(c);
 
-        buffer64 = (const uint64_t*) buffer32;
-        const uint64_t flagsOffset = *(buffer64++);
-        const uint64_t flagsBytes  = *(buffer64++);
+        const uint64_t flagsOffset = readValue<uint64_t>(c);
+        const uint64_t flagsBytes  = readValue<uint64_t>(c);
 
-        const uint64_t contentOffset = *(buffer64++);
-        const uint64_t contentBytes  = *(buffer64++);
+        const uint64_t contentOffset = readValue<uint64_t>(c);
+        const uint64_t contentBytes  = readValue<uint64_t>(c);
 
-        const uint64_t kernelNameOffset = *(buffer64++);
-        const uint64_t kernelNameBytes  = *(buffer64++);
+        const uint64_t kernelNameOffset = readValue<uint64_t>(c);
+        const uint64_t kernelNameBytes  = readValue<uint64_t>(c);
 
-        buffer32 = (const uint32_t*) buffer64;
+        OCCA_CHECK(((flagsOffset      + flagsBytes)      <= file.bytes) &&
+                   ((contentOffset    + contentBytes)    <= file.bytes) &&
+                   ((kernelNameOffset + kernelNameBytes) <= file.bytes),
+                   "Library [" << compressFilename(filename) << "] is truncated");
 
         infoID.kernelName = std::string(buffer + kernelNameOffset,
                                         kernelNameBytes);
@@ -113,7 +256,7 @@ namespace occa {
         headerMutex.lock();
         infoHeader_t &h = headerMap[infoID];
 
-        h.fileID = fileDatabase::getFileID(filename);
+        h.fileID = fileID;
         h.mode   = mode_;
 
         h.flagsOffset = flagsOffset;
@@ -132,23 +275,35 @@ namespace occa {
     void save(const std::string &filename){
       headerMutex.lock();
 
-      FILE *outFD = fopen(filename.c_str(), "wb");
-
-      uint32_t headerCount = headerMap.size();
+      const uint32_t headerCount = headerMap.size();
 
       if(headerCount == 0){
         headerMutex.unlock();
         return;
       }
 
-      fwrite(&headerCount, sizeof(uint32_t), 1, outFD);
+      FILE *outFD = fopen(filename.c_str(), "wb");
+
+      if(outFD == NULL){
+        headerMutex.unlock();
+
+        OCCA_CHECK(false,
+                   "Failed to open [" << compressFilename(filename) << "] for writing");
+      }
+
+      const uint32_t parserVersion_ = parserVersion;
+
+      fwrite(magic            , sizeof(char)    , sizeof(magic), outFD);
+      fwrite(&version         , sizeof(uint32_t), 1, outFD);
+      fwrite(&parserVersion_  , sizeof(uint32_t), 1, outFD);
+      fwrite(&headerCount     , sizeof(uint32_t), 1, outFD);
 
       cHeaderMapIterator it = headerMap.begin();
 
       const uint64_t headerOffset = headerCount * ((  sizeof(uint32_t)) +
                                                    (6*sizeof(uint64_t)));
 
-      uint64_t contentOffsets = sizeof(headerCount) + headerOffset;
+      uint64_t contentOffsets = (sizeof(magic) + 3*sizeof(uint32_t)) + headerOffset;
 
       for(uint32_t i = 0; i < headerCount; ++i){
         const infoHeader_t &h = it->second;
@@ -170,46 +325,24 @@ namespace occa {
         ++it;
       }
 
+      // Contents come from the scratch pad or from loaded (mapped) bundles
+      scratchMutex.lock();
+
       it = headerMap.begin();
 
       for(uint32_t i = 0; i < headerCount; ++i){
         const infoHeader_t &h = it->second;
         ++it;
 
-        char *buffer = new char[std::max(h.flagsBytes,
-                                         std::max(h.contentBytes,
-                                                  h.kernelNameBytes))];
-
-        if(0 <= h.fileID){
-          const std::string hFilename = fileDatabase::getFilename(h.fileID);
-          FILE *inFD = fopen(hFilename.c_str(), "rb");
+        const char *c = getContents(h);
 
-          fseek(inFD, h.flagsOffset, SEEK_SET);
-          ignoreResult( fread(buffer , sizeof(char), h.flagsBytes, inFD) );
-          fwrite(buffer, sizeof(char), h.flagsBytes, outFD);
-
-          ignoreResult( fread(buffer , sizeof(char), h.contentBytes, inFD) );
-          fwrite(buffer, sizeof(char), h.contentBytes, outFD);
-
-          ignoreResult( fread(buffer , sizeof(char), h.kernelNameBytes, inFD) );
-          fwrite(buffer, sizeof(char), h.kernelNameBytes, outFD);
-
-          fclose(inFD);
-
-          delete [] buffer;
-        }
-        else{
-          const char *c  = scratchPad.c_str();
-          const char *c1 = c + h.flagsOffset;
-          const char *c2 = c + h.contentOffset;
-          const char *c3 = c + h.kernelNameOffset;
-
-          fwrite(c1, sizeof(char), h.flagsBytes     , outFD);
-          fwrite(c2, sizeof(char), h.contentBytes   , outFD);
-          fwrite(c3, sizeof(char), h.kernelNameBytes, outFD);
-        }
+        fwrite(c + h.flagsOffset     , sizeof(char), h.flagsBytes     , outFD);
+        fwrite(c + h.contentOffset   , sizeof(char), h.contentBytes   , outFD);
+        fwrite(c + h.kernelNameOffset, sizeof(char), h.kernelNameBytes, outFD);
       }
 
+      scratchMutex.unlock();
+
       fclose(outFD);
 
       headerMutex.unlock();
@@ -275,27 +408,210 @@ namespace occa {
       infoID.kernelName = kernelName;
 
       headerMutex.lock();
-      const infoHeader_t &h = headerMap[infoID];
+
+      cHeaderMapIterator it = headerMap.find(infoID);
+      const bool found      = (it != headerMap.end());
+
+      infoHeader_t h;
+
+      if(found)
+        h = it->second;
+
+      headerMutex.unlock();
+
+      OCCA_CHECK(found,
+                 "Kernel [" << kernelName << "] is not in a loaded library for this device");
+
+      if(h.mode & (Serial | OpenMP | Pthreads)){
+        // Bundles are read in place, only the scratch pad can move
+        if(0 <= h.fileID)
+          return loadCpuKernel(dHandle, getContents(h) + h.contentOffset, h.contentBytes, kernelName);
+
+        scratchMutex.lock();
+        const std::string contents = scratchPad.substr(h.contentOffset, h.contentBytes);
+        scratchMutex.unlock();
+
+        return loadCpuKernel(dHandle, contents.c_str(), contents.size(), kernelName);
+      }
+
+      scratchMutex.lock();
+      const std::string contents(getContents(h) + h.contentOffset, h.contentBytes);
+      scratchMutex.unlock();
+
+      return kernel(dHandle->loadKernelFromLibrary(contents.c_str(), kernelName));
+    }
+
+    //---[ CPU Modes ]------------------
+    static void writeSharedObject(std::string &contents,
+                                  const std::string &binaryFilename){
+      const std::string binary = (binaryFilename.size() ?
+                                  readFile(binaryFilename, true) :
+                                  std::string());
+
+      writeValue<uint64_t>(contents, binary.size());
+      contents += binary;
+    }
+
+    void cacheCpuKernel(occa::device_v *dHandle,
+                        const std::string &filename,
+                        const std::string &functionName,
+                        const kernelInfo &info){
+
+      kernel k = occa::device(dHandle).buildKernelFromSource(filename, functionName, info);
+
+      kernel_v &kHandle = *(k.kHandle);
+
+      std::string contents;
+
+      // Parsed kernels launch from a host kernel, the device kernels
+      //   live in their own shared object
+      if(kHandle.nestedKernelCount()){
+        writeSharedObject(contents, kHandle.nestedKernels[0].kHandle->binaryFilename);
+        writeSharedObject(contents, kHandle.binaryFilename);
+      }
+      else {
+        writeSharedObject(contents, kHandle.binaryFilename);
+        writeSharedObject(contents, "");
+      }
+
+      const parsedKernelInfo &metaInfo = kHandle.metaInfo;
+
+      writeString(contents, metaInfo.name);
+      writeString(contents, metaInfo.baseName);
+      writeValue<int32_t>(contents, metaInfo.nestedKernels);
+      writeValue<uint32_t>(contents, metaInfo.argumentInfos.size());
+
+      for(size_t i = 0; i < metaInfo.argumentInfos.size(); ++i){
+        writeValue<int32_t>(contents, metaInfo.argumentInfos[i].pos);
+        writeValue<uint8_t>(contents, metaInfo.argumentInfos[i].isConst);
+      }
+
+      k.free();
+
+      const std::string flatDevID = dHandle->getIdentifier().flattenFlagMap();
+
+      infoID_t infoID;
+
+      infoID.modelID    = dHandle->modelID();
+      infoID.kernelName = functionName;
+
+      headerMutex.lock();
+
+      infoHeader_t &header = headerMap[infoID];
+
+      header.fileID = -1;
+      header.mode   = dHandle->mode();
+
+      header.flagsOffset = addToScratchPad(flatDevID);
+      header.flagsBytes  = flatDevID.size();
+
+      header.contentOffset = addToScratchPad(contents);
+      header.contentBytes  = contents.size();
+
+      header.kernelNameOffset = addToScratchPad(functionName);
+      header.kernelNameBytes  = functionName.size();
+
       headerMutex.unlock();
 
-      const std::string hFilename = fileDatabase::getFilename(h.fileID);
-      FILE *inFD = fopen(hFilename.c_str(), "rb");
+      kernelMutex.lock();
+
+      std::vector<int> &ids = kernelMap[functionName];
+
+      if(std::find(ids.begin(), ids.end(), infoID.modelID) == ids.end())
+        ids.push_back(infoID.modelID);
+
+      kernelMutex.unlock();
+    }
+
+    kernel loadCpuKernel(occa::device_v *dHandle,
+                         const char *contents,
+                         const uint64_t contentBytes,
+                         const std::string &kernelName){
+      const char *c   = contents;
+      const char *end = (contents + contentBytes);
+
+      OCCA_CHECK(hasBytes(c, end, sizeof(uint64_t)),
+                 "Library contents for kernel [" << kernelName << "] are truncated");
+
+      const char *binary = c;
+      const uint64_t binaryBytes = readValue<uint64_t>(c);
+
+      OCCA_CHECK(hasBytes(c, end, binaryBytes),
+                 "Library contents for kernel [" << kernelName << "] are truncated");
+
+      c += binaryBytes;
+
+      OCCA_CHECK(hasBytes(c, end, sizeof(uint64_t)),
+                 "Library contents for kernel [" << kernelName << "] are truncated");
+
+      const char *launch = c;
+      const uint64_t launchBytes = readValue<uint64_t>(c);
 
-      char *buffer = new char[h.contentBytes + 1];
-      buffer[h.contentBytes] = '\0';
+      OCCA_CHECK(hasBytes(c, end, launchBytes),
+                 "Library contents for kernel [" << kernelName << "] are truncated");
 
-      fseek(inFD, h.contentOffset, SEEK_SET);
+      c += launchBytes;
 
-      ignoreResult( fread(buffer, sizeof(char), h.contentBytes, inFD) );
+      parsedKernelInfo metaInfo;
 
-      fclose(inFD);
+      metaInfo.name     = readCheckedString(c, end, kernelName);
+      metaInfo.baseName = readCheckedString(c, end, kernelName);
 
-      kernel k = kernel(dHandle->loadKernelFromLibrary(buffer, kernelName));
+      OCCA_CHECK(hasBytes(c, end, sizeof(int32_t) + sizeof(uint32_t)),
+                 "Library contents for kernel [" << kernelName << "] are truncated");
 
-      delete [] buffer;
-      fclose(inFD);
+      metaInfo.nestedKernels = readValue<int32_t>(c);
+
+      const uint32_t argCount = readValue<uint32_t>(c);
+
+      OCCA_CHECK(hasBytes(c, end, argCount * (uint64_t) (sizeof(int32_t) + sizeof(uint8_t))),
+                 "Library contents for kernel [" << kernelName << "] are truncated");
+
+      metaInfo.argumentInfos.resize(argCount);
+
+      for(uint32_t i = 0; i < argCount; ++i){
+        metaInfo.argumentInfos[i].pos     = readValue<int32_t>(c);
+        metaInfo.argumentInfos[i].isConst = readValue<uint8_t>(c);
+      }
+
+      if(launchBytes == 0)
+        return kernel(dHandle->loadKernelFromLibrary(binary, kernelName));
+
+      // Same split as device::buildKernelsFromSource()
+#if OCCA_OPENMP_ENABLED
+      device_v *launchDevice = ((dHandle->mode() == OpenMP) ?
+                                dHandle : new device_t<Serial>);
+#else
+      device_v *launchDevice = new device_t<Serial>;
+#endif
+
+      kernel_v *k = launchDevice->loadKernelFromLibrary(launch, kernelName);
+
+      k->metaInfo = metaInfo;
+
+      std::stringstream ss;
+
+      for(int ki = 0; ki < metaInfo.nestedKernels; ++ki){
+        ss << ki;
+
+        const std::string sKerName = metaInfo.baseName + ss.str();
+
+        ss.str("");
+
+        kernel sKer;
+
+        sKer.kHandle = dHandle->loadKernelFromLibrary(binary, sKerName);
+
+        sKer.kHandle->metaInfo               = metaInfo;
+        sKer.kHandle->metaInfo.name          = sKerName;
+        sKer.kHandle->metaInfo.nestedKernels = 0;
+        sKer.kHandle->metaInfo.removeArg(0); // remove nestedKernels **
+
+        k->nestedKernels.push_back(sKer);
+      }
 
-      return k;
+      return kernel(k);
     }
+    //==================================
   }
 }
@@ -174,3 +174,267 @@ namespace occa {
     }
   }
 }
+
+namespace occa {
+  //---[ Reductions ]-----------------------------
+  namespace reduction {
+    // GPU modes reduce each group in shared memory, CPU modes run one
+    //   partial per outer iteration and combine partials the same way
+    static const int gpuGroupSize = 256;
+    static const int cpuPartials  = 64;
+
+    static mutex_t mutex;
+    static std::map<std::string, kernel> kernels;
+
+    static bool usingCPU(occa::device &device) {
+      return (device.modeID() & (Serial | OpenMP | Pthreads));
+    }
+
+    static std::string reduceSource(const std::string &type,
+                                    const std::string &op,
+                                    const bool onCPU) {
+      std::stringstream ss;
+
+      ss << "kernel void occaReduce(const int entries,\n"
+         << "                       const int chunk,\n"
+         << "                       const " << type << " *in,\n"
+         << "                       " << type << " *out){\n"
+         << "  for(int g = 0; g < entries; g += chunk; outer0){\n";
+
+      if(onCPU) {
+        ss << "    for(int t = 0; t < 1; ++t; inner0){\n"
+           << "      const int end = (((g + chunk) < entries) ? (g + chunk) : entries);\n"
+           << "      " << type << " a = in[g];\n"
+           << "      for(int i = g + 1; i < end; ++i){\n"
+           << "        const " << type << " b = in[i];\n"
+           << "        a = " << op << ";\n"
+           << "      }\n"
+           << "      out[g / chunk] = a;\n"
+           << "    }\n";
+      }
+      else {
+        const int B = gpuGroupSize;
+
+        ss << "    shared " << type << " s_part[" << B << "];\n"
+           << "    for(int t = 0; t < " << B << "; ++t; inner0){\n"
+           << "      const int end = (((g + chunk) < entries) ? (g + chunk) : entries);\n"
+           << "      if((g + t) < end){\n"
+           << "        " << type << " a = in[g + t];\n"
+           << "        for(int i = g + t + " << B << "; i < end; i += " << B << "){\n"
+           << "          const " << type << " b = in[i];\n"
+           << "          a = " << op << ";\n"
+           << "        }\n"
+           << "        s_part[t] = a;\n"
+           << "      }\n"
+           << "    }\n"
+           << "    for(int alive = " << (B / 2) << "; 0 < alive; alive /= 2){\n"
+           << "      barrier(localMemFence);\n"
+           << "      for(int t = 0; t < " << B << "; ++t; inner0){\n"
+           << "        const int end = (((g + chunk) < entries) ? (g + chunk) : entries);\n"
+           << "        if((t < alive) && ((g + t + alive) < end)){\n"
+           << "          const " << type << " a = s_part[t];\n"
+           << "          const " << type << " b = s_part[t + alive];\n"
+           << "          s_part[t] = " << op << ";\n"
+           << "        }\n"
+           << "      }\n"
+           << "    }\n"
+           << "    for(int t = 0; t < " << B << "; ++t; inner0){\n"
+           << "      if(t == 0)\n"
+           << "        out[g / chunk] = s_part[0];\n"
+           << "    }\n";
+      }
+
+      ss << "  }\n"
+         << "}\n";
+
+      return ss.str();
+    }
+
+    // Each outer iteration scans its chunk, starting from the
+    //   scanned partial of the chunks before it
+    static std::string scanSource(const std::string &type,
+                                  const std::string &op) {
+      std::stringstream ss;
+
+      ss << "kernel void occaScan(const int entries,\n"
+         << "                     const int chunk,\n"
+         << "                     const " << type << " *in,\n"
+         << "                     const " << type << " *offsets,\n"
+         << "                     " << type << " *out){\n"
+         << "  for(int g = 0; g < entries; g += chunk; outer0){\n"
+         << "    for(int t = 0; t < 1; ++t; inner0){\n"
+         << "      const int end = (((g + chunk) < entries) ? (g + chunk) : entries);\n"
+         << "      " << type << " a = in[g];\n"
+         << "      if(0 < g){\n"
+         << "        const " << type << " b = a;\n"
+         << "        a = offsets[(g / chunk) - 1];\n"
+         << "        a = " << op << ";\n"
+         << "      }\n"
+         << "      out[g] = a;\n"
+         << "      for(int i = g + 1; i < end; ++i){\n"
+         << "        const " << type << " b = in[i];\n"
+         << "        a = " << op << ";\n"
+         << "        out[i] = a;\n"
+         << "      }\n"
+         << "    }\n"
+         << "  }\n"
+         << "}\n";
+
+      return ss.str();
+    }
+
+    // Kernels are kept per device, type and operator
+    static kernel& getKernel(occa::device &device,
+                             const std::string &kernelName,
+                             const std::string &type,
+                             const std::string &op) {
+      std::stringstream ss;
+
+      ss << device.id() << '\n'
+         << kernelName << '\n'
+         << type << '\n'
+         << op;
+
+      const std::string key = ss.str();
+
+      mutex.lock();
+
+      std::map<std::string, kernel>::iterator it = kernels.find(key);
+
+      if(it != kernels.end()) {
+        mutex.unlock();
+        return it->second;
+      }
+
+      const std::string source = ((kernelName == "occaReduce")           ?
+                                  reduceSource(type, op, usingCPU(device)) :
+                                  scanSource(type, op));
+
+      kernelInfo info = defaultKernelInfo;
+      info.hideCompilation();
+
+      kernel &k = kernels[key];
+      k = device.buildKernelFromString(source, kernelName, info, occa::usingOKL);
+
+      mutex.unlock();
+
+      return k;
+    }
+
+    static uintptr_t bytesFor(const std::string &type) {
+      if(type == "char")   return sizeof(char);
+      if(type == "short")  return sizeof(short);
+      if(type == "int")    return sizeof(int);
+      if(type == "long")   return sizeof(long);
+      if(type == "float")  return sizeof(float);
+      if(type == "double") return sizeof(double);
+
+      OCCA_CHECK(false,
+                 "Reductions are only implemented for POD-type data (char, short, int, long, float, double)");
+      return 0;
+    }
+
+    static uintptr_t chunkFor(occa::device &device,
+                              const uintptr_t entries) {
+      if(!usingCPU(device))
+        return (16 * gpuGroupSize);
+
+      const uintptr_t chunk = ((entries + cpuPartials - 1) / cpuPartials);
+
+      return ((chunk < 1024) ? 1024 : chunk);
+    }
+
+    void forgetDevice(const int deviceID) {
+      std::stringstream ss;
+      ss << deviceID << '\n';
+
+      const std::string prefix = ss.str();
+
+      mutex.lock();
+
+      std::map<std::string, kernel>::iterator it = kernels.begin();
+
+      while(it != kernels.end()) {
+        if(it->first.compare(0, prefix.size(), prefix) == 0) {
+          it->second.free();
+          kernels.erase(it++);
+        }
+        else
+          ++it;
+      }
+
+      mutex.unlock();
+    }
+  }
+
+  void reduce(memory in, memory out,
+              const uintptr_t entries,
+              const std::string &type,
+              const std::string &op) {
+    OCCA_CHECK(0 < entries,
+               "Cannot reduce an empty array");
+
+    occa::device device(in.getDHandle());
+
+    kernel &reduceK = reduction::getKernel(device, "occaReduce", type, op);
+
+    std::vector<memory> partials;
+
+    memory src  = in;
+    uintptr_t n = entries;
+
+    // Partials are reduced again until one is left
+    while(true) {
+      const uintptr_t chunk  = reduction::chunkFor(device, n);
+      const uintptr_t groups = ((n + chunk - 1) / chunk);
+
+      memory dest = out;
+
+      if(1 < groups) {
+        dest = device.malloc(groups * reduction::bytesFor(type));
+        partials.push_back(dest);
+      }
+
+      reduceK((int) n, (int) chunk, src, dest);
+
+      if(groups == 1)
+        break;
+
+      src = dest;
+      n   = groups;
+    }
+
+    for(int i = 0; i < (int) partials.size(); ++i)
+      partials[i].free();
+  }
+
+  void scan(memory in, memory out,
+            const uintptr_t entries,
+            const std::string &type,
+            const std::string &op) {
+    if(entries == 0)
+      return;
+
+    occa::device device(in.getDHandle());
+
+    kernel &reduceK = reduction::getKernel(device, "occaReduce", type, op);
+    kernel &scanK   = reduction::getKernel(device, "occaScan"  , type, op);
+
+    const uintptr_t chunk  = reduction::chunkFor(device, entries);
+    const uintptr_t groups = ((entries + chunk - 1) / chunk);
+
+    if(groups == 1) {
+      scanK((int) entries, (int) chunk, in, in, out);
+      return;
+    }
+
+    memory offsets = device.malloc(groups * reduction::bytesFor(type));
+
+    reduceK((int) entries, (int) chunk, in, offsets);
+    scan(offsets, offsets, groups, type, op);
+    scanK((int) entries, (int) chunk, in, offsets, out);
+
+    offsets.free();
+  }
+  //==============================================
+}
@@ -8,5 +8,130 @@ namespace occa {
     bool usingCKeywords                = false;
     bool cKeywordsAreInitialized       = false;
     bool fortranKeywordsAreInitialized = false;
+
+    //---[ Parse Arena ]----------------------------
+    parseArena_t *activeArena = NULL;
+
+    // Keeps nodes 16-byte aligned and records their size and arena
+    static const uintptr_t arenaHeaderBytes = 16;
+    static const uintptr_t arenaBlockBytes  = (256 << 10);
+
+    // Larger allocations come from the heap
+    static const uintptr_t arenaMaxFreeListBytes = 1024;
+
+    struct arenaHeader_t {
+      uintptr_t bytes;
+      parseArena_t *arena;
+    };
+
+    parseArena_t::parseArena_t() :
+      pos(NULL),
+      end(NULL),
+      freeLists(arenaMaxFreeListBytes / 16 + 1, (void*) NULL),
+      usedBytes(0),
+      peakBytes(0),
+      reservedBytes(0) {}
+
+    parseArena_t::~parseArena_t() {
+      const int blockCount = (int) blocks.size();
+
+      for(int i = 0; i < blockCount; ++i)
+        ::free(blocks[i]);
+
+      std::set<void*>::iterator it = largeAllocs.begin();
+
+      while(it != largeAllocs.end()) {
+        ::free(*it);
+        ++it;
+      }
+    }
+
+    void* parseArena_t::alloc(uintptr_t bytes) {
+      bytes = ((bytes + 15) & ~((uintptr_t) 15));
+
+      usedBytes += bytes;
+
+      if(peakBytes < usedBytes)
+        peakBytes = usedBytes;
+
+      if(arenaMaxFreeListBytes < bytes) {
+        void *ret = ::malloc(bytes);
+        OCCA_CHECK(ret != NULL,
+                   "Parser ran out of memory");
+
+        largeAllocs.insert(ret);
+        return ret;
+      }
+
+      void *&freeNode = freeLists[bytes / 16];
+
+      if(freeNode) {
+        void *ret = freeNode;
+        freeNode  = *((void**) ret);
+
+        return ret;
+      }
+
+      if((uintptr_t) (end - pos) < bytes) {
+        pos = (char*) ::malloc(arenaBlockBytes);
+        OCCA_CHECK(pos != NULL,
+                   "Parser ran out of memory");
+
+        end = pos + arenaBlockBytes;
+
+        blocks.push_back(pos);
+        reservedBytes += arenaBlockBytes;
+      }
+
+      void *ret = pos;
+      pos += bytes;
+
+      return ret;
+    }
+
+    void parseArena_t::release(void *ptr, const uintptr_t bytes) {
+      usedBytes -= bytes;
+
+      if(arenaMaxFreeListBytes < bytes) {
+        largeAllocs.erase(ptr);
+        ::free(ptr);
+        return;
+      }
+
+      void *&freeNode = freeLists[bytes / 16];
+
+      *((void**) ptr) = freeNode;
+      freeNode        = ptr;
+    }
+
+    void* arenaNew(const size_t bytes) {
+      const uintptr_t totalBytes = ((arenaHeaderBytes + bytes + 15) & ~((uintptr_t) 15));
+      arenaHeader_t *header;
+
+      if(activeArena)
+        header = (arenaHeader_t*) activeArena->alloc(totalBytes);
+      else
+        header = (arenaHeader_t*) ::operator new(totalBytes);
+
+      header->bytes = totalBytes;
+      header->arena = activeArena;
+
+      return (((char*) header) + arenaHeaderBytes);
+    }
+
+    void arenaDelete(void *ptr) {
+      if(ptr == NULL)
+        return;
+
+      arenaHeader_t *header = (arenaHeader_t*) (((char*) ptr) - arenaHeaderBytes);
+
+      // Nodes from an arena are only recycled while it is parsing,
+      //   otherwise they go away with it
+      if(header->arena == NULL)
+        ::operator delete(header);
+      else if(header->arena == activeArena)
+        activeArena->release(header, header->bytes);
+    }
+    //==============================================
   }
 }
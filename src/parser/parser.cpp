@@ -27,6 +27,7 @@ namespace occa {
     parserBase::parserBase() {
       env::initialize();
 
+      parseTime       = 0;
       parsingLanguage = parserInfo::parsingC;
 
       macrosAreInitialized = false;
@@ -40,6 +41,10 @@ namespace occa {
         delete globalScope;
         globalScope = NULL;
       }
+
+      // A parse that threw never restored the last arena
+      if (activeArena == &arena)
+        activeArena = NULL;
     }
 
     const std::string parserBase::parseFile(const std::string &header,
@@ -70,6 +75,11 @@ namespace occa {
     }
 
     const std::string parserBase::parseSource(const char *cRoot) {
+      const double startTime = currentTime();
+
+      parseArena_t *lastArena = activeArena;
+      activeArena = &arena;
+
       expNode allExp = splitAndPreprocessContent(cRoot, parsingLanguage);
       // allExp.print();
       // throw 1;
@@ -88,6 +98,8 @@ namespace occa {
       markKernelFunctions();
       labelNativeKernels();
 
+      specializeKernelArguments();
+
       if (hasMagicEnabled()) {
         magician::castMagicOn(*this);
         std::cout << (std::string) *globalScope;
@@ -109,6 +121,9 @@ namespace occa {
 
       applyToAllKernels(*globalScope, &parserBase::floatSharedAndExclusivesUp);
 
+      if (localizeExclusives())
+        applyToAllStatements(*globalScope, &parserBase::localizeExclusiveVariables);
+
       // [-] Missing
       modifyTextureVariables();
 
@@ -120,7 +135,12 @@ namespace occa {
 
       applyToAllStatements(*globalScope, &parserBase::modifyExclusiveVariables);
 
-      return (std::string) *globalScope;
+      const std::string parsedContent = (std::string) *globalScope;
+
+      activeArena = lastArena;
+      parseTime   = (currentTime() - startTime);
+
+      return parsedContent;
     }
 
     //---[ Parser Warnings ]------------
@@ -135,6 +155,12 @@ namespace occa {
       _warnForMissingBarriers      = flags.hasEnabled("warn-for-missing-barriers"    , true);
       _warnForConditionalBarriers  = flags.hasEnabled("warn-for-conditional-barriers", true);
       _insertBarriersAutomatically = flags.hasEnabled("automate-add-barriers"        , true);
+
+      _addSimdHints = (_compilingForCPU &&
+                       flags.hasEnabled("simd-inner-loops", true));
+
+      _localizeExclusives = (_compilingForCPU &&
+                             flags.hasEnabled("localize-exclusives", true));
     }
 
     bool parserBase::hasMagicEnabled() {
@@ -157,6 +183,14 @@ namespace occa {
     bool parserBase::insertBarriersAutomatically() {
       return _insertBarriersAutomatically;
     }
+
+    bool parserBase::addSimdHints() {
+      return _addSimdHints;
+    }
+
+    bool parserBase::localizeExclusives() {
+      return _localizeExclusives;
+    }
     //==================================
 
     //---[ Macro Parser Functions ]-------
@@ -1863,6 +1897,219 @@ namespace occa {
       }
     }
 
+    // kernelInfo::specializeArgument() variants pass the argument's bytes
+    //   as "specialize-<kernel>-<argPos>", uses become literals
+    void parserBase::specializeKernelArguments() {
+      statementNode *statementPos = globalScope->statementStart;
+
+      while(statementPos) {
+        statement &s = *(statementPos->value);
+
+        if (statementIsAKernel(s) &&
+           (s.statementStart != NULL)) {
+
+          const std::string flagPrefix = ("specialize-" + s.getFunctionName() + '-');
+          const int argc = s.getFunctionArgCount();
+
+          for (int i = 0; i < argc; ++i) {
+            const std::string flag = (flagPrefix + toString(i));
+
+            if (!parsingFlags.has(flag))
+              continue;
+
+            varInfo &arg = *(s.getFunctionArgVar(i));
+
+            const std::string value = specializedArgValue(arg, parsingFlags[flag]);
+
+            if (value.size() && !statementWritesVar(s, arg))
+              setVarToValue(s, arg, value);
+          }
+        }
+
+        statementPos = statementPos->right;
+      }
+    }
+
+    // Returns "" for arguments that can't be written as literals
+    std::string parserBase::specializedArgValue(varInfo &arg,
+                                                const std::string &hexValue) {
+      const int bytes = (int) (hexValue.size() / 2);
+
+      if (arg.pointerCount      ||
+          arg.stackPointerCount ||
+          (arg.baseType == NULL) ||
+          (bytes < 1) || (8 < bytes)) {
+
+        return "";
+      }
+
+      unsigned char data[8];
+
+      for (int i = 0; i < bytes; ++i) {
+        const std::string byte = hexValue.substr(2*i, 2);
+        data[i] = (unsigned char) ::strtol(byte.c_str(), NULL, 16);
+      }
+
+      const std::string &type = arg.baseType->name;
+      std::stringstream ss;
+
+      if ((type == "float") || (type == "double")) {
+        double value;
+
+        if ((type == "float") && (bytes == sizeof(float))) {
+          float fValue;
+          ::memcpy(&fValue, data, sizeof(float));
+
+          value = fValue;
+          ss << std::setprecision(9);
+        }
+        else if ((type == "double") && (bytes == sizeof(double))) {
+          ::memcpy(&value, data, sizeof(double));
+
+          ss << std::setprecision(17);
+        }
+        else
+          return "";
+
+        // inf and nan have no literals
+        if (value != value)
+          return "";
+
+        if ((value - value) != 0)
+          return "";
+
+        ss << std::scientific << value << ((type == "float") ? "f" : "");
+      }
+      else if ((type == "bool") || (type == "char") || (type == "short") ||
+               (type == "int")  || (type == "long")) {
+
+        const bool isUnsigned = arg.hasQualifier("unsigned");
+
+        if (isUnsigned) {
+          unsigned long long value = 0;
+
+          switch(bytes) {
+          case 1: {uint8_t  v; ::memcpy(&v, data, 1); value = v; break;}
+          case 2: {uint16_t v; ::memcpy(&v, data, 2); value = v; break;}
+          case 4: {uint32_t v; ::memcpy(&v, data, 4); value = v; break;}
+          case 8: {uint64_t v; ::memcpy(&v, data, 8); value = v; break;}
+          default: return "";
+          }
+
+          ss << value << ((bytes == 8) ? "ull" : "u");
+        }
+        else {
+          long long value = 0;
+
+          switch(bytes) {
+          case 1: {int8_t  v; ::memcpy(&v, data, 1); value = v; break;}
+          case 2: {int16_t v; ::memcpy(&v, data, 2); value = v; break;}
+          case 4: {int32_t v; ::memcpy(&v, data, 4); value = v; break;}
+          case 8: {int64_t v; ::memcpy(&v, data, 8); value = v; break;}
+          default: return "";
+          }
+
+          // The smallest value has no literal either
+          if ((bytes == 8) && (value == (long long) (1ULL << 63)))
+            return "";
+
+          if (type == "bool")
+            return (value ? "true" : "false");
+
+          ss << value << ((bytes == 8) ? "ll" : "");
+        }
+      }
+      else
+        return "";
+
+      const std::string ret = ss.str();
+
+      if (ret[0] == '-')
+        return ('(' + ret + ')');
+
+      return ret;
+    }
+
+    bool parserBase::statementWritesVar(statement &s, varInfo &var) {
+      if (expWritesVar(s.expRoot, var))
+        return true;
+
+      statementNode *statementPos = s.statementStart;
+
+      while(statementPos) {
+        if (statementWritesVar(*(statementPos->value), var))
+          return true;
+
+        statementPos = statementPos->right;
+      }
+
+      return false;
+    }
+
+    bool parserBase::expWritesVar(expNode &e, varInfo &var) {
+      if (e.info & expType::hasInfo)
+        return false;
+
+      if ((e.info & expType::operator_) &&
+          (0 < e.leafCount)             &&
+          (isAnUpdateOperator(e.value) ||
+           ((e.value == "&") && (e.leafCount == 1)))) {
+
+        expNode &lValue = *(e.leaves[0]);
+
+        if ((lValue.info & expType::varInfo) &&
+            (&(lValue.getVarInfo()) == &var)) {
+
+          return true;
+        }
+      }
+
+      for (int i = 0; i < e.leafCount; ++i) {
+        if (expWritesVar(*(e.leaves[i]), var))
+          return true;
+      }
+
+      return false;
+    }
+
+    void parserBase::setVarToValue(statement &s,
+                                   varInfo &var,
+                                   const std::string &value) {
+      // Keep the argument itself
+      if (!(s.info & smntType::functionStatement))
+        setVarToValue(s.expRoot, var, value);
+
+      statementNode *statementPos = s.statementStart;
+
+      while(statementPos) {
+        setVarToValue(*(statementPos->value), var, value);
+        statementPos = statementPos->right;
+      }
+    }
+
+    void parserBase::setVarToValue(expNode &e,
+                                   varInfo &var,
+                                   const std::string &value) {
+      if (e.info & expType::varInfo) {
+        if (!(e.info & expType::type) &&
+            (&(e.getVarInfo()) == &var)) {
+
+          e.freeThis();
+
+          e.info  = expType::presetValue;
+          e.value = value;
+        }
+
+        return;
+      }
+
+      if (e.info & expType::hasInfo)
+        return;
+
+      for (int i = 0; i < e.leafCount; ++i)
+        setVarToValue(*(e.leaves[i]), var, value);
+    }
+
     void parserBase::setupCudaVariables(statement &s) {
       if ((!(s.info & smntType::simpleStatement)    &&
           !(s.info & smntType::forStatement)       &&
@@ -2225,6 +2472,148 @@ namespace occa {
       return snTail;
     }
 
+    // CPU modes keep exclusive variables in occaPrivate_t arrays indexed by
+    //   the inner ids. Exclusives only used inside one inner loop don't
+    //   outlive an iteration, so they become locals of that loop
+    void parserBase::localizeExclusiveVariables(statement &s) {
+      if ((s.info != smntType::occaFor) ||
+          !statementIsOccaOuterFor(s)   ||
+          (getStatementKernel(s) == NULL)) {
+
+        return;
+      }
+
+      statementVector_t exclusives;
+
+      statementNode *statementPos = s.statementStart;
+
+      while(statementPos) {
+        statement &s2 = *(statementPos->value);
+
+        if ((s2.info & smntType::declareStatement) &&
+            s2.hasQualifier("exclusive")) {
+
+          // Give each exclusive its own declaration
+          if (1 < s2.getDeclarationVarCount()) {
+            splitDefineForVariable(s2.getDeclarationVarInfo(0));
+          }
+
+          exclusives.push_back(&s2);
+        }
+
+        statementPos = statementPos->right;
+      }
+
+      const int exclusiveCount = (int) exclusives.size();
+
+      for (int i = 0; i < exclusiveCount; ++i) {
+        statement &sDecl = *(exclusives[i]);
+        varInfo &var     = sDecl.getDeclarationVarInfo(0);
+
+        statement *sInner = NULL;
+        bool localizable  = true;
+
+        findInnerLoopUsing(s, s, sDecl, sInner, localizable);
+
+        if (localizable && sInner) {
+          s.removeFromScope(var);
+          s.removeStatement(sDecl);
+
+          sDecl.removeQualifier("exclusive");
+
+          sInner->pushLeftOf(sInner->statementStart->value, &sDecl);
+          sInner->scope->add(var);
+
+          continue;
+        }
+
+        // occaPrivate() drops the initial value, set it for every inner id
+        //   where the exclusive is declared. Inner loops of lower dims don't
+        //   reset the other ids, so they go back to their launch value (0)
+        expNode *initNode = sDecl.getDeclarationVarInitNode(0);
+
+        if ((initNode == NULL) || var.stackPointerCount)
+          continue;
+
+        s.pushSourceRightOf(sDecl.getStatementNode(),
+                            "occaInnerId2 = occaInnerId1 = occaInnerId0 = 0;");
+
+        s.pushSourceRightOf(sDecl.getStatementNode(),
+                            "for(occaInnerId2 = 0; occaInnerId2 < occaInnerDim2; ++occaInnerId2)"
+                            " for(occaInnerId1 = 0; occaInnerId1 < occaInnerDim1; ++occaInnerId1)"
+                            " for(occaInnerId0 = 0; occaInnerId0 < occaInnerDim0; ++occaInnerId0) "
+                            + var.name + " = " + (std::string) *initNode + ";");
+      }
+    }
+
+    void parserBase::findInnerLoopUsing(statement &sOuter,
+                                        statement &s,
+                                        statement &sDecl,
+                                        statement *&sInner,
+                                        bool &localizable) {
+      statementNode *statementPos = s.statementStart;
+
+      while(localizable && statementPos) {
+        statement &s2 = *(statementPos->value);
+
+        if (&s2 != &sDecl) {
+          varInfo &var = sDecl.getDeclarationVarInfo(0);
+
+          if (expUsesVar(s2.expRoot, var)) {
+            statement *sUp = s2.up;
+
+            while(sUp && (sUp != &sOuter) &&
+                  (sUp->expRoot.value != "occaInnerFor0")) {
+
+              sUp = sUp->up;
+            }
+
+            if ((sUp == NULL) || (sUp == &sOuter) ||
+                (sInner && (sInner != sUp))) {
+
+              localizable = false;
+            }
+            else
+              sInner = sUp;
+
+            // Sequential loops around the inner loop run it more than
+            //   once, the exclusive has to outlive its iterations
+            statement *sLoop = (localizable ? sUp->up : NULL);
+
+            while(sLoop && (sLoop != &sOuter)) {
+              if ((sLoop->info != smntType::occaFor) &&
+                  (sLoop->info & (smntType::forStatement |
+                                  smntType::whileStatement))) {
+
+                localizable = false;
+              }
+
+              sLoop = sLoop->up;
+            }
+          }
+
+          findInnerLoopUsing(sOuter, s2, sDecl, sInner, localizable);
+        }
+
+        statementPos = statementPos->right;
+      }
+    }
+
+    bool parserBase::expUsesVar(expNode &e, varInfo &var) {
+      if (e.info & expType::varInfo)
+        return (&(e.getVarInfo()) == &var);
+
+      if (e.info & expType::hasInfo)
+        return false;
+
+      for (int i = 0; i < e.leafCount; ++i) {
+        if (expUsesVar(*(e.leaves[i]), var))
+          return true;
+      }
+
+      return false;
+    }
+
     void parserBase::modifyExclusiveVariables(statement &s) {
       if ( !(s.info & smntType::declareStatement)   ||
           (getStatementKernel(s) == NULL)    ||
@@ -2650,6 +3039,9 @@ namespace occa {
 
         newSKernel.pushSourceLeftOf(omLoop.getStatementNode(),
                                     "occaParallelFor0");
+
+        if (addSimdHints())
+          addSimdHintsTo(sKernel, newSKernel, omLoop);
       }
 
       return newKernels;
@@ -2875,6 +3267,365 @@ namespace occa {
       sKernel.addFunctionArg(1, nestedKernelsArg);
     }
 
+    //---[ SIMD Hints ]-----------------
+    void parserBase::addSimdHintsTo(statement &sKernel,
+                                    statement &newSKernel,
+                                    statement &omLoop) {
+      statementVector_t occaLoops;
+      findOccaLoops(omLoop, occaLoops);
+
+      const int loopCount = (int) occaLoops.size();
+
+      for (int i = 0; i < loopCount; ++i) {
+        statement &sInner = *(occaLoops[i]);
+
+        if (sInner.expRoot.value != "occaInnerFor0")
+          continue;
+
+        strToBoolMap_t localVars, innerVars;
+        innerVars["occaInnerId0"] = true;
+
+        statementNode *statementPos = sInner.statementStart;
+        bool vectorizable = true;
+
+        while(vectorizable && statementPos) {
+          vectorizable = innerLoopIsVectorizable(*(statementPos->value),
+                                                 localVars,
+                                                 innerVars);
+
+          statementPos = statementPos->right;
+        }
+
+        if (vectorizable)
+          sInner.up->pushSourceLeftOf(sInner.getStatementNode(),
+                                      "occaSimdFor0");
+      }
+
+      // Read-only pointer arguments are marked restrict unless an
+      //   argument is read after another one was written
+      strToBoolMap_t pointerArgs, writtenArgs;
+      bool argsMayAlias = false;
+
+      const int argc = sKernel.getFunctionArgCount();
+
+      for (int i = 0; i < argc; ++i) {
+        varInfo &argVar = *(sKernel.getFunctionArgVar(i));
+
+        if (argVar.pointerDepth() == 1)
+          pointerArgs[argVar.name] = true;
+      }
+
+      findWrittenArgs(omLoop, pointerArgs, writtenArgs, argsMayAlias);
+
+      if (!argsMayAlias) {
+        const int newArgc = newSKernel.getFunctionArgCount();
+
+        for (int i = 0; i < newArgc; ++i) {
+          varInfo &argVar = *(newSKernel.getFunctionArgVar(i));
+
+          if ((argVar.pointerDepth() == 1)                            &&
+              (pointerArgs.find(argVar.name) != pointerArgs.end())    &&
+              (writtenArgs.find(argVar.name) == writtenArgs.end())    &&
+              !argVar.hasRightQualifier("occaRestrict")) {
+
+            argVar.addRightQualifier("occaRestrict");
+          }
+        }
+      }
+
+      alignSharedArrays(omLoop);
+    }
+
+    bool parserBase::innerLoopIsVectorizable(statement &s,
+                                             strToBoolMap_t &localVars,
+                                             strToBoolMap_t &innerVars,
+                                             const int seqDepth) {
+      if (s.info == smntType::occaFor)
+        return false;
+
+      // break is only allowed inside nested loops and switches
+      const bool canBreak = ((s.info & (smntType::forStatement   |
+                                        smntType::whileStatement |
+                                        smntType::switchStatement)) != 0);
+
+      const int depth = seqDepth + canBreak;
+
+      if (!expIsVectorizable(s.expRoot, localVars, innerVars, depth))
+        return false;
+
+      statementNode *statementPos = s.statementStart;
+
+      while(statementPos) {
+        if (!innerLoopIsVectorizable(*(statementPos->value),
+                                     localVars,
+                                     innerVars,
+                                     depth)) {
+          return false;
+        }
+
+        statementPos = statementPos->right;
+      }
+
+      return true;
+    }
+
+    bool parserBase::expIsVectorizable(expNode &e,
+                                       strToBoolMap_t &localVars,
+                                       strToBoolMap_t &innerVars,
+                                       const int seqDepth) {
+      if (e.info & expType::hasInfo) {
+        if (e.info & expType::varInfo) {
+          varInfo &var = e.getVarInfo();
+
+          // occaPrivate_t reads the loop index through a reference
+          if (var.hasQualifier("exclusive"))
+            return false;
+
+          if (e.info & expType::type)
+            localVars[var.name] = true;
+        }
+
+        return true;
+      }
+
+      if ((e.info & (expType::return_ | expType::goto_)) ||
+          ((e.info & expType::transfer_) &&
+           (e.value == "break")          &&
+           (seqDepth == 0))) {
+
+        return false;
+      }
+
+      if ((e.value == "occaBarrier") ||
+          (e.value == "printf")      ||
+          (e.value.find("tomic") != std::string::npos)) {
+
+        return false;
+      }
+
+      if ((e.info & expType::operator_) &&
+          (0 < e.leafCount)             &&
+          isAnUpdateOperator(e.value)) {
+
+        expNode *lValue = e.leaves[0];
+
+        while(((lValue->value == ".") || (lValue->value == "->")) &&
+              (0 < lValue->leafCount)) {
+
+          lValue = lValue->leaves[0];
+        }
+
+        if (lValue->value == "[") {
+          // Writes must land on a different element every iteration
+          bool usesInnerId = false;
+
+          while((lValue->value == "[") &&
+                (lValue->leafCount == 2)) {
+
+            usesInnerId = (usesInnerId ||
+                           expUsesVars(*(lValue->leaves[1]), innerVars));
+
+            lValue = lValue->leaves[0];
+          }
+
+          if (!usesInnerId)
+            return false;
+        }
+        else if (lValue->info & expType::varInfo) {
+          varInfo &var = lValue->getVarInfo();
+
+          if (lValue->info & expType::type)
+            localVars[var.name] = true;
+
+          // Scalars from outside the loop carry values between iterations
+          if (localVars.find(var.name) == localVars.end())
+            return false;
+
+          if ((e.leafCount == 2) &&
+              expUsesVars(*(e.leaves[1]), innerVars)) {
+
+            innerVars[var.name] = true;
+          }
+        }
+        else
+          return false;
+      }
+
+      for (int i = 0; i < e.leafCount; ++i) {
+        if (!expIsVectorizable(*(e.leaves[i]), localVars, innerVars, seqDepth))
+          return false;
+      }
+
+      return true;
+    }
+
+    bool parserBase::expUsesVars(expNode &e, strToBoolMap_t &vars) {
+      if (e.info & expType::varInfo)
+        return (vars.find(e.getVarInfo().name) != vars.end());
+
+      if (e.info & expType::hasInfo)
+        return false;
+
+      if (vars.find(e.value) != vars.end())
+        return true;
+
+      for (int i = 0; i < e.leafCount; ++i) {
+        if (expUsesVars(*(e.leaves[i]), vars))
+          return true;
+      }
+
+      return false;
+    }
+
+    void parserBase::findWrittenArgs(statement &s,
+                                     strToBoolMap_t &pointerArgs,
+                                     strToBoolMap_t &writtenArgs,
+                                     bool &argsMayAlias,
+                                     const int seqDepth) {
+      const bool isSeqLoop = ((s.info != smntType::occaFor) &&
+                              (s.info & (smntType::forStatement |
+                                         smntType::whileStatement)));
+
+      const int depth = seqDepth + isSeqLoop;
+
+      strToBoolMap_t readArgs, newWrittenArgs;
+
+      findArgAccesses(s.expRoot,
+                      pointerArgs,
+                      readArgs, newWrittenArgs,
+                      argsMayAlias);
+
+      cStrToBoolMapIterator readIt = readArgs.begin();
+
+      while(readIt != readArgs.end()) {
+        cStrToBoolMapIterator writeIt = writtenArgs.begin();
+
+        while(writeIt != writtenArgs.end()) {
+          if (writeIt->first != readIt->first)
+            argsMayAlias = true;
+
+          ++writeIt;
+        }
+
+        ++readIt;
+      }
+
+      if (newWrittenArgs.size()) {
+        // Writes inside sequential loops come before the next iteration's reads
+        if (0 < depth)
+          argsMayAlias = true;
+
+        writtenArgs.insert(newWrittenArgs.begin(), newWrittenArgs.end());
+      }
+
+      statementNode *statementPos = s.statementStart;
+
+      while(statementPos) {
+        findWrittenArgs(*(statementPos->value),
+                        pointerArgs,
+                        writtenArgs,
+                        argsMayAlias,
+                        depth);
+
+        statementPos = statementPos->right;
+      }
+    }
+
+    void parserBase::findArgAccesses(expNode &e,
+                                     strToBoolMap_t &pointerArgs,
+                                     strToBoolMap_t &readArgs,
+                                     strToBoolMap_t &writtenArgs,
+                                     bool &argsMayAlias) {
+      if (e.info & expType::hasInfo) {
+        // Arguments used outside of [] can be passed on or offset
+        if ((e.info & expType::varInfo)   &&
+            !(e.info & expType::type)     &&
+            (pointerArgs.find(e.getVarInfo().name) != pointerArgs.end())) {
+
+          argsMayAlias = true;
+        }
+
+        return;
+      }
+
+      int firstLeaf = 0;
+
+      if ((e.info & expType::operator_) &&
+          (0 < e.leafCount)             &&
+          isAnUpdateOperator(e.value)) {
+
+        expNode *lValue = e.leaves[0];
+
+        while(((lValue->value == ".") || (lValue->value == "->")) &&
+              (0 < lValue->leafCount)) {
+
+          lValue = lValue->leaves[0];
+        }
+
+        if ((lValue->value == "[")                        &&
+            (lValue->leafCount == 2)                      &&
+            (lValue->leaves[0]->info & expType::varInfo)) {
+
+          const std::string &name = lValue->leaves[0]->getVarInfo().name;
+
+          if (pointerArgs.find(name) != pointerArgs.end()) {
+            writtenArgs[name] = true;
+
+            findArgAccesses(*(lValue->leaves[1]),
+                            pointerArgs,
+                            readArgs, writtenArgs,
+                            argsMayAlias);
+
+            firstLeaf = 1;
+          }
+        }
+      }
+      else if ((e.value == "[")                        &&
+               (e.leafCount == 2)                      &&
+               (e.leaves[0]->info & expType::varInfo)) {
+
+        const std::string &name = e.leaves[0]->getVarInfo().name;
+
+        if (pointerArgs.find(name) != pointerArgs.end()) {
+          readArgs[name] = true;
+          firstLeaf      = 1;
+        }
+      }
+
+      for (int i = firstLeaf; i < e.leafCount; ++i) {
+        findArgAccesses(*(e.leaves[i]),
+                        pointerArgs,
+                        readArgs, writtenArgs,
+                        argsMayAlias);
+      }
+    }
+
+    void parserBase::alignSharedArrays(statement &s) {
+      if ((s.info & smntType::declareStatement) &&
+          s.hasQualifier("occaShared")) {
+
+        const int varCount = s.getDeclarationVarCount();
+
+        for (int i = 0; i < varCount; ++i) {
+          varInfo &var = s.getDeclarationVarInfo(i);
+
+          if (var.stackPointerCount &&
+              !var.hasQualifier("occaAligned")) {
+
+            var.addQualifier("occaAligned", 0);
+          }
+        }
+      }
+
+      statementNode *statementPos = s.statementStart;
+
+      while(statementPos) {
+        alignSharedArrays(*(statementPos->value));
+        statementPos = statementPos->right;
+      }
+    }
+    //==================================
+
     int parserBase::getKernelOuterDim(statement &s) {
       return getKernelDimFor(s, "outer");
     }
@@ -2965,7 +3716,7 @@ namespace occa {
       if (argPos) {
         statement &s        = origin.pushNewStatementLeft(smntType::declareStatement);
         s.expRoot.info      = origin.expRoot.info;
-        s.expRoot.leaves    = new expNode*[argPos];
+        s.expRoot.leaves    = newLeafArray(argPos);
         s.expRoot.leafCount = argPos;
 
         for (int i = 0; i < argPos; ++i) {
@@ -2981,7 +3732,7 @@ namespace occa {
 
         statement &s        = origin.pushNewStatementRight(smntType::declareStatement);
         s.expRoot.info      = origin.expRoot.info;
-        s.expRoot.leaves    = new expNode*[newLeafCount];
+        s.expRoot.leaves    = newLeafArray(newLeafCount);
         s.expRoot.leafCount = newLeafCount;
 
         for (int i = 0; i < newLeafCount; ++i) {
@@ -4100,6 +4851,8 @@ namespace occa {
       cKeywordType["occaParallelFor1"]   = expType::specialKeyword;
       cKeywordType["occaParallelFor2"]   = expType::specialKeyword;
 
+      cKeywordType["occaSimdFor0"]       = expType::specialKeyword;
+
       cKeywordType["occaUnroll"]         = expType::specialKeyword;
 
       //---[ CUDA Keywords ]--------------
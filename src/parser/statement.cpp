@@ -307,6 +307,13 @@ namespace occa {
           return;
         }
 
+        if(firstValue == "occaSimdFor0"){
+          sInfo->info = smntType::macroStatement;
+          info        = expType::printValue;
+
+          return;
+        }
+
         if(firstValue == "occaUnroll"){
           organizeNode();
 
@@ -1851,7 +1858,7 @@ namespace occa {
 
       leaf->info      = expType::L;
       leaf->leafCount = 1;
-      leaf->leaves    = new expNode*[1];
+      leaf->leaves    = newLeafArray(1);
       leaf->leaves[0] = sLeaf;
 
       sLeaf->up = leaf;
@@ -1878,7 +1885,7 @@ namespace occa {
 
       leaf->info      = expType::R;
       leaf->leafCount = 1;
-      leaf->leaves    = new expNode*[1];
+      leaf->leaves    = newLeafArray(1);
       leaf->leaves[0] = sLeaf;
 
       sLeaf->up = leaf;
@@ -1906,7 +1913,7 @@ namespace occa {
 
       leaf->info      = expType::LR;
       leaf->leafCount = 2;
-      leaf->leaves    = new expNode*[2];
+      leaf->leaves    = newLeafArray(2);
       leaf->leaves[0] = sLeafL;
       leaf->leaves[1] = sLeafR;
 
@@ -1937,7 +1944,7 @@ namespace occa {
 
       leaf->info      = expType::LCR;
       leaf->leafCount = 3;
-      leaf->leaves    = new expNode*[3];
+      leaf->leaves    = newLeafArray(3);
       leaf->leaves[0] = sLeafL;
       leaf->leaves[1] = sLeafC;
       leaf->leaves[2] = sLeafR;
@@ -2301,7 +2308,7 @@ namespace occa {
         newExp.leafCount = leafCount;
 
         if(leafCount){
-          newExp.leaves = new expNode*[leafCount];
+          newExp.leaves = newLeafArray(leafCount);
 
           for(int i = 0; i < leafCount; ++i){
             newExp.leaves[i] = new expNode( newExp.makeFloatingLeaf() );
@@ -2375,7 +2382,7 @@ namespace occa {
         return flatNode;
 
       flatNode->info   = expType::printLeaves;
-      flatNode->leaves = new expNode*[addMe + nestedLeafCount()];
+      flatNode->leaves = newLeafArray(addMe + nestedLeafCount());
 
       int offset = 0;
       makeDumbFlatHandle(offset, flatNode->leaves);
@@ -2413,7 +2420,7 @@ namespace occa {
         return flatNode;
 
       flatNode->info   = expType::printLeaves;
-      flatNode->leaves = new expNode*[addMe + nestedLeafCount()];
+      flatNode->leaves = newLeafArray(addMe + nestedLeafCount());
 
       int offset = 0;
       makeFlatHandle(offset, flatNode->leaves);
@@ -2486,7 +2493,7 @@ namespace occa {
 
     void expNode::freeFlatHandle(expNode &flatRoot){
       if(flatRoot.leafCount)
-        delete [] flatRoot.leaves;
+        freeLeafArray(flatRoot.leaves);
 
       delete &flatRoot;
     }
@@ -2509,7 +2516,7 @@ namespace occa {
 
         if(pass == 1){
           flatNode->info      = expType::printLeaves;
-          flatNode->leaves    = new expNode*[csvCount];
+          flatNode->leaves    = newLeafArray(csvCount);
           flatNode->leafCount = csvCount;
 
           if(csvCount == 1){
@@ -2642,7 +2649,7 @@ namespace occa {
     void expNode::reserveAndShift(const int pos,
                                   const int count){
 
-      expNode **newLeaves = new expNode*[leafCount + count];
+      expNode **newLeaves = newLeafArray(leafCount + count);
 
       //---[ Add Leaves ]-----
       for(int i = 0; i < pos; ++i)
@@ -2653,7 +2660,7 @@ namespace occa {
       //======================
 
       if(leafCount)
-        delete [] leaves;
+        freeLeafArray(leaves);
 
       leaves = newLeaves;
 
@@ -3281,7 +3288,7 @@ namespace occa {
     void expNode::free(){
       // Let the parser free all varInfos
       if(info & expType::hasInfo){
-        delete [] leaves;
+        freeLeafArray(leaves);
         return;
       }
 
@@ -3291,7 +3298,7 @@ namespace occa {
       }
 
       leafCount = 0;
-      delete [] leaves;
+      freeLeafArray(leaves);
     }
 
     void expNode::freeThis(){
@@ -3299,7 +3306,7 @@ namespace occa {
         leafCount = 0;
 
         if(leaves)
-          delete [] leaves;
+          freeLeafArray(leaves);
 
         leaves = NULL;
       }
@@ -5283,7 +5290,7 @@ namespace occa {
 
       up->addStatement(&newS);
 
-      pushLastStatementRightOf(this);
+      up->pushLastStatementRightOf(this);
 
       return newS;
     }
@@ -2185,7 +2185,7 @@ namespace occa {
       stackExp.info  = expType::C;
       stackExp.value = "[";
 
-      stackExp.leaves    = new expNode*[1];
+      stackExp.leaves    = newLeafArray(1);
       stackExp.leafCount = 1;
 
       stackExp.leaves[0] = &valueExp;
@@ -8,6 +8,58 @@ OCCA_START_EXTERN_C
 #  define STR_TO_PYOBJECT(charPtr) PyString_FromString(charPtr)
 #endif
 
+//---[ Buffers ]------------------------
+// Pointer arguments take either a raw address or an object exporting
+//   the buffer protocol (numpy.ndarray, bytearray, ...)
+//   Raw addresses come back with [view->obj == NULL] and an unknown length
+static int py_occaGetBuffer(PyObject *obj, Py_buffer *view, const int writable){
+  if(!PyObject_CheckBuffer(obj)){
+    void *ptr = PyLong_AsVoidPtr(obj);
+
+    if(PyErr_Occurred())
+      return 0;
+
+    PyBuffer_FillInfo(view, NULL, ptr, 0, 0, PyBUF_SIMPLE);
+    return 1;
+  }
+
+  const int flags = (writable ?
+                     (PyBUF_C_CONTIGUOUS | PyBUF_WRITABLE) :
+                     PyBUF_C_CONTIGUOUS);
+
+  return (PyObject_GetBuffer(obj, view, flags) == 0);
+}
+
+static int py_occaCheckBuffer(Py_buffer *view, const size_t bytes){
+  if((view->obj == NULL) || (bytes <= (size_t) view->len))
+    return 1;
+
+  PyErr_Format(PyExc_ValueError,
+               "Buffer holds [%zd] bytes, [%zu] bytes were requested",
+               view->len, bytes);
+
+  PyBuffer_Release(view);
+  return 0;
+}
+
+// CPU modes keep memory in host RAM, other modes only through mapped allocations
+static void* py_occaHostPointer(occaMemory memory){
+  void *ptr = occaMemoryGetMappedPointer(memory);
+
+  if(ptr != NULL)
+    return ptr;
+
+  const char *mode = occaMemoryMode(memory);
+
+  if((strcmp(mode, "Serial")   == 0) ||
+     (strcmp(mode, "OpenMP")   == 0) ||
+     (strcmp(mode, "Pthreads") == 0))
+    return occaMemoryGetMemoryHandle(memory);
+
+  return NULL;
+}
+//======================================
+
 //---[ Globals & Flags ]----------------
 static PyObject* py_occaSetVerboseCompilation(PyObject *self, PyObject *args){
   int value;
@@ -234,13 +286,17 @@ static PyObject* py_occaGetCompilerFlags(PyObject *self, PyObject *args){
 }
 
 static PyObject* py_occaFlush(PyObject *self, PyObject *args){
+  Py_BEGIN_ALLOW_THREADS
   occaFlush();
+  Py_END_ALLOW_THREADS
 
   return Py_None;
 }
 
 static PyObject* py_occaFinish(PyObject *self, PyObject *args){
+  Py_BEGIN_ALLOW_THREADS
   occaFinish();
+  Py_END_ALLOW_THREADS
 
   return Py_None;
 }
@@ -289,7 +345,11 @@ static PyObject* py_occaBuildKernel(PyObject *self, PyObject *args){
   if(!PyArg_ParseTuple(args, "ssn", &str, &functionName, &kInfo))
     return NULL;
 
-  occaKernel kernel = occaBuildKernel(str, functionName, kInfo);
+  occaKernel kernel;
+
+  Py_BEGIN_ALLOW_THREADS
+  kernel = occaBuildKernel(str, functionName, kInfo);
+  Py_END_ALLOW_THREADS
 
   return PyLong_FromVoidPtr(kernel);
 }
@@ -301,7 +361,11 @@ static PyObject* py_occaBuildKernelFromSource(PyObject *self, PyObject *args){
   if(!PyArg_ParseTuple(args, "ssn", &filename, &functionName, &kInfo))
     return NULL;
 
-  occaKernel kernel = occaBuildKernelFromSource(filename, functionName, kInfo);
+  occaKernel kernel;
+
+  Py_BEGIN_ALLOW_THREADS
+  kernel = occaBuildKernelFromSource(filename, functionName, kInfo);
+  Py_END_ALLOW_THREADS
 
   return PyLong_FromVoidPtr(kernel);
 }
@@ -314,12 +378,14 @@ static PyObject* py_occaBuildKernelFromString(PyObject *self, PyObject *args){
   if(!PyArg_ParseTuple(args, "sssn", &source, &functionName, &kInfo, &language))
     return NULL;
 
+  Py_BEGIN_ALLOW_THREADS
   if(strcmp(language, "OFL") == 0)
     kernel = occaBuildKernelFromString(source, functionName, kInfo, occaUsingOFL);
   else if(strcmp(language, "Native") == 0)
     kernel = occaBuildKernelFromString(source, functionName, kInfo, occaUsingNative);
   else
     kernel = occaBuildKernelFromString(source, functionName, kInfo, occaUsingOKL);
+  Py_END_ALLOW_THREADS
 
   return PyLong_FromVoidPtr(kernel);
 }
@@ -330,24 +396,39 @@ static PyObject* py_occaBuildKernelFromBinary(PyObject *self, PyObject *args){
   if(!PyArg_ParseTuple(args, "ss", &binary, &functionName))
     return NULL;
 
-  occaKernel kernel = occaBuildKernelFromBinary(binary, functionName);
+  occaKernel kernel;
+
+  Py_BEGIN_ALLOW_THREADS
+  kernel = occaBuildKernelFromBinary(binary, functionName);
+  Py_END_ALLOW_THREADS
 
   return PyLong_FromVoidPtr(kernel);
 }
 //  |===================================
 
 //  |---[ Memory ]----------------------
+// The wrapped buffer isn't copied, the caller keeps it alive and
+//   releases the memory with memoryDetach()
 static PyObject* py_occaWrapMemory(PyObject *self, PyObject *args){
-  void *handle;
+  PyObject *handle;
+  Py_buffer view;
   size_t entries;
   int typeSize;
 
-  if(!PyArg_ParseTuple(args, "nni", &handle, &entries, &typeSize))
+  if(!PyArg_ParseTuple(args, "Oni", &handle, &entries, &typeSize))
+    return NULL;
+
+  if(!py_occaGetBuffer(handle, &view, 1))
     return NULL;
 
   const size_t bytes = (entries * typeSize);
 
-  occaMemory memory = occaWrapMemory(handle, bytes);
+  if(!py_occaCheckBuffer(&view, bytes))
+    return NULL;
+
+  occaMemory memory = occaWrapMemory(view.buf, bytes);
+
+  PyBuffer_Release(&view);
 
   return PyLong_FromVoidPtr(memory);
 }
@@ -391,7 +472,7 @@ static PyObject* py_occaManagedAlloc(PyObject *self, PyObject *args){
   const size_t bytes = (entries * typeSize);
 
   int nd         = 1;
-  npy_intp *dims = (npy_intp*) malloc(1*sizeof(npy_intp));
+  npy_intp dims[1];
   dims[0]        = entries;
   void *data     = occaManagedAlloc(bytes, NULL);
 
@@ -422,7 +503,7 @@ static PyObject* py_occaManagedMappedAlloc(PyObject *self, PyObject *args){
   const size_t bytes = (entries * typeSize);
 
   int nd         = 1;
-  npy_intp *dims = (npy_intp*) malloc(1*sizeof(npy_intp));
+  npy_intp dims[1];
   dims[0]        = entries;
   void *data     = occaManagedMappedAlloc(bytes, NULL);
 
@@ -552,7 +633,11 @@ static PyObject* py_occaDeviceBuildKernel(PyObject *self, PyObject *args){
   if(!PyArg_ParseTuple(args, "nssn", &device, &str, &functionName, &kInfo))
     return NULL;
 
-  occaKernel kernel = occaDeviceBuildKernel(device, str, functionName, kInfo);
+  occaKernel kernel;
+
+  Py_BEGIN_ALLOW_THREADS
+  kernel = occaDeviceBuildKernel(device, str, functionName, kInfo);
+  Py_END_ALLOW_THREADS
 
   return PyLong_FromVoidPtr(kernel);
 }
@@ -565,7 +650,11 @@ static PyObject* py_occaDeviceBuildKernelFromSource(PyObject *self, PyObject *ar
   if(!PyArg_ParseTuple(args, "nssn", &device, &filename, &functionName, &kInfo))
     return NULL;
 
-  occaKernel kernel = occaDeviceBuildKernelFromSource(device, filename, functionName, kInfo);
+  occaKernel kernel;
+
+  Py_BEGIN_ALLOW_THREADS
+  kernel = occaDeviceBuildKernelFromSource(device, filename, functionName, kInfo);
+  Py_END_ALLOW_THREADS
 
   return PyLong_FromVoidPtr(kernel);
 }
@@ -578,12 +667,14 @@ static PyObject* py_occaDeviceBuildKernelFromString(PyObject *self, PyObject *ar
   if(!PyArg_ParseTuple(args, "sssn", &filename, &functionName, &kInfo, &language))
     return NULL;
 
+  Py_BEGIN_ALLOW_THREADS
   if(strcmp(language, "OFL") == 0)
     kernel = occaBuildKernelFromString(filename, functionName, kInfo, occaUsingOFL);
   else if(strcmp(language, "Native") == 0)
     kernel = occaBuildKernelFromString(filename, functionName, kInfo, occaUsingNative);
   else
     kernel = occaBuildKernelFromString(filename, functionName, kInfo, occaUsingOKL);
+  Py_END_ALLOW_THREADS
 
   return PyLong_FromVoidPtr(kernel);
 }
@@ -594,7 +685,11 @@ static PyObject* py_occaDeviceBuildKernelFromBinary(PyObject *self, PyObject *ar
   if(!PyArg_ParseTuple(args, "ss", &filename, &functionName))
     return NULL;
 
-  occaKernel kernel = occaBuildKernelFromBinary(filename, functionName);
+  occaKernel kernel;
+
+  Py_BEGIN_ALLOW_THREADS
+  kernel = occaBuildKernelFromBinary(filename, functionName);
+  Py_END_ALLOW_THREADS
 
   return PyLong_FromVoidPtr(kernel);
 }
@@ -625,7 +720,7 @@ static PyObject* py_occaDeviceManagedAlloc(PyObject *self, PyObject *args){
   const size_t bytes = (entries * typeSize);
 
   int nd         = 1;
-  npy_intp *dims = (npy_intp*) malloc(1*sizeof(npy_intp));
+  npy_intp dims[1];
   dims[0]        = entries;
   void *data     = occaManagedAlloc(bytes, NULL);
 
@@ -658,7 +753,7 @@ static PyObject* py_occaDeviceManagedMappedAlloc(PyObject *self, PyObject *args)
   const size_t bytes = (entries * typeSize);
 
   int nd         = 1;
-  npy_intp *dims = (npy_intp*) malloc(1*sizeof(npy_intp));
+  npy_intp dims[1];
   dims[0]        = entries;
   void *data     = occaDeviceManagedMappedAlloc(device, bytes, NULL);
 
@@ -671,7 +766,9 @@ static PyObject* py_occaDeviceFlush(PyObject *self, PyObject *args){
   if(!PyArg_ParseTuple(args, "n", &device))
     return NULL;
 
+  Py_BEGIN_ALLOW_THREADS
   occaDeviceFlush(device);
+  Py_END_ALLOW_THREADS
 
   return Py_None;
 }
@@ -682,7 +779,9 @@ static PyObject* py_occaDeviceFinish(PyObject *self, PyObject *args){
   if(!PyArg_ParseTuple(args, "n", &device))
     return NULL;
 
+  Py_BEGIN_ALLOW_THREADS
   occaDeviceFinish(device);
+  Py_END_ALLOW_THREADS
 
   return Py_None;
 }
@@ -819,15 +918,40 @@ static PyObject* py_occaArgumentListFree(PyObject *self, PyObject *args){
   return Py_None;
 }
 
+// Arrays are passed by address as a pointer scalar, nothing is copied
+//   or allocated for them
 static PyObject* py_occaArgumentListAddArg(PyObject *self, PyObject *args){
   occaArgumentList argList;
   int argPos;
-  occaType type;
+  PyObject *arg;
 
-  if(!PyArg_ParseTuple(args, "nin", &argList, &argPos, &type))
+  if(!PyArg_ParseTuple(args, "niO", &argList, &argPos, &arg))
     return NULL;
 
-  occaArgumentListAddArg(argList, argPos, type);
+  if(PyObject_CheckBuffer(arg)){
+    Py_buffer view;
+    occaScalar ptr;
+
+    if(!py_occaGetBuffer(arg, &view, 0))
+      return NULL;
+
+    ptr.ptr         = NULL;
+    ptr.type        = OCCA_TYPE_PTR;
+    ptr.bytes       = sizeof(void*);
+    ptr.value.void_ = view.buf;
+
+    occaArgumentListAddArg(argList, argPos, &ptr);
+
+    PyBuffer_Release(&view);
+  }
+  else{
+    occaType type = (occaType) PyLong_AsVoidPtr(arg);
+
+    if(PyErr_Occurred())
+      return NULL;
+
+    occaArgumentListAddArg(argList, argPos, type);
+  }
 
   return Py_None;
 }
@@ -839,7 +963,9 @@ static PyObject* py_occaKernelRun(PyObject *self, PyObject *args){
   if(!PyArg_ParseTuple(args, "nn", &kernel, &argList))
     return NULL;
 
+  Py_BEGIN_ALLOW_THREADS
   occaKernelRun_(kernel, argList);
+  Py_END_ALLOW_THREADS
 
   return Py_None;
 }
@@ -943,26 +1069,110 @@ static PyObject* py_occaMemoryGetTextureHandle(PyObject *self, PyObject *args){
   return PyLong_FromVoidPtr(handle);
 }
 
+static PyObject* py_occaMemoryBytes(PyObject *self, PyObject *args){
+  occaMemory memory;
+
+  if(!PyArg_ParseTuple(args, "n", &memory))
+    return NULL;
+
+  uintptr_t bytes = occaMemoryBytes(memory);
+
+  return PyLong_FromSize_t((size_t) bytes);
+}
+
+// Address numpy can use in place (__array_interface__), no copies
+static PyObject* py_occaMemoryHostPointer(PyObject *self, PyObject *args){
+  occaMemory memory;
+
+  if(!PyArg_ParseTuple(args, "n", &memory))
+    return NULL;
+
+  void *ptr = py_occaHostPointer(memory);
+
+  if(ptr == NULL){
+    PyErr_Format(PyExc_ValueError,
+                 "[%s] memory isn't host-accessible, use a mapped allocation or copy it",
+                 occaMemoryMode(memory));
+    return NULL;
+  }
+
+  return PyLong_FromVoidPtr(ptr);
+}
+
 static PyObject* py_occaMemcpy(PyObject *self, PyObject *args){
-  void *dest, *str;
+  PyObject *dest, *src;
+  Py_buffer destView, srcView;
   size_t bytes;
 
-  if(!PyArg_ParseTuple(args, "nnn", &dest, &str, &bytes))
+  if(!PyArg_ParseTuple(args, "OOn", &dest, &src, &bytes))
+    return NULL;
+
+  if(!py_occaGetBuffer(dest, &destView, 1))
+    return NULL;
+
+  if(!py_occaGetBuffer(src, &srcView, 0)){
+    PyBuffer_Release(&destView);
     return NULL;
+  }
 
-  occaMemcpy(dest, str, bytes);
+  if(bytes == 0)
+    bytes = (srcView.obj ? srcView.len : destView.len);
+
+  if(!py_occaCheckBuffer(&srcView, bytes)){
+    PyBuffer_Release(&destView);
+    return NULL;
+  }
+
+  if(!py_occaCheckBuffer(&destView, bytes)){
+    PyBuffer_Release(&srcView);
+    return NULL;
+  }
+
+  Py_BEGIN_ALLOW_THREADS
+  occaMemcpy(destView.buf, srcView.buf, bytes);
+  Py_END_ALLOW_THREADS
+
+  PyBuffer_Release(&destView);
+  PyBuffer_Release(&srcView);
 
   return Py_None;
 }
 
 static PyObject* py_occaAsyncMemcpy(PyObject *self, PyObject *args){
-  void *dest, *str;
+  PyObject *dest, *src;
+  Py_buffer destView, srcView;
   size_t bytes;
 
-  if(!PyArg_ParseTuple(args, "nnn", &dest, &str, &bytes))
+  if(!PyArg_ParseTuple(args, "OOn", &dest, &src, &bytes))
     return NULL;
 
-  occaAsyncMemcpy(dest, str, bytes);
+  if(!py_occaGetBuffer(dest, &destView, 1))
+    return NULL;
+
+  if(!py_occaGetBuffer(src, &srcView, 0)){
+    PyBuffer_Release(&destView);
+    return NULL;
+  }
+
+  if(bytes == 0)
+    bytes = (srcView.obj ? srcView.len : destView.len);
+
+  if(!py_occaCheckBuffer(&srcView, bytes)){
+    PyBuffer_Release(&destView);
+    return NULL;
+  }
+
+  if(!py_occaCheckBuffer(&destView, bytes)){
+    PyBuffer_Release(&srcView);
+    return NULL;
+  }
+
+  Py_BEGIN_ALLOW_THREADS
+  occaAsyncMemcpy(destView.buf, srcView.buf, bytes);
+  Py_END_ALLOW_THREADS
+
+  PyBuffer_Release(&destView);
+  PyBuffer_Release(&srcView);
 
   return Py_None;
 }
@@ -974,33 +1184,63 @@ static PyObject* py_occaCopyMemToMem(PyObject *self, PyObject *args){
   if(!PyArg_ParseTuple(args, "nnnnn", &dest, &src, &bytes, &destOffset, &srcOffset))
     return NULL;
 
+  Py_BEGIN_ALLOW_THREADS
   occaCopyMemToMem(dest, src, bytes, destOffset, srcOffset);
+  Py_END_ALLOW_THREADS
 
   return Py_None;
 }
 
 static PyObject* py_occaCopyPtrToMem(PyObject *self, PyObject *args){
   occaMemory dest;
-  void *src;
+  PyObject *src;
+  Py_buffer srcView;
   size_t bytes, destOffset;
 
-  if(!PyArg_ParseTuple(args, "nnnn", &dest, &src, &bytes, &destOffset))
+  if(!PyArg_ParseTuple(args, "nOnn", &dest, &src, &bytes, &destOffset))
+    return NULL;
+
+  if(!py_occaGetBuffer(src, &srcView, 0))
+    return NULL;
+
+  if(bytes == 0)
+    bytes = (occaMemoryBytes(dest) - destOffset);
+
+  if(!py_occaCheckBuffer(&srcView, bytes))
     return NULL;
 
-  occaCopyPtrToMem(dest, src, bytes, destOffset);
+  Py_BEGIN_ALLOW_THREADS
+  occaCopyPtrToMem(dest, srcView.buf, bytes, destOffset);
+  Py_END_ALLOW_THREADS
+
+  PyBuffer_Release(&srcView);
 
   return Py_None;
 }
 
 static PyObject* py_occaCopyMemToPtr(PyObject *self, PyObject *args){
-  void *dest;
+  PyObject *dest;
+  Py_buffer destView;
   occaMemory src;
   size_t bytes, srcOffset;
 
-  if(!PyArg_ParseTuple(args, "nnnn", &dest, &src, &bytes, &srcOffset))
+  if(!PyArg_ParseTuple(args, "Onnn", &dest, &src, &bytes, &srcOffset))
+    return NULL;
+
+  if(!py_occaGetBuffer(dest, &destView, 1))
     return NULL;
 
-  occaCopyMemToPtr(dest, src, bytes, srcOffset);
+  if(bytes == 0)
+    bytes = (occaMemoryBytes(src) - srcOffset);
+
+  if(!py_occaCheckBuffer(&destView, bytes))
+    return NULL;
+
+  Py_BEGIN_ALLOW_THREADS
+  occaCopyMemToPtr(destView.buf, src, bytes, srcOffset);
+  Py_END_ALLOW_THREADS
+
+  PyBuffer_Release(&destView);
 
   return Py_None;
 }
@@ -1012,33 +1252,65 @@ static PyObject* py_occaAsyncCopyMemToMem(PyObject *self, PyObject *args){
   if(!PyArg_ParseTuple(args, "nnnnn", &dest, &src, &bytes, &destOffset, &srcOffset))
     return NULL;
 
+  Py_BEGIN_ALLOW_THREADS
   occaAsyncCopyMemToMem(dest, src, bytes, destOffset, srcOffset);
+  Py_END_ALLOW_THREADS
 
   return Py_None;
 }
 
+// Async copies only hold the host buffer for the call, the caller
+//   keeps it alive until the stream is finished
 static PyObject* py_occaAsyncCopyPtrToMem(PyObject *self, PyObject *args){
   occaMemory dest;
-  void *src;
+  PyObject *src;
+  Py_buffer srcView;
   size_t bytes, destOffset;
 
-  if(!PyArg_ParseTuple(args, "nnnn", &dest, &src, &bytes, &destOffset))
+  if(!PyArg_ParseTuple(args, "nOnn", &dest, &src, &bytes, &destOffset))
     return NULL;
 
-  occaAsyncCopyPtrToMem(dest, src, bytes, destOffset);
+  if(!py_occaGetBuffer(src, &srcView, 0))
+    return NULL;
+
+  if(bytes == 0)
+    bytes = (occaMemoryBytes(dest) - destOffset);
+
+  if(!py_occaCheckBuffer(&srcView, bytes))
+    return NULL;
+
+  Py_BEGIN_ALLOW_THREADS
+  occaAsyncCopyPtrToMem(dest, srcView.buf, bytes, destOffset);
+  Py_END_ALLOW_THREADS
+
+  PyBuffer_Release(&srcView);
 
   return Py_None;
 }
 
 static PyObject* py_occaAsyncCopyMemToPtr(PyObject *self, PyObject *args){
-  void *dest;
+  PyObject *dest;
+  Py_buffer destView;
   occaMemory src;
   size_t bytes, srcOffset;
 
-  if(!PyArg_ParseTuple(args, "nnnn", &dest, &src, &bytes, &srcOffset))
+  if(!PyArg_ParseTuple(args, "Onnn", &dest, &src, &bytes, &srcOffset))
+    return NULL;
+
+  if(!py_occaGetBuffer(dest, &destView, 1))
+    return NULL;
+
+  if(bytes == 0)
+    bytes = (occaMemoryBytes(src) - srcOffset);
+
+  if(!py_occaCheckBuffer(&destView, bytes))
     return NULL;
 
-  occaAsyncCopyMemToPtr(dest, src, bytes, srcOffset);
+  Py_BEGIN_ALLOW_THREADS
+  occaAsyncCopyMemToPtr(destView.buf, src, bytes, srcOffset);
+  Py_END_ALLOW_THREADS
+
+  PyBuffer_Release(&destView);
 
   return Py_None;
 }
@@ -1049,7 +1321,20 @@ static PyObject* py_occaMemoryFree(PyObject *self, PyObject *args){
   if(!PyArg_ParseTuple(args, "n", &memory))
     return NULL;
 
+  Py_BEGIN_ALLOW_THREADS
   occaMemoryFree(memory);
+  Py_END_ALLOW_THREADS
+
+  return Py_None;
+}
+
+static PyObject* py_occaMemoryDetach(PyObject *self, PyObject *args){
+  occaMemory memory;
+
+  if(!PyArg_ParseTuple(args, "n", &memory))
+    return NULL;
+
+  occaMemoryDetach(memory);
 
   return Py_None;
 }
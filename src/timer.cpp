@@ -11,14 +11,45 @@ namespace occa {
     treeDepth      = 0;
   }
 
+  //---[ Profiler State ]-------------------------
+  timerNode_t::timerNode_t(const int region_,
+                           const int parent_,
+                           const int treeDepth_) :
+    region(region_),
+    parent(parent_),
+    treeDepth(treeDepth_),
+    timeTaken(0.0),
+    numCalls(0),
+    flopCount(0.0),
+    bandWidthCount(0.0),
+    deviceTime(0.0),
+    deviceCalls(0),
+    deviceFlopCount(0.0),
+    deviceBandWidthCount(0.0) {}
+
+  timerThread_t::timerThread_t(const int threadID_) :
+    threadID(threadID_) {
+
+    // Node [0] is the root, regions opened at the top level are its children
+    nodes.push_back(timerNode_t(-1, -1, -1));
+    nodeStack.push_back(0);
+  }
+
+  // Pending tags are resolved in batches to keep their count bounded
+  static const size_t maxPendingDeviceEvents = 1024;
+  //==============================================
+
   timer::timer(){
     profileKernels     = false;
     deviceInitialized  = false;
     profileApplication = false;
+    traceEvents        = false;
 
     std::string profilerOn       = occa::env::var("OCCA_PROFILE");
     std::string kernelProfilerOn = occa::env::var("OCCA_KERNEL_PROFILE");
 
+    traceFilename = occa::env::var("OCCA_PROFILE_TRACE");
+
     if(profilerOn == "1")
       profileApplication = true;
 
@@ -26,6 +57,17 @@ namespace occa {
       profileKernels     = true;
       profileApplication = true;
     }
+
+    if(traceFilename.size()){
+      traceEvents        = true;
+      profileApplication = true;
+    }
+
+#if (OCCA_OS & (LINUX_OS | OSX_OS))
+    pthread_key_create(&threadKey, NULL);
+#else
+    threadKey = TlsAlloc();
+#endif
   }
 
   void timer::initTimer(const occa::device &deviceHandle){
@@ -34,208 +76,409 @@ namespace occa {
     occaHandle = deviceHandle;
   }
 
-  void timer::tic(std::string key){
+  int timer::regionID(const std::string &key){
+    mutex.lock();
 
-    if(profileApplication){
-      keyStack.push(key);
+    std::map<std::string, int>::iterator it = regionIDs.find(key);
 
-      int treeDepth = keyStack.size() - 1;
-      times[keyStack].treeDepth = treeDepth;
+    int region;
 
-      double currentTime = occa::currentTime();
+    if(it != regionIDs.end())
+      region = it->second;
+    else {
+      region = regionNames.size();
 
-      timeStack.push(currentTime);
+      regionIDs[key] = region;
+      regionNames.push_back(key);
+    }
 
+    mutex.unlock();
 
-      if(treeDepth){
-        keyStack.pop();
+    return region;
+  }
 
-        // see if it was already in the child list
-        std::vector<std::string>::iterator iter;
-        std::vector<std::string> *childs = &(times[keyStack].childs);
-        iter = std::find(childs->begin(), childs->end(), key);
+  std::string timer::regionName(const int region){
+    mutex.lock();
 
-        if(iter == childs->end())
-          childs->push_back(key);
+    const std::string name = (((0 <= region) && (region < (int) regionNames.size())) ?
+                              regionNames[region] : std::string("[unknown region]"));
 
-        keyStack.push(key);
-      }
-    }
+    mutex.unlock();
+
+    return name;
   }
 
+  timerThread_t& timer::threadState(){
+#if (OCCA_OS & (LINUX_OS | OSX_OS))
+    timerThread_t *t = (timerThread_t*) pthread_getspecific(threadKey);
+#else
+    timerThread_t *t = (timerThread_t*) TlsGetValue(threadKey);
+#endif
 
-  double timer::toc(std::string key){
+    if(t != NULL)
+      return *t;
 
-    double elapsedTime = 0.;
+    // Kept after the thread exits, printTimer() still reads it
+    mutex.lock();
 
-    if(profileApplication){
-      assert(key == keyStack.top());
+    t = new timerThread_t(threads.size());
+    threads.push_back(t);
 
-      OCCA_CHECK(key == keyStack.top(),
-                 "Error in timer " << key << '\n');
+    mutex.unlock();
 
-      double currentTime = occa::currentTime();
-      elapsedTime = (currentTime - timeStack.top());
+#if (OCCA_OS & (LINUX_OS | OSX_OS))
+    pthread_setspecific(threadKey, t);
+#else
+    TlsSetValue(threadKey, t);
+#endif
 
-      times[keyStack].timeTaken += elapsedTime;
-      times[keyStack].numCalls++;
+    return *t;
+  }
 
-      keyStack.pop();
-      timeStack.pop();
-    }
+  static inline int threadRegionID(timer &timer_,
+                                   timerThread_t &t,
+                                   const std::string &key){
 
-    return elapsedTime;
+    std::map<std::string, int>::iterator it = t.regionCache.find(key);
+
+    if(it != t.regionCache.end())
+      return it->second;
+
+    const int region = timer_.regionID(key);
+
+    t.regionCache[key] = region;
+
+    return region;
   }
 
-  double timer::toc(std::string key, occa::kernel &kernel){
+  void timer::tic(const std::string &key){
+    if(profileApplication)
+      tic(threadRegionID(*this, threadState(), key));
+  }
 
-    double elapsedTime = 0.;
+  void timer::tic(const int region){
+    if(!profileApplication)
+      return;
 
-    if(profileApplication){
+    timerThread_t &t = threadState();
 
-      assert(key == keyStack.top());
+    const int parent = t.nodeStack.back();
 
-      OCCA_CHECK(key == keyStack.top(),
-                 "Error in timer " << key << '\n');
+    std::vector<int> &children = t.nodes[parent].children;
 
-      if(profileKernels){
-        if(deviceInitialized)
-          occaHandle.finish();
+    const int childCount = children.size();
 
-        double currentTime = occa::currentTime();
-        elapsedTime = (currentTime - timeStack.top());
-        // times[keyStack].timeTaken += kernel.timeTaken();
-        times[keyStack].timeTaken += elapsedTime;
-        times[keyStack].numCalls++;
+    int node = -1;
+
+    for(int i = 0; i < childCount; ++i){
+      if(t.nodes[children[i]].region == region){
+        node = children[i];
+        break;
       }
+    }
+
+    if(node < 0){
+      node = t.nodes.size();
 
-      keyStack.pop();
-      timeStack.pop();
+      children.push_back(node);
+      t.nodes.push_back(timerNode_t(region, parent, t.nodes[parent].treeDepth + 1));
     }
 
-    return elapsedTime;
-  }
+    t.nodeStack.push_back(node);
 
+    const bool useTag = (profileKernels && deviceInitialized &&
+                         (region < (int) t.deviceRegions.size()) &&
+                         t.deviceRegions[region]);
 
-  double timer::toc(std::string key, double flops){
+    t.hasTag.push_back(useTag);
+    t.tagStack.push_back(useTag ? occaHandle.tagStream() : streamTag());
 
-    double elapsedTime = 0.;
+    t.timeStack.push_back(occa::currentTime());
+  }
 
-    if(profileApplication){
+  double timer::toc(const std::string &key){
+    return toc(key, 0.0, 0.0);
+  }
 
-      assert(key == keyStack.top());
+  double timer::toc(const std::string &key, double flops){
+    return toc(key, flops, 0.0);
+  }
 
-      double currentTime = occa::currentTime();
-      elapsedTime = (currentTime - timeStack.top());
+  double timer::toc(const std::string &key, occa::kernel &kernel){
+    return toc(key, kernel, 0.0, 0.0);
+  }
 
-      times[keyStack].timeTaken += elapsedTime;
-      times[keyStack].numCalls++;
-      times[keyStack].flopCount += flops;
+  double timer::toc(const std::string &key, occa::kernel &kernel, double flops){
+    return toc(key, kernel, flops, 0.0);
+  }
 
-      keyStack.pop();
-      timeStack.pop();
-    }
+  double timer::toc(const std::string &key, double flops, double bw){
+    if(!profileApplication)
+      return 0.;
 
-    return elapsedTime;
+    return toc(threadRegionID(*this, threadState(), key), NULL, flops, bw);
   }
 
+  double timer::toc(const std::string &key, occa::kernel &kernel,
+                    double flops, double bw){
+    if(!profileApplication)
+      return 0.;
 
-  double timer::toc(std::string key, occa::kernel &kernel, double flops){
+    return toc(threadRegionID(*this, threadState(), key), &kernel, flops, bw);
+  }
 
-    double elapsedTime = 0.;
+  double timer::toc(const int region, occa::kernel *kernel,
+                    double flops, double bw){
 
-    if(profileApplication){
+    if(!profileApplication)
+      return 0.;
 
-      assert(key == keyStack.top());
+    const double currentTime = occa::currentTime();
 
-      if(profileKernels){
+    timerThread_t &t = threadState();
+
+    const int node = t.nodeStack.back();
+
+    OCCA_CHECK((node != 0) && (t.nodes[node].region == region),
+               "Error in timer " << regionName(region) << '\n');
+
+    const double startTime = t.timeStack.back();
+    const bool hasTag      = t.hasTag.back();
+
+    double elapsedTime = (currentTime - startTime);
+
+    // Kernel regions are only recorded with kernel profiling on
+    const bool record = ((kernel == NULL) || profileKernels);
+
+    bool onDevice = false;
+
+    if(record && (kernel != NULL) && deviceInitialized){
+      if(hasTag)
+        onDevice = true;
+      else {
+        // First time around, time it on the host and tag the stream from now on
         occaHandle.finish();
-        double currentTime = occa::currentTime();
-        elapsedTime = (currentTime - timeStack.top());
-        // times[keyStack].timeTaken += kernel.timeTaken();
-        times[keyStack].timeTaken += elapsedTime;
-        times[keyStack].numCalls++;
-        times[keyStack].flopCount += flops;
+        elapsedTime = (occa::currentTime() - startTime);
+
+        if((int) t.deviceRegions.size() <= region)
+          t.deviceRegions.resize(region + 1, false);
+
+        t.deviceRegions[region] = true;
       }
+    }
+
+    if(hasTag){
+      timerDeviceEvent_t de;
+
+      de.node     = (onDevice ? node : -1);
+      de.event    = -1;
+      de.startTag = t.tagStack.back();
+      de.endTag   = occaHandle.tagStream();
+
+      if(onDevice && traceEvents)
+        de.event = t.events.size();
 
-      keyStack.pop();
-      timeStack.pop();
+      t.deviceEvents.push_back(de);
     }
 
+    if(record){
+      timerNode_t &n = t.nodes[node];
+
+      // Device times are added once their tags are resolved
+      if(onDevice){
+        n.deviceCalls++;
+        n.deviceFlopCount      += flops;
+        n.deviceBandWidthCount += bw;
+      }
+      else {
+        n.timeTaken += elapsedTime;
+        n.numCalls++;
+        n.flopCount      += flops;
+        n.bandWidthCount += bw;
+      }
+
+      if(traceEvents){
+        timerEvent_t e;
+
+        e.region    = region;
+        e.treeDepth = n.treeDepth;
+        e.onDevice  = onDevice;
+        e.startTime = startTime;
+        e.timeTaken = elapsedTime;
+
+        t.events.push_back(e);
+      }
+    }
+
+    dataTransferred += bw;
+
+    t.nodeStack.pop_back();
+    t.timeStack.pop_back();
+    t.tagStack.pop_back();
+    t.hasTag.pop_back();
+
+    if(maxPendingDeviceEvents <= t.deviceEvents.size())
+      resolveDeviceEvents(t);
+
     return elapsedTime;
   }
 
-  double timer::toc(std::string key, double flops, double bw){
+  void timer::resolveDeviceEvents(timerThread_t &t){
+    const int eventCount = t.deviceEvents.size();
 
-    double elapsedTime = 0.;
+    for(int i = 0; i < eventCount; ++i){
+      timerDeviceEvent_t &de = t.deviceEvents[i];
 
-    if(profileApplication){
+      const double elapsedTime = occaHandle.timeBetween(de.startTag, de.endTag);
 
-      assert(key == keyStack.top());
+      if(0 <= de.node)
+        t.nodes[de.node].deviceTime += elapsedTime;
 
-      double currentTime = occa::currentTime();
-      elapsedTime = (currentTime - timeStack.top());
+      if(0 <= de.event)
+        t.events[de.event].timeTaken = elapsedTime;
+    }
 
-      times[keyStack].timeTaken += elapsedTime;
-      times[keyStack].numCalls++;
-      times[keyStack].flopCount += flops;
-      times[keyStack].bandWidthCount += bw;
+    t.deviceEvents.clear();
+  }
+
+  void timer::resolveDeviceEvents(){
+    mutex.lock();
+    std::vector<timerThread_t*> threads_ = threads;
+    mutex.unlock();
+
+    for(size_t i = 0; i < threads_.size(); ++i)
+      resolveDeviceEvents(*(threads_[i]));
+  }
+
+  static void mergeNode(std::vector<timerNode_t> &merged, const int mNode,
+                        const timerThread_t &t, const int tNode){
+
+    const std::vector<int> &children = t.nodes[tNode].children;
+
+    for(size_t i = 0; i < children.size(); ++i){
+      const timerNode_t &child = t.nodes[children[i]];
 
-      dataTransferred += bw;
+      int mChild = -1;
+
+      for(size_t j = 0; j < merged[mNode].children.size(); ++j){
+        if(merged[merged[mNode].children[j]].region == child.region){
+          mChild = merged[mNode].children[j];
+          break;
+        }
+      }
+
+      if(mChild < 0){
+        mChild = merged.size();
+
+        merged[mNode].children.push_back(mChild);
+        merged.push_back(timerNode_t(child.region, mNode, child.treeDepth));
+      }
 
-      keyStack.pop();
-      timeStack.pop();
+      timerNode_t &m = merged[mChild];
+
+      m.timeTaken      += child.timeTaken;
+      m.numCalls       += child.numCalls;
+      m.flopCount      += child.flopCount;
+      m.bandWidthCount += child.bandWidthCount;
+
+      m.deviceTime           += child.deviceTime;
+      m.deviceCalls          += child.deviceCalls;
+      m.deviceFlopCount      += child.deviceFlopCount;
+      m.deviceBandWidthCount += child.deviceBandWidthCount;
+
+      mergeNode(merged, mChild, t, children[i]);
     }
+  }
 
-    return elapsedTime;
+  void timer::mergeTrees(std::vector<timerNode_t> &merged){
+    merged.clear();
+    merged.push_back(timerNode_t(-1, -1, -1));
+
+    mutex.lock();
+
+    for(size_t i = 0; i < threads.size(); ++i)
+      mergeNode(merged, 0, *(threads[i]), 0);
+
+    mutex.unlock();
   }
 
+  // Copies the host or device side of [merged] into [tree], regions
+  //   without calls on that side hand their children to their parent
+  static void splitNode(const std::vector<timerNode_t> &merged, const int mNode,
+                        const bool onDevice,
+                        std::vector<timerNode_t> &tree, const int tNode){
 
-  double timer::toc(std::string key, occa::kernel &kernel,
-                    double flops, double bw){
+    const std::vector<int> &children = merged[mNode].children;
 
-    double elapsedTime = 0.;
+    for(size_t i = 0; i < children.size(); ++i){
+      const timerNode_t &child = merged[children[i]];
 
-    if(profileApplication){
+      if((onDevice ? child.deviceCalls : child.numCalls) == 0){
+        splitNode(merged, children[i], onDevice, tree, tNode);
+        continue;
+      }
 
-      assert(key == keyStack.top());
+      int tChild = -1;
 
-      if(profileKernels){
-        occaHandle.finish();
-        double currentTime = occa::currentTime();
-        elapsedTime = (currentTime - timeStack.top());
-        // times[keyStack].timeTaken += kernel.timeTaken();
-        times[keyStack].timeTaken += elapsedTime;
-        times[keyStack].numCalls++;
-        times[keyStack].flopCount += flops;
-        times[keyStack].bandWidthCount += bw;
+      for(size_t j = 0; j < tree[tNode].children.size(); ++j){
+        if(tree[tree[tNode].children[j]].region == child.region){
+          tChild = tree[tNode].children[j];
+          break;
+        }
       }
 
-      dataTransferred += bw;
+      if(tChild < 0){
+        tChild = tree.size();
 
-      keyStack.pop();
-      timeStack.pop();
+        tree[tNode].children.push_back(tChild);
+        tree.push_back(timerNode_t(child.region, tNode, tree[tNode].treeDepth + 1));
+      }
+
+      timerNode_t &t = tree[tChild];
+
+      if(onDevice){
+        t.timeTaken      += child.deviceTime;
+        t.numCalls       += child.deviceCalls;
+        t.flopCount      += child.deviceFlopCount;
+        t.bandWidthCount += child.deviceBandWidthCount;
+      }
+      else {
+        t.timeTaken      += child.timeTaken;
+        t.numCalls       += child.numCalls;
+        t.flopCount      += child.flopCount;
+        t.bandWidthCount += child.bandWidthCount;
+      }
+
+      splitNode(merged, children[i], onDevice, tree, tChild);
     }
+  }
 
-    return elapsedTime;
+  static void splitTree(const std::vector<timerNode_t> &merged,
+                        const bool onDevice,
+                        std::vector<timerNode_t> &tree){
+    tree.clear();
+    tree.push_back(timerNode_t(-1, -1, -1));
+
+    splitNode(merged, 0, onDevice, tree, 0);
   }
 
-  double timer::print_recursively(std::vector<std::string> &childs,
+  double timer::print_recursively(std::vector<timerNode_t> &merged,
+                                  std::vector<double> &selfTimes,
+                                  const std::vector<int> &childs,
                                   double parentTime,
                                   double overallTime){
 
     double sumChildrenTime = 0.0;
 
     for(size_t i = 0; i < childs.size(); ++i){
+      const int node = childs[i];
 
-      keyStack.push(childs[i]);
-
-      timerTraits *traits = &(times[keyStack]);
+      timerNode_t *traits = &(merged[node]);
 
       std::string stringName = "  ";
       for(int j=0; j<traits->treeDepth; j++)	stringName.append(" ");
 
-      stringName.append("*"); stringName.append(keyStack.top());
+      stringName.append("*"); stringName.append(regionName(traits->region));
 
       double timeTaken = traits->timeTaken;
 
@@ -252,9 +495,9 @@ namespace occa {
                 << std::right<<std::setw(10)<<std::setprecision(3)<<traits->bandWidthCount*invTimeTaken/1e9
                 << std::endl;
 
-      traits->selfTime -= print_recursively(traits->childs, timeTaken, overallTime);
-
-      keyStack.pop();
+      selfTimes[node] -= print_recursively(merged, selfTimes,
+                                           merged[node].children,
+                                           timeTaken, overallTime);
     }
 
     return sumChildrenTime;
@@ -267,19 +510,39 @@ namespace occa {
     return (a.second.selfTime > b.second.selfTime);
   }
 
+  class compareRegionNames {
+  public:
+    timer &timer_;
+    const std::vector<timerNode_t> &merged;
+
+    compareRegionNames(timer &timer__,
+                       const std::vector<timerNode_t> &merged_) :
+      timer_(timer__),
+      merged(merged_) {}
+
+    bool operator () (const int a, const int b) const {
+      return (timer_.regionName(merged[a].region) <
+              timer_.regionName(merged[b].region));
+    }
+  };
+
   void timer::printTimer(){
 
     if(profileApplication){
-      std::map<std::stack<std::string>, timerTraits>::iterator iter;
-
-      // compute overall time
-      double overallTime = 0.;
-      for(iter = times.begin(); iter != times.end(); iter++){
-        iter->second.selfTime = iter->second.timeTaken;
-        if(iter->second.treeDepth == 0){
-          overallTime += iter->second.timeTaken;
-        }
-      }
+      resolveDeviceEvents();
+
+      std::vector<timerNode_t> merged;
+      mergeTrees(merged);
+
+      // Device regions overlap the host regions around them, so
+      //   they're printed in their own tree
+      std::vector<timerNode_t> hostTree, deviceTree;
+      splitTree(merged, false, hostTree);
+      splitTree(merged, true , deviceTree);
+
+      const bool hasDevice = (1 < deviceTree.size());
+
+      std::vector<double> hostSelfTimes, deviceSelfTimes;
 
       std::cout<<"********************************************************"
                <<"**********************************"<<std::endl;
@@ -296,114 +559,234 @@ namespace occa {
       std::cout<<"--------------------------------------------------------"
                <<"----------------------------------"<<std::endl;
 
-      for(iter = times.begin(); iter != times.end(); iter++){
-        if(iter->second.treeDepth == 0){
+      const double hostTime = printTree(hostTree, hostSelfTimes, "");
+      double deviceTime     = 0.;
 
-          keyStack = iter->first;
+      if(hasDevice)
+        deviceTime = printTree(deviceTree, deviceSelfTimes, "[device]");
 
-          timerTraits *traits = &(iter->second);
+      // write the flat profiling info
+      std::cout<<"********************************************************"
+               <<"**********************************"<<std::endl;
 
-          std::string stringName = " *";
-          stringName.append(keyStack.top());
+      std::cout<<"Profiling summary: " << std::endl;
 
-          double timeTaken = traits->timeTaken;
 
-          double invTimeTaken = (timeTaken > 1e-10) ? 1.0/timeTaken : 0.;
+      std::cout << std::left<<std::setw(30)<<"Name"
+                << std::right<<std::setw(10)<<"time"
+                << std::right<<std::setw(10)<<"self time"
+                << std::right<<std::setw(10)<<"# calls"
+                << std::right<<std::setw(10)<<"% time"
+                << std::right<<std::setw(10)<<"gflops "
+                << std::right<<std::setw(10)<<"bwidth"
+                << std::endl;
 
-          std::cout << std::left << std::setw(30) << stringName
-                    << std::right << std::setw(10) << std::setprecision(3)<<timeTaken
-                    << std::right<<std::setw(10)<<traits->numCalls
-                    << std::right<<std::setw(10)<<std::setprecision(3)<<100.0
-                    << std::right<<std::setw(10)<<std::setprecision(3)<<100*timeTaken/overallTime
-                    << std::right<<std::setw(10)<<std::setprecision(3)<<traits->flopCount*invTimeTaken/1e9
-                    << std::right<<std::setw(10)<<std::setprecision(3)<<traits->bandWidthCount*invTimeTaken/1e9
-                    << std::endl;
+      std::cout<<"--------------------------------------------------------"
+               <<"----------------------------------"<<std::endl;
 
-          traits->selfTime -= print_recursively(iter->second.childs, timeTaken, overallTime);
+      printFlatProfile(hostTree, hostSelfTimes, hostTime);
 
-        }
+      if(hasDevice){
+        std::cout<<"---[ device ]-------------------------------------------"
+                 <<"----------------------------------"<<std::endl;
+
+        printFlatProfile(deviceTree, deviceSelfTimes, deviceTime);
       }
 
+      std::cout<<"********************************************************"
+               <<"**********************************"<<std::endl;
+
+      if(traceFilename.size())
+        exportTrace(traceFilename);
+    }
+  }
 
-      std::map<std::string, timerTraits> flat;
+  double timer::printTree(std::vector<timerNode_t> &tree,
+                          std::vector<double> &selfTimes,
+                          const std::string &rootName){
 
-      // flat profile
-      for(iter=times.begin(); iter!=times.end(); iter++){
+    // Top-level regions are listed by name
+    std::vector<int> roots = tree[0].children;
+    std::sort(roots.begin(), roots.end(), compareRegionNames(*this, tree));
 
-        std::string key = iter->first.top();
+    selfTimes.resize(tree.size());
 
-        timerTraits *traits = &(iter->second);
+    // compute overall time
+    double overallTime = 0.;
+    for(size_t i = 0; i < tree.size(); ++i){
+      selfTimes[i] = tree[i].timeTaken;
+      if(tree[i].treeDepth == 0){
+        overallTime += tree[i].timeTaken;
+      }
+    }
 
-        timerTraits *targetTraits = &(flat[key]);
+    if(rootName.size()){
+      timerNode_t root;
 
-        targetTraits->timeTaken += traits->timeTaken;
-        targetTraits->selfTime += traits->selfTime;
-        targetTraits->numCalls += traits->numCalls;
-        targetTraits->flopCount += traits->flopCount;
-        targetTraits->bandWidthCount += traits->bandWidthCount;
+      for(size_t r = 0; r < roots.size(); ++r){
+        root.numCalls       += tree[roots[r]].numCalls;
+        root.flopCount      += tree[roots[r]].flopCount;
+        root.bandWidthCount += tree[roots[r]].bandWidthCount;
       }
 
+      double invTimeTaken = (overallTime > 1e-10) ? 1.0/overallTime : 0.;
 
-      std::vector<std::pair<std::string, timerTraits> > flatVec(flat.size());
+      std::cout << std::left << std::setw(30) << (" *" + rootName)
+                << std::right << std::setw(10) << std::setprecision(3)<<overallTime
+                << std::right<<std::setw(10)<<root.numCalls
+                << std::right<<std::setw(10)<<std::setprecision(3)<<100.0
+                << std::right<<std::setw(10)<<std::setprecision(3)<<100.0
+                << std::right<<std::setw(10)<<std::setprecision(3)<<root.flopCount*invTimeTaken/1e9
+                << std::right<<std::setw(10)<<std::setprecision(3)<<root.bandWidthCount*invTimeTaken/1e9
+                << std::endl;
 
-      std::map<std::string, timerTraits>::iterator iter2 = flat.begin();
+      print_recursively(tree, selfTimes, roots, overallTime, overallTime);
 
-      for(size_t i = 0; i < flat.size(); ++i){
-        flatVec[i].first = iter2->first;
+      return overallTime;
+    }
 
-        flatVec[i].second.timeTaken = iter2->second.timeTaken;
-        flatVec[i].second.numCalls = iter2->second.numCalls;
-        flatVec[i].second.selfTime = iter2->second.selfTime;
-        flatVec[i].second.flopCount = iter2->second.flopCount;
-        flatVec[i].second.bandWidthCount = iter2->second.bandWidthCount;
+    for(size_t r = 0; r < roots.size(); ++r){
+      const int node = roots[r];
 
-        iter2++;
-      }
+      timerNode_t *traits = &(tree[node]);
 
-      // sort
-      std::sort(flatVec.begin(), flatVec.end(), compareSelfTimes);
+      std::string stringName = " *";
+      stringName.append(regionName(traits->region));
 
+      double timeTaken = traits->timeTaken;
 
-      // write the flat profiling info
-      std::cout<<"********************************************************"
-               <<"**********************************"<<std::endl;
+      double invTimeTaken = (timeTaken > 1e-10) ? 1.0/timeTaken : 0.;
 
-      std::cout<<"Profiling summary: " << std::endl;
+      std::cout << std::left << std::setw(30) << stringName
+                << std::right << std::setw(10) << std::setprecision(3)<<timeTaken
+                << std::right<<std::setw(10)<<traits->numCalls
+                << std::right<<std::setw(10)<<std::setprecision(3)<<100.0
+                << std::right<<std::setw(10)<<std::setprecision(3)<<100*timeTaken/overallTime
+                << std::right<<std::setw(10)<<std::setprecision(3)<<traits->flopCount*invTimeTaken/1e9
+                << std::right<<std::setw(10)<<std::setprecision(3)<<traits->bandWidthCount*invTimeTaken/1e9
+                << std::endl;
 
+      selfTimes[node] -= print_recursively(tree, selfTimes,
+                                           tree[node].children,
+                                           timeTaken, overallTime);
+    }
 
-      std::cout << std::left<<std::setw(30)<<"Name"
-                << std::right<<std::setw(10)<<"time"
-                << std::right<<std::setw(10)<<"self time"
-                << std::right<<std::setw(10)<<"# calls"
-                << std::right<<std::setw(10)<<"% time"
-                << std::right<<std::setw(10)<<"gflops "
-                << std::right<<std::setw(10)<<"bwidth"
+    return overallTime;
+  }
+
+  void timer::printFlatProfile(const std::vector<timerNode_t> &tree,
+                               const std::vector<double> &selfTimes,
+                               const double overallTime){
+
+    std::map<std::string, timerTraits> flat;
+
+    // flat profile
+    for(size_t i = 1; i < tree.size(); ++i){
+
+      std::string key = regionName(tree[i].region);
+
+      const timerNode_t *traits = &(tree[i]);
+
+      timerTraits *targetTraits = &(flat[key]);
+
+      targetTraits->timeTaken += traits->timeTaken;
+      targetTraits->selfTime += selfTimes[i];
+      targetTraits->numCalls += traits->numCalls;
+      targetTraits->flopCount += traits->flopCount;
+      targetTraits->bandWidthCount += traits->bandWidthCount;
+    }
+
+
+    std::vector<std::pair<std::string, timerTraits> > flatVec(flat.begin(), flat.end());
+
+    // sort
+    std::sort(flatVec.begin(), flatVec.end(), compareSelfTimes);
+
+    std::vector<std::pair<std::string, timerTraits> > ::iterator iter1;
+    for(iter1=flatVec.begin(); iter1!=flatVec.end(); iter1++){
+
+      timerTraits *traits = &(iter1->second);
+      double timeTaken = traits->timeTaken;
+      double invTimeTaken = (timeTaken > 1e-10) ? 1.0/timeTaken : 0.;
+      std::cout << std::left<<std::setw(30) << iter1->first
+                << std::right<<std::setw(10) << std::setprecision(3)<<traits->timeTaken
+                << std::right<<std::setw(10) << std::setprecision(3)<<traits->selfTime
+                << std::right<<std::setw(10)<<traits->numCalls
+                << std::right<<std::setw(10)<<std::setprecision(3)<<100*traits->selfTime/overallTime
+                << std::right<<std::setw(10)<<std::setprecision(3)<<traits->flopCount*invTimeTaken/1e9
+                << std::right<<std::setw(10)<<std::setprecision(3)<<traits->bandWidthCount*invTimeTaken/1e9
                 << std::endl;
 
-      std::cout<<"--------------------------------------------------------"
-               <<"----------------------------------"<<std::endl;
+    }
+  }
 
-      std::vector<std::pair<std::string, timerTraits> > ::iterator iter1;
-      for(iter1=flatVec.begin(); iter1!=flatVec.end(); iter1++){
-
-        timerTraits *traits = &(iter1->second);
-        double timeTaken = traits->timeTaken;
-        double invTimeTaken = (timeTaken > 1e-10) ? 1.0/timeTaken : 0.;
-        std::cout << std::left<<std::setw(30) << iter1->first
-                  << std::right<<std::setw(10) << std::setprecision(3)<<traits->timeTaken
-                  << std::right<<std::setw(10) << std::setprecision(3)<<traits->selfTime
-                  << std::right<<std::setw(10)<<traits->numCalls
-                  << std::right<<std::setw(10)<<std::setprecision(3)<<100*traits->selfTime/overallTime
-                  << std::right<<std::setw(10)<<std::setprecision(3)<<traits->flopCount*invTimeTaken/1e9
-                  << std::right<<std::setw(10)<<std::setprecision(3)<<traits->bandWidthCount*invTimeTaken/1e9
-                  << std::endl;
+  static std::string jsonString(const std::string &s){
+    std::string ret = "\"";
+
+    for(size_t i = 0; i < s.size(); ++i){
+      const char c = s[i];
+
+      if((c == '"') || (c == '\\'))
+        ret += '\\';
+
+      if(c < ' ')
+        ret += ' ';
+      else
+        ret += c;
+    }
+
+    return (ret + '"');
+  }
 
+  void timer::exportTrace(const std::string &filename){
+    resolveDeviceEvents();
+
+    mutex.lock();
+    std::vector<timerThread_t*> threads_ = threads;
+    mutex.unlock();
+
+    double firstTime = -1;
+
+    for(size_t i = 0; i < threads_.size(); ++i){
+      const std::vector<timerEvent_t> &events = threads_[i]->events;
+
+      for(size_t j = 0; j < events.size(); ++j){
+        if((firstTime < 0) || (events[j].startTime < firstTime))
+          firstTime = events[j].startTime;
       }
+    }
 
-      std::cout<<"********************************************************"
-               <<"**********************************"<<std::endl;
+    std::stringstream ss;
 
+    ss << std::fixed << std::setprecision(3)
+       << "{\"traceEvents\":[\n"
+       << "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":0,\"args\":{\"name\":\"host\"}},\n"
+       << "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":1,\"args\":{\"name\":\"device\"}}";
+
+    // Device regions go under their own process, their times come
+    //   from stream tags and don't nest with the host regions
+    for(size_t i = 0; i < threads_.size(); ++i){
+      const timerThread_t &t = *(threads_[i]);
+
+      ss << ",\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":" << t.threadID
+         << ",\"args\":{\"name\":\"thread " << t.threadID << "\"}}";
+
+      for(size_t j = 0; j < t.events.size(); ++j){
+        const timerEvent_t &e = t.events[j];
+
+        ss << ",\n{\"name\":" << jsonString(regionName(e.region))
+           << ",\"ph\":\"X\""
+           << ",\"pid\":" << (e.onDevice ? 1 : 0)
+           << ",\"tid\":" << t.threadID
+           << ",\"ts\":"  << (1.0e6 * (e.startTime - firstTime))
+           << ",\"dur\":" << (1.0e6 * e.timeTaken)
+           << ",\"args\":{\"depth\":" << e.treeDepth << "}}";
+      }
     }
+
+    ss << "\n]}\n";
+
+    writeToFile(filename, ss.str());
   }
 
   timer globalTimer;
@@ -414,35 +797,59 @@ namespace occa {
     globalTimer.initTimer(deviceHandle);
   }
 
-  void tic(std::string key){
+  int timerRegion(const std::string &key){
+    return globalTimer.regionID(key);
+  }
+
+  void tic(const std::string &key){
     globalTimer.tic(key);
   }
 
-  double toc(std::string key){
+  void tic(const int region){
+    globalTimer.tic(region);
+  }
+
+  double toc(const std::string &key){
     return globalTimer.toc(key);
   }
 
-  double toc(std::string key, occa::kernel &kernel){
+  double toc(const std::string &key, occa::kernel &kernel){
     return globalTimer.toc(key, kernel);
   }
 
-  double toc(std::string key, double fp){
+  double toc(const std::string &key, double fp){
     return globalTimer.toc(key, fp);
   }
 
-  double toc(std::string key, occa::kernel &kernel, double fp){
+  double toc(const std::string &key, occa::kernel &kernel, double fp){
     return globalTimer.toc(key, kernel, fp);
   }
 
-  double toc(std::string key, double fp, double bw){
+  double toc(const std::string &key, double fp, double bw){
     return globalTimer.toc(key, fp, bw);
   }
 
-  double toc(std::string key, occa::kernel &kernel, double fp, double bw){
+  double toc(const std::string &key, occa::kernel &kernel, double fp, double bw){
     return globalTimer.toc(key, kernel, fp, bw);
   }
 
+  double toc(const int region){
+    return globalTimer.toc(region, NULL, 0.0, 0.0);
+  }
+
+  double toc(const int region, occa::kernel &kernel){
+    return globalTimer.toc(region, &kernel, 0.0, 0.0);
+  }
+
+  double toc(const int region, occa::kernel &kernel, double fp, double bw){
+    return globalTimer.toc(region, &kernel, fp, bw);
+  }
+
   void printTimer(){
     globalTimer.printTimer();
   }
+
+  void exportTrace(const std::string &filename){
+    globalTimer.exportTrace(filename);
+  }
 }
@@ -1,13 +1,20 @@
 #include <fstream>
+#include <algorithm>
+#include <set>
 #include <cstddef>
+#include <ctime>
 
 #include "occa/tools.hpp"
 #include "occa/base.hpp"
 
 #include "occa/parser/parser.hpp"
 
+#if (OCCA_OS & (LINUX_OS | OSX_OS))
+#  include <sys/mman.h>
+#endif
+
 namespace occa {
-  strToBoolMap_t fileLocks;
+  std::map<std::string, int> fileLocks;
 
   //---[ Helper Info ]----------------
   namespace env {
@@ -18,6 +25,8 @@ namespace occa {
 
     std::string OCCA_DIR, OCCA_CACHE_DIR;
     size_t OCCA_MEM_BYTE_ALIGN;
+    int OCCA_MAX_BUILDS;
+    std::string OCCA_NODE_LOCK_DIR;
     stringVector_t OCCA_INCLUDE_PATH;
 
     void initialize() {
@@ -78,6 +87,17 @@ namespace occa {
         }
       }
 
+      // Concurrent background kernel builds, [0] uses the core count
+      OCCA_MAX_BUILDS = 0;
+      if(env::var("OCCA_MAX_BUILDS").size() > 0)
+        OCCA_MAX_BUILDS = std::atoi(env::var("OCCA_MAX_BUILDS").c_str());
+
+      // Node-local directory (e.g. /dev/shm) used to elect one process
+      //   per node to take the cache locks, off if empty
+      OCCA_NODE_LOCK_DIR = env::var("OCCA_NODE_LOCK_DIR");
+      if(OCCA_NODE_LOCK_DIR.size() > 0)
+        endDirWithSlash(OCCA_NODE_LOCK_DIR);
+
       isInitialized = true;
     }
 
@@ -250,6 +270,47 @@ namespace occa {
 #endif
     }
 
+    std::string hostname() {
+      char name[256];
+      name[0] = '\0';
+
+#if (OCCA_OS & (LINUX_OS | OSX_OS))
+      gethostname(name, sizeof(name) - 1);
+#else
+      DWORD nameSize = sizeof(name) - 1;
+      GetComputerNameA(name, &nameSize);
+#endif
+      name[sizeof(name) - 1] = '\0';
+
+      return std::string(name);
+    }
+
+    std::string tmpFilename(const std::string &filename) {
+      static volatile unsigned int tmpCount = 0;
+
+      std::stringstream ss;
+
+      ss << filename << '.' << hostname()
+#if (OCCA_OS & (LINUX_OS | OSX_OS))
+         << '.' << getpid()
+#else
+         << '.' << GetCurrentProcessId()
+#endif
+         << '.' << atomicAdd(&tmpCount, 1)
+         << ".tmp";
+
+      return ss.str();
+    }
+
+    // Atomically replaces [to], readers see either nothing or all of it
+    int rename(const std::string &from, const std::string &to) {
+#if (OCCA_OS & (LINUX_OS | OSX_OS))
+      return ::rename(from.c_str(), to.c_str());
+#else
+      return (MoveFileExA(from.c_str(), to.c_str(), MOVEFILE_REPLACE_EXISTING) ? 0 : -1);
+#endif
+    }
+
     int mkdir(const std::string &dir) {
       errno = 0;
 
@@ -501,6 +562,48 @@ namespace occa {
 #endif
   }
 
+  condition_t::condition_t() {
+#if (OCCA_OS & (LINUX_OS | OSX_OS))
+    int error = pthread_cond_init(&condHandle, NULL);
+
+    OCCA_CHECK(error == 0,
+               "Error initializing condition variable");
+#endif
+  }
+
+  void condition_t::free() {
+#if (OCCA_OS & (LINUX_OS | OSX_OS))
+    int error = pthread_cond_destroy(&condHandle);
+
+    OCCA_CHECK(error == 0,
+               "Error freeing condition variable");
+#endif
+  }
+
+  void condition_t::wait(mutex_t &mutex) {
+#if (OCCA_OS & (LINUX_OS | OSX_OS))
+    pthread_cond_wait(&condHandle, &(mutex.mutexHandle));
+#else
+    // [-] Win32 mutexes can't be paired with condition variables,
+    //     callers always re-check their predicate so a short sleep is enough
+    mutex.unlock();
+    Sleep(1);
+    mutex.lock();
+#endif
+  }
+
+  void condition_t::signal() {
+#if (OCCA_OS & (LINUX_OS | OSX_OS))
+    pthread_cond_signal(&condHandle);
+#endif
+  }
+
+  void condition_t::broadcast() {
+#if (OCCA_OS & (LINUX_OS | OSX_OS))
+    pthread_cond_broadcast(&condHandle);
+#endif
+  }
+
   fnvOutput_t::fnvOutput_t() {
     h[0] = 101527; h[1] = 101531;
     h[2] = 101533; h[3] = 101537;
@@ -540,6 +643,155 @@ namespace occa {
     return ss.str();
   }
 
+  namespace hashPrimes {
+    static const uint64_t p1 = 0x9E3779B185EBCA87ULL;
+    static const uint64_t p2 = 0xC2B2AE3D27D4EB4FULL;
+    static const uint64_t p3 = 0x165667B19E3779F9ULL;
+    static const uint64_t p4 = 0x85EBCA77C2B2AE63ULL;
+    static const uint64_t p5 = 0x27D4EB2F165667C5ULL;
+  }
+
+  static inline uint64_t rotl64(const uint64_t v, const int r) {
+    return ((v << r) | (v >> (64 - r)));
+  }
+
+  // Little-endian on every host so cache names are portable,
+  //   compilers fold this into a single load
+  static inline uint64_t readLE64(const unsigned char *c) {
+    return (((uint64_t) c[0] <<  0) | ((uint64_t) c[1] <<  8) |
+            ((uint64_t) c[2] << 16) | ((uint64_t) c[3] << 24) |
+            ((uint64_t) c[4] << 32) | ((uint64_t) c[5] << 40) |
+            ((uint64_t) c[6] << 48) | ((uint64_t) c[7] << 56));
+  }
+
+  static inline uint64_t hashRound(uint64_t acc, const uint64_t input) {
+    acc += input * hashPrimes::p2;
+    acc  = rotl64(acc, 31);
+    return acc * hashPrimes::p1;
+  }
+
+  static inline uint64_t hashMerge(uint64_t h, const uint64_t lane) {
+    h ^= hashRound(0, lane);
+    return (h * hashPrimes::p1) + hashPrimes::p4;
+  }
+
+  static inline uint64_t hashAvalanche(uint64_t h) {
+    h ^= (h >> 33);
+    h *= hashPrimes::p2;
+    h ^= (h >> 29);
+    h *= hashPrimes::p3;
+    h ^= (h >> 32);
+    return h;
+  }
+
+  // [first] rotates which lane leads so both halves mix differently
+  static uint64_t hashFinish(const hash_t &hash, const int first) {
+    const uint64_t *lanes = hash.lanes;
+    uint64_t h;
+
+    if(32 <= hash.bytes) {
+      h = (rotl64(lanes[(first + 0) % 4],  1) + rotl64(lanes[(first + 1) % 4],  7) +
+           rotl64(lanes[(first + 2) % 4], 12) + rotl64(lanes[(first + 3) % 4], 18));
+
+      for(int i = 0; i < 4; ++i)
+        h = hashMerge(h, lanes[(first + i) % 4]);
+    }
+    else {
+      h = hash.seed + (first ? hashPrimes::p4 : hashPrimes::p5);
+    }
+
+    h += hash.bytes;
+
+    const unsigned char *c = hash.buffer;
+    int left = hash.bufferedBytes;
+
+    for(; 8 <= left; c += 8, left -= 8) {
+      h ^= hashRound(0, readLE64(c));
+      h  = (rotl64(h, 27) * hashPrimes::p1) + hashPrimes::p4;
+    }
+
+    for(; 0 < left; ++c, --left) {
+      h ^= (*c) * hashPrimes::p5;
+      h  = rotl64(h, 11) * hashPrimes::p1;
+    }
+
+    return hashAvalanche(h);
+  }
+
+  hash_t::hash_t(const uint64_t seed_) :
+    seed(seed_),
+    bytes(0),
+    bufferedBytes(0) {
+
+    lanes[0] = seed + hashPrimes::p1 + hashPrimes::p2;
+    lanes[1] = seed + hashPrimes::p2;
+    lanes[2] = seed;
+    lanes[3] = seed - hashPrimes::p1;
+  }
+
+  void hash_t::update(const void *ptr, const uintptr_t bytes_) {
+    const unsigned char *c   = (const unsigned char*) ptr;
+    const unsigned char *end = c + bytes_;
+
+    bytes += bytes_;
+
+    // Finish a stripe left over from the last update
+    if(bufferedBytes) {
+      const int fill = (int) std::min((uintptr_t) (32 - bufferedBytes), bytes_);
+
+      ::memcpy(buffer + bufferedBytes, c, fill);
+      bufferedBytes += fill;
+      c += fill;
+
+      if(bufferedBytes < 32)
+        return;
+
+      for(int i = 0; i < 4; ++i)
+        lanes[i] = hashRound(lanes[i], readLE64(buffer + 8*i));
+
+      bufferedBytes = 0;
+    }
+
+    // Lanes are independent, keeping them in registers lets the
+    //   multiplies overlap
+    uint64_t l0 = lanes[0], l1 = lanes[1];
+    uint64_t l2 = lanes[2], l3 = lanes[3];
+
+    for(; 32 <= (end - c); c += 32) {
+      l0 = hashRound(l0, readLE64(c +  0));
+      l1 = hashRound(l1, readLE64(c +  8));
+      l2 = hashRound(l2, readLE64(c + 16));
+      l3 = hashRound(l3, readLE64(c + 24));
+    }
+
+    lanes[0] = l0; lanes[1] = l1;
+    lanes[2] = l2; lanes[3] = l3;
+
+    if(c < end) {
+      bufferedBytes = (int) (end - c);
+      ::memcpy(buffer, c, bufferedBytes);
+    }
+  }
+
+  void hash_t::update(const std::string &str) {
+    update(str.c_str(), str.size());
+  }
+
+  std::string hash_t::digest() const {
+    const uint64_t h[2] = {hashFinish(*this, 0),
+                           hashFinish(*this, 1)};
+
+    const char hexDigits[] = "0123456789abcdef";
+    char ret[32];
+
+    for(int i = 0; i < 2; ++i) {
+      for(int j = 0; j < 16; ++j)
+        ret[16*i + j] = hexDigits[(h[i] >> (60 - 4*j)) & 0xF];
+    }
+
+    return std::string(ret, 32);
+  }
+
   double currentTime() {
 #if (OCCA_OS & LINUX_OS)
 
@@ -704,18 +956,323 @@ namespace occa {
   }
 
   void writeToFile(const std::string &filename,
-                   const std::string &content) {
+                   const std::string &content,
+                   const bool writingBinary) {
 
     sys::mkpath(getFileDirectory(filename));
 
-    FILE *fp = fopen(filename.c_str(), "w");
+    // Readers never see a partially written file
+    const std::string tmpFilename = sys::tmpFilename(filename);
+
+    FILE *fp = fopen(tmpFilename.c_str(), (writingBinary ? "wb" : "w"));
 
     OCCA_CHECK(fp != 0,
-               "Failed to open [" << compressFilename(filename) << "]");
+               "Failed to open [" << compressFilename(tmpFilename) << "]");
 
-    fputs(content.c_str(), fp);
+    fwrite(content.c_str(), sizeof(char), content.size(), fp);
 
     fclose(fp);
+
+    OCCA_CHECK(sys::rename(tmpFilename, filename) == 0,
+               "Failed to move [" << compressFilename(tmpFilename) << "] into place");
+  }
+
+  //---[ Hash Locks ]-----------------
+  // Hash locks are flock()'d files holding their owner's
+  //   [host pid time] record, which is cleared on a clean release.
+  //   The OS drops the lock of a crashed owner and a waiter that finds
+  //   the record left behind takes over the build.
+  // With [OCCA_NODE_LOCK_DIR] set, processes first elect a node leader
+  //   through a node-local lock and only the leader touches the locks
+  //   in the shared cache directory.
+  // Filesystems without flock() fall back to exclusively created
+  //   [.owner] files, broken once their owner is gone or stale
+  namespace hashLock {
+    static mutex_t mutex;
+
+    static std::map<std::string, int> nodeLocks;
+
+    static const int staleSeconds = 600;
+
+    enum waitResult_t {
+      released, tookOver, unsupported
+    };
+
+    static std::string ownerRecord() {
+      std::stringstream ss;
+
+#if (OCCA_OS & (LINUX_OS | OSX_OS))
+      ss << sys::hostname() << ' ' << getpid() << ' ' << time(NULL) << '\n';
+#else
+      ss << sys::hostname() << ' ' << GetCurrentProcessId() << ' ' << time(NULL) << '\n';
+#endif
+
+      return ss.str();
+    }
+
+    static void store(std::map<std::string, int> &locks,
+                      const std::string &lockFile,
+                      const int fd) {
+      mutex.lock();
+      locks[lockFile] = fd;
+      mutex.unlock();
+    }
+
+    // Returns the stored descriptor, or -2 if there is none
+    static int forget(std::map<std::string, int> &locks,
+                      const std::string &lockFile) {
+      int fd = -2;
+
+      mutex.lock();
+
+      std::map<std::string, int>::iterator it = locks.find(lockFile);
+
+      if(it != locks.end()) {
+        fd = it->second;
+        locks.erase(it);
+      }
+
+      mutex.unlock();
+
+      return fd;
+    }
+
+    static bool holds(std::map<std::string, int> &locks,
+                      const std::string &lockFile) {
+      mutex.lock();
+      const bool ret = (locks.find(lockFile) != locks.end());
+      mutex.unlock();
+
+      return ret;
+    }
+
+    static std::string nodeLockFor(const std::string &lockFile) {
+      // Node lock names are unique per shared cache directory
+      return (env::OCCA_NODE_LOCK_DIR + "occa_" +
+              getContentHash(env::OCCA_CACHE_DIR, "") + "_" +
+              lockFile.substr(getFileDirectory(lockFile).size()));
+    }
+
+#if (OCCA_OS & (LINUX_OS | OSX_OS))
+    static int openLock(const std::string &lockFile) {
+      const int fd = ::open(lockFile.c_str(), O_RDWR | O_CREAT, 0644);
+
+      OCCA_CHECK(0 <= fd,
+                 "Failed to open lock [" << compressFilename(lockFile) << "]");
+
+      return fd;
+    }
+
+    static void writeOwner(const int fd) {
+      const std::string record = ownerRecord();
+
+      if(::ftruncate(fd, 0) == 0)
+        ::pwrite(fd, record.c_str(), record.size(), 0);
+    }
+
+    static bool isClean(const int fd) {
+      struct stat statInfo;
+      fstat(fd, &statInfo);
+
+      return (statInfo.st_size == 0);
+    }
+
+    // Returns the locked descriptor, -1 if it's busy or
+    //   -2 if the filesystem doesn't support flock()
+    static int tryLock(const std::string &lockFile) {
+      const int fd = openLock(lockFile);
+
+      if(::flock(fd, LOCK_EX | LOCK_NB) == 0) {
+        writeOwner(fd);
+        return fd;
+      }
+
+      const int error = errno;
+      ::close(fd);
+
+      return ((error == EWOULDBLOCK) ? -1 : -2);
+    }
+
+    static void unlock(const int fd,
+                       const bool clean) {
+      if(clean)
+        ::ftruncate(fd, 0);
+
+      ::flock(fd, LOCK_UN);
+      ::close(fd);
+    }
+
+    // Waiters share the lock so they all wake up on release,
+    //   one of them takes over if the owner died
+    static waitResult_t wait(const std::string &lockFile, int &lockedFD) {
+      while(true) {
+        const int fd = openLock(lockFile);
+
+        if(::flock(fd, LOCK_SH) != 0) {
+          ::close(fd);
+          return unsupported;
+        }
+
+        if(isClean(fd)) {
+          unlock(fd, false);
+          return released;
+        }
+
+        ::flock(fd, LOCK_UN);
+
+        if(::flock(fd, LOCK_EX | LOCK_NB) == 0) {
+          // Someone may have finished the build in between
+          if(isClean(fd)) {
+            unlock(fd, false);
+            return released;
+          }
+
+          if(verboseCompilation_f)
+            std::cout << "Taking over the lock of a failed build [" << compressFilename(lockFile) << "]\n";
+
+          writeOwner(fd);
+          lockedFD = fd;
+
+          return tookOver;
+        }
+
+        ::close(fd);
+        usleep(1000);
+      }
+    }
+#endif
+
+    static bool ownerIsStale(const std::string &ownerFile) {
+      std::stringstream ss(readFile(ownerFile));
+
+      std::string host;
+      long pid     = -1;
+      long created = -1;
+
+      ss >> host >> pid >> created;
+
+      // Owners write their record right after creating the file
+      if(created < 0) {
+        struct stat statInfo;
+
+        if(stat(ownerFile.c_str(), &statInfo) != 0)
+          return false;
+
+        created = statInfo.st_mtime;
+      }
+
+      if(staleSeconds < (time(NULL) - created))
+        return true;
+
+#if (OCCA_OS & (LINUX_OS | OSX_OS))
+      if((host == sys::hostname()) &&
+         (::kill((pid_t) pid, 0) != 0) &&
+         (errno == ESRCH)) {
+        return true;
+      }
+#endif
+
+      return false;
+    }
+
+    static bool createOwnerFile(const std::string &lockFile) {
+      const std::string ownerFile = lockFile + ".owner";
+
+      while(true) {
+#if (OCCA_OS & (LINUX_OS | OSX_OS))
+        const int fd = ::open(ownerFile.c_str(), O_WRONLY | O_CREAT | O_EXCL, 0644);
+#else
+        const int fd = ::_open(ownerFile.c_str(), _O_WRONLY | _O_CREAT | _O_EXCL, _S_IREAD | _S_IWRITE);
+#endif
+
+        if(0 <= fd) {
+          const std::string record = ownerRecord();
+
+#if (OCCA_OS & (LINUX_OS | OSX_OS))
+          ::write(fd, record.c_str(), record.size());
+          ::close(fd);
+#else
+          ::_write(fd, record.c_str(), (unsigned int) record.size());
+          ::_close(fd);
+#endif
+
+          store(fileLocks, lockFile, -1);
+          return true;
+        }
+
+        OCCA_CHECK(errno == EEXIST,
+                   "Failed to create lock [" << compressFilename(ownerFile) << "]");
+
+        if(!ownerIsStale(ownerFile))
+          return false;
+
+        if(verboseCompilation_f)
+          std::cout << "Removing stale lock [" << compressFilename(ownerFile) << "]\n";
+
+        ::remove(ownerFile.c_str());
+      }
+    }
+
+    static bool waitForOwnerFile(const std::string &lockFile) {
+      const std::string ownerFile = lockFile + ".owner";
+
+      while(sys::fileExists(ownerFile)) {
+        if(ownerIsStale(ownerFile) &&
+           createOwnerFile(lockFile)) {
+          return true;
+        }
+
+#if (OCCA_OS & (LINUX_OS | OSX_OS))
+        usleep(10000);
+#else
+        Sleep(10);
+#endif
+      }
+
+      return false;
+    }
+
+    static bool tryShared(const std::string &lockFile) {
+#if (OCCA_OS & (LINUX_OS | OSX_OS))
+      const int fd = tryLock(lockFile);
+
+      if(0 <= fd) {
+        store(fileLocks, lockFile, fd);
+        return true;
+      }
+
+      if(fd == -1)
+        return false;
+#endif
+
+      return createOwnerFile(lockFile);
+    }
+
+    static bool waitForShared(const std::string &lockFile) {
+#if (OCCA_OS & (LINUX_OS | OSX_OS))
+      int fd;
+
+      const waitResult_t result = wait(lockFile, fd);
+
+      if(result == tookOver)
+        store(fileLocks, lockFile, fd);
+
+      if(result != unsupported)
+        return (result == tookOver);
+#endif
+
+      return waitForOwnerFile(lockFile);
+    }
+
+    static void releaseNode(const std::string &lockFile,
+                            const bool clean) {
+#if (OCCA_OS & (LINUX_OS | OSX_OS))
+      const int fd = forget(nodeLocks, lockFile);
+
+      if(0 <= fd)
+        unlock(fd, clean);
+#endif
+    }
   }
 
   std::string getFileLock(const std::string &hash, const int depth) {
@@ -723,52 +1280,114 @@ namespace occa {
 
     ret += '_';
     ret += (char) ('0' + depth);
+    ret += ".lock";
 
     return ret;
   }
 
+  // Called on exit, owner records are kept so waiters take over
   void clearLocks() {
-    strToBoolMapIterator it = fileLocks.begin();
+    std::map<std::string, int>::iterator it = fileLocks.begin();
+
     while (it != fileLocks.end()) {
-      releaseHash(it->first);
+#if (OCCA_OS & (LINUX_OS | OSX_OS))
+      if (0 <= it->second)
+        ::close(it->second);
+      else
+#endif
+        ::remove((it->first + ".owner").c_str());
+
       ++it;
     }
+
     fileLocks.clear();
+
+#if (OCCA_OS & (LINUX_OS | OSX_OS))
+    it = hashLock::nodeLocks.begin();
+
+    while (it != hashLock::nodeLocks.end()) {
+      ::close(it->second);
+      ++it;
+    }
+
+    hashLock::nodeLocks.clear();
+#endif
   }
 
   bool haveHash(const std::string &hash, const int depth) {
-    std::string lockDir = getFileLock(hash, depth);
+    const std::string lockFile = getFileLock(hash, depth);
 
-    sys::mkpath(env::OCCA_CACHE_DIR + "locks/");
+#if (OCCA_OS & (LINUX_OS | OSX_OS))
+    if (env::OCCA_NODE_LOCK_DIR.size()) {
+      sys::mkpath(env::OCCA_NODE_LOCK_DIR);
 
-    int mkdirStatus = sys::mkdir(lockDir);
+      const int fd = hashLock::tryLock(hashLock::nodeLockFor(lockFile));
 
-    if (mkdirStatus && (errno == EEXIST))
-      return false;
+      // Only the node leader goes on to the shared cache directory
+      if (fd == -1)
+        return false;
 
-    fileLocks[lockDir] = true;
+      if (0 <= fd)
+        hashLock::store(hashLock::nodeLocks, lockFile, fd);
+    }
+#endif
 
-    return true;
+    sys::mkpath(env::OCCA_CACHE_DIR + "locks/");
+
+    return hashLock::tryShared(lockFile);
   }
 
-  void waitForHash(const std::string &hash, const int depth) {
-    struct stat buffer;
+  bool waitForHash(const std::string &hash, const int depth) {
+    const std::string lockFile = getFileLock(hash, depth);
+
+#if (OCCA_OS & (LINUX_OS | OSX_OS))
+    if (env::OCCA_NODE_LOCK_DIR.size() &&
+        !hashLock::holds(hashLock::nodeLocks, lockFile)) {
+
+      int fd;
+
+      const hashLock::waitResult_t result = hashLock::wait(hashLock::nodeLockFor(lockFile), fd);
+
+      if (result == hashLock::released)
+        return false;
 
-    std::string lockDir   = getFileLock(hash, depth);
-    const char *c_lockDir = lockDir.c_str();
+      // The node leader died, this process leads the node now
+      if (result == hashLock::tookOver) {
+        hashLock::store(hashLock::nodeLocks, lockFile, fd);
 
-    while(stat(c_lockDir, &buffer) == 0)
-      ; // Do Nothing
+        if (hashLock::tryShared(lockFile))
+          return true;
+      }
+    }
+#endif
+
+    if (hashLock::waitForShared(lockFile))
+      return true;
+
+    // Wake up the node once the shared lock was released
+    hashLock::releaseNode(lockFile, true);
+
+    return false;
   }
 
   void releaseHash(const std::string &hash, const int depth) {
     releaseHashLock(getFileLock(hash, depth));
   }
 
-  void releaseHashLock(const std::string &lockDir) {
-    sys::rmdir(lockDir);
-    fileLocks.erase(lockDir);
+  void releaseHashLock(const std::string &lockFile) {
+    const int fd = hashLock::forget(fileLocks, lockFile);
+
+#if (OCCA_OS & (LINUX_OS | OSX_OS))
+    if (0 <= fd)
+      hashLock::unlock(fd, true);
+#endif
+
+    if (fd == -1)
+      ::remove((lockFile + ".owner").c_str());
+
+    hashLock::releaseNode(lockFile, true);
   }
+  //==================================
 
   bool fileNeedsParser(const std::string &filename) {
     std::string ext = getFileExtension(filename);
@@ -779,53 +1398,234 @@ namespace occa {
             (ext == "cu"));
   }
 
+  // [parsedFile].info keeps the parsedKernelInfo of every kernel in
+  //   [parsedFile] so cache hits skip the parser
+  namespace parsedInfo {
+    static const uint32_t magic     = 0x494b504f; // "OPKI"
+    static const uint32_t byteOrder = 0x01020304;
+
+    template <class TM>
+    static void put(std::string &buffer, const TM value) {
+      buffer.append((const char*) &value, sizeof(TM));
+    }
+
+    static void putString(std::string &buffer, const std::string &str) {
+      put<uint32_t>(buffer, (uint32_t) str.size());
+      buffer += str;
+    }
+
+    template <class TM>
+    static bool get(const char *&c, const char *cEnd, TM &value) {
+      if((size_t) (cEnd - c) < sizeof(TM))
+        return false;
+
+      ::memcpy(&value, c, sizeof(TM));
+      c += sizeof(TM);
+
+      return true;
+    }
+
+    static bool getString(const char *&c, const char *cEnd, std::string &str) {
+      uint32_t chars;
+
+      if(!get(c, cEnd, chars) ||
+         ((size_t) (cEnd - c) < chars)) {
+        return false;
+      }
+
+      str.assign(c, chars);
+      c += chars;
+
+      return true;
+    }
+
+    static std::string filenameFor(const std::string &parsedFile) {
+      return (parsedFile + ".info");
+    }
+
+    static void write(const std::string &filename,
+                      kernelInfoMap_t &kernelInfoMap) {
+      std::string buffer;
+
+      put<uint32_t>(buffer, magic);
+      put<uint32_t>(buffer, byteOrder);
+      put<int32_t>(buffer, parserVersion);
+      put<uint32_t>(buffer, (uint32_t) kernelInfoMap.size());
+
+      kernelInfoIterator it = kernelInfoMap.begin();
+
+      while(it != kernelInfoMap.end()) {
+        const parsedKernelInfo kInfo = (it->second)->makeParsedKernelInfo();
+        const int argCount = (int) kInfo.argumentInfos.size();
+
+        putString(buffer, it->first);
+        putString(buffer, kInfo.name);
+        putString(buffer, kInfo.baseName);
+        put<int32_t>(buffer, kInfo.nestedKernels);
+        put<uint32_t>(buffer, (uint32_t) argCount);
+
+        for(int i = 0; i < argCount; ++i) {
+          put<int32_t>(buffer, kInfo.argumentInfos[i].pos);
+          put<uint8_t>(buffer, kInfo.argumentInfos[i].isConst);
+        }
+
+        ++it;
+      }
+
+      writeToFile(filename, buffer, true);
+    }
+
+    // Returns false if the sidecar is missing or stale
+    static bool read(const std::string &filename,
+                     std::map<std::string, parsedKernelInfo> &kInfos) {
+      if(!sys::fileExists(filename))
+        return false;
+
+      const std::string buffer = readFile(filename, true);
+
+      const char *c    = buffer.c_str();
+      const char *cEnd = c + buffer.size();
+
+      uint32_t magic_, byteOrder_, kernelCount;
+      int32_t parserVersion_;
+
+      if(!get(c, cEnd, magic_)         || (magic_ != magic)                 ||
+         !get(c, cEnd, byteOrder_)     || (byteOrder_ != byteOrder)         ||
+         !get(c, cEnd, parserVersion_) || (parserVersion_ != parserVersion) ||
+         !get(c, cEnd, kernelCount)) {
+        return false;
+      }
+
+      for(uint32_t k = 0; k < kernelCount; ++k) {
+        std::string functionName;
+        parsedKernelInfo kInfo;
+        int32_t nestedKernels;
+        uint32_t argCount;
+
+        if(!getString(c, cEnd, functionName)  ||
+           !getString(c, cEnd, kInfo.name)     ||
+           !getString(c, cEnd, kInfo.baseName) ||
+           !get(c, cEnd, nestedKernels)        ||
+           !get(c, cEnd, argCount)) {
+          return false;
+        }
+
+        kInfo.nestedKernels = nestedKernels;
+        kInfo.argumentInfos.resize(argCount);
+
+        for(uint32_t i = 0; i < argCount; ++i) {
+          int32_t pos;
+          uint8_t isConst;
+
+          if(!get(c, cEnd, pos) ||
+             !get(c, cEnd, isConst)) {
+            return false;
+          }
+
+          kInfo.argumentInfos[i].pos     = pos;
+          kInfo.argumentInfos[i].isConst = isConst;
+        }
+
+        kInfos[functionName] = kInfo;
+      }
+
+      return true;
+    }
+
+    static bool hasAll(std::map<std::string, parsedKernelInfo> &kInfos,
+                       const std::vector<std::string> &functionNames) {
+      const int names = (int) functionNames.size();
+
+      for(int i = 0; i < names; ++i) {
+        if(kInfos.find(functionNames[i]) == kInfos.end())
+          return false;
+      }
+
+      return true;
+    }
+  }
+
   parsedKernelInfo parseFileForFunction(const std::string &deviceMode,
                                         const std::string &filename,
                                         const std::string &parsedFile,
                                         const std::string &functionName,
                                         const kernelInfo &info) {
 
-    parser fileParser;
+    return parseFileForFunctions(deviceMode,
+                                 filename,
+                                 parsedFile,
+                                 std::vector<std::string>(1, functionName),
+                                 info)[0];
+  }
+
+  std::vector<parsedKernelInfo> parseFileForFunctions(const std::string &deviceMode,
+                                                      const std::string &filename,
+                                                      const std::string &parsedFile,
+                                                      const std::vector<std::string> &functionNames,
+                                                      const kernelInfo &info) {
 
-    const std::string extension = getFileExtension(filename);
+    const std::string parsedInfoFile = parsedInfo::filenameFor(parsedFile);
+    const int names = (int) functionNames.size();
 
-    flags_t parserFlags = info.getParserFlags();
+    std::map<std::string, parsedKernelInfo> kInfos;
+    std::vector<parsedKernelInfo> ret(names);
 
-    parserFlags["mode"]     = deviceMode;
-    parserFlags["language"] = ((extension != "ofl") ? "C" : "Fortran");
+    if (!sys::fileExists(parsedFile)                  ||
+        !parsedInfo::read(parsedInfoFile, kInfos)     ||
+        !parsedInfo::hasAll(kInfos, functionNames)) {
 
-    if ((extension == "oak") ||
-       (extension == "oaf")) {
+      parser fileParser;
 
-      parserFlags["magic"] = "enabled";
-    }
+      const std::string extension = getFileExtension(filename);
 
-    std::string parsedContent = fileParser.parseFile(info.header,
-                                                     filename,
-                                                     parserFlags);
+      flags_t parserFlags = info.getParserFlags();
 
-    if (!sys::fileExists(parsedFile)) {
-      sys::mkpath(getFileDirectory(parsedFile));
+      parserFlags["mode"]     = deviceMode;
+      parserFlags["language"] = ((extension != "ofl") ? "C" : "Fortran");
 
-      std::ofstream fs;
-      fs.open(parsedFile.c_str());
+      if ((extension == "oak") ||
+         (extension == "oaf")) {
 
-      fs << parsedContent;
+        parserFlags["magic"] = "enabled";
+      }
 
-      fs.close();
+      std::string parsedContent = fileParser.parseFile(info.header,
+                                                       filename,
+                                                       parserFlags);
+
+      if(info.showsCompilation()) {
+        std::cout << "Parsed [" << compressFilename(filename) << "] in "
+                  << (1000 * fileParser.parseTime) << " ms, AST arena: "
+                  << (fileParser.arena.peakBytes >> 10) << " KB peak\n";
+      }
+
+      if (!sys::fileExists(parsedFile))
+        writeToFile(parsedFile, parsedContent);
+
+      parsedInfo::write(parsedInfoFile, fileParser.kernelInfoMap);
+
+      kInfos.clear();
+
+      kernelInfoIterator kIt = fileParser.kernelInfoMap.begin();
+
+      while(kIt != fileParser.kernelInfoMap.end()) {
+        kInfos[kIt->first] = (kIt->second)->makeParsedKernelInfo();
+        ++kIt;
+      }
     }
 
-    kernelInfoIterator kIt = fileParser.kernelInfoMap.find(functionName);
+    for(int i = 0; i < names; ++i) {
+      std::map<std::string, parsedKernelInfo>::iterator it = kInfos.find(functionNames[i]);
 
-    if (kIt != fileParser.kernelInfoMap.end())
-      return (kIt->second)->makeParsedKernelInfo();
+      OCCA_CHECK(it != kInfos.end(),
+                 "Could not find function ["
+                 << functionNames[i] << "] in file ["
+                 << compressFilename(filename    ) << "]");
 
-    OCCA_CHECK(false,
-               "Could not find function ["
-               << functionName << "] in file ["
-               << compressFilename(filename    ) << "]");
+      ret[i] = it->second;
+    }
 
-    return parsedKernelInfo();
+    return ret;
   }
 
   std::string removeSlashes(const std::string &str) {
@@ -845,7 +1645,7 @@ namespace occa {
   }
 
   void setupOccaHeaders(const kernelInfo &info) {
-    cacheFile(sys::getFilename("[occa]/primitives.hpp"),
+    cacheFile(getCachedOccaHeader("vector.hpp", "primitives"),
               readFile(env::OCCA_DIR + "/include/occa/defines/vector.hpp"),
               "vectorDefines");
 
@@ -866,17 +1666,11 @@ namespace occa {
                  const char *source,
                  const std::string &hash,
                  const bool deleteSource) {
-    if(!haveHash(hash)){
-      waitForHash(hash);
-    } else {
-      if (!sys::fileExists(filename)) {
-        sys::mkpath(getFileDirectory(filename));
-
-        std::ofstream fs2;
-        fs2.open(filename.c_str());
-        fs2 << source;
-        fs2.close();
-      }
+    if(!sys::fileExists(filename) &&
+       (haveHash(hash) || waitForHash(hash))) {
+      if (!sys::fileExists(filename))
+        writeToFile(filename, source);
+
       releaseHash(hash);
     }
     if (deleteSource)
@@ -896,11 +1690,13 @@ namespace occa {
 
     setupOccaHeaders(info);
 
+    const std::string tmpSourceFile = sys::tmpFilename(sourceFile);
+
     std::ofstream fs;
-    fs.open(sourceFile.c_str());
+    fs.open(tmpSourceFile.c_str());
 
     fs << "#include \"" << info.getModeHeaderFilename() << "\"\n"
-       << "#include \"" << sys::getFilename("[occa]/primitives.hpp") << "\"\n";
+       << "#include \"" << getCachedOccaHeader("vector.hpp", "primitives") << "\"\n";
 
     if (info.mode & (Serial | OpenMP | Pthreads | CUDA)) {
       fs << "#if defined(OCCA_IN_KERNEL) && !OCCA_IN_KERNEL\n"
@@ -913,6 +1709,8 @@ namespace occa {
        << readFile(filename);
 
     fs.close();
+
+    sys::rename(tmpSourceFile, sourceFile);
   }
   //==============================================
 
@@ -956,19 +1754,117 @@ namespace occa {
     return fnv(saltedString.c_str(), saltedString.size());
   }
 
+  // Bumped when cache names or the kernels/ layout change,
+  //   older entries then stop matching instead of being misread
+  static const uint64_t cacheVersion = 2;
+
   std::string getContentHash(const std::string &content,
                              const std::string &salt) {
+    hash_t hash(cacheVersion);
+
+    hash.update(content);
+    hash.update(salt);
+
+    return hash.digest();
+  }
+
+  namespace occaHeaders {
+    static mutex_t mutex;
+
+    static std::map<std::string, std::string> cachedNames;
+
+    static void hash(hash_t &hash_,
+                     const std::string &header,
+                     std::set<std::string> &hashed) {
+
+      const std::string filename = env::OCCA_DIR + "/include/occa/defines/" + header;
+
+      if(!hashed.insert(header).second ||
+         !sys::fileExists(filename)) {
+        return;
+      }
+
+      const std::string source = readFile(filename);
+      const std::string tag    = "#include \"occa/defines/";
+
+      hash_.update(header);
+      hash_.update(source);
+
+      size_t pos = source.find(tag);
+
+      while(pos != std::string::npos) {
+        pos += tag.size();
+
+        const size_t end = source.find('"', pos);
+
+        if(end == std::string::npos)
+          break;
+
+        hash(hash_, source.substr(pos, end - pos), hashed);
+
+        pos = source.find(tag, end);
+      }
+    }
+  }
 
-    std::string fo = fnv(content + salt);
+  std::string getCachedOccaHeader(const std::string &header,
+                                  const std::string &cachedName) {
+    occaHeaders::mutex.lock();
 
-    // Only taking the first 16 characters
-    return fo.substr(0, 16);
+    std::string &ret = occaHeaders::cachedNames[header];
+
+    if(ret.size() == 0) {
+      hash_t hash(cacheVersion);
+      std::set<std::string> hashed;
+
+      occaHeaders::hash(hash, header, hashed);
+
+      ret = sys::getFilename("[occa]/" + cachedName + "_" + hash.digest().substr(0, 16) + ".hpp");
+    }
+
+    const std::string filename = ret;
+
+    occaHeaders::mutex.unlock();
+
+    return filename;
   }
 
   std::string getFileContentHash(const std::string &filename,
                                  const std::string &salt) {
+    hash_t hash(cacheVersion);
+
+#if (OCCA_OS & (LINUX_OS | OSX_OS))
+    const int fd = ::open(filename.c_str(), O_RDONLY);
+
+    OCCA_CHECK(fd != -1,
+               "Failed to open [" << compressFilename(filename) << "]");
+
+    struct stat statbuf;
+    fstat(fd, &statbuf);
+
+    const size_t bytes = statbuf.st_size;
+
+    if(bytes) {
+      void *content = ::mmap(NULL, bytes, PROT_READ, MAP_PRIVATE, fd, 0);
+
+      if(content != MAP_FAILED) {
+        ::madvise(content, bytes, MADV_SEQUENTIAL);
+        hash.update(content, bytes);
+        ::munmap(content, bytes);
+      }
+      else {
+        hash.update(readFile(filename, true));
+      }
+    }
+
+    ::close(fd);
+#else
+    hash.update(readFile(filename, true));
+#endif
+
+    hash.update(salt);
 
-    return getContentHash(readFile(filename), salt);
+    return hash.digest();
   }
 
   std::string getLibraryName(const std::string &filename) {
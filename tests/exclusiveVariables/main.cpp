@@ -0,0 +1,59 @@
+#include <iostream>
+
+#include "occa.hpp"
+
+// Exclusive variables must keep their value across sequential loops
+//   wrapping the inner loops that use them
+int runKernel(occa::device &device,
+              const std::string &kernelName){
+
+  const int entries = 64;
+
+  int *out = new int[entries];
+
+  for(int i = 0; i < entries; ++i)
+    out[i] = 0;
+
+  occa::kernel kernel = device.buildKernelFromSource("exclusiveVariables.okl",
+                                                     kernelName);
+
+  occa::memory o_out = device.malloc(entries*sizeof(int), out);
+
+  kernel(entries, o_out);
+
+  o_out.copyTo(out);
+
+  int errors = 0;
+
+  for(int i = 0; i < entries; ++i){
+    if(out[i] != 5)
+      ++errors;
+  }
+
+  if(errors)
+    std::cout << kernelName << ": " << errors << " of " << entries
+              << " entries are wrong (out[0] = " << out[0] << ", expected 5)\n";
+  else
+    std::cout << kernelName << ": ok\n";
+
+  delete [] out;
+
+  kernel.free();
+  o_out.free();
+
+  return errors;
+}
+
+int main(int argc, char **argv){
+  occa::device device((1 < argc) ? argv[1] : "mode = Serial");
+
+  int errors = 0;
+
+  errors += runKernel(device, "seqAcc");
+  errors += runKernel(device, "tileAcc");
+  errors += runKernel(device, "innerAcc");
+
+  device.free();
+
+  return (errors ? 1 : 0);
+}